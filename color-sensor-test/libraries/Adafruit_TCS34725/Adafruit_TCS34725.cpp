@@ -222,12 +222,19 @@ void Adafruit_TCS34725::setGain(tcs34725Gain_t gain)
 /**************************************************************************/
 void Adafruit_TCS34725::getRawData (uint16_t *r, uint16_t *g, uint16_t *b, uint16_t *c)
 {
+  tcs34725RawData_t data = { 0, 0, 0, 0, 0 };
+
   if (!_tcs34725Initialised) begin();
 
-  *c = read16(TCS34725_CDATAL);
-  *r = read16(TCS34725_RDATAL);
-  *g = read16(TCS34725_GDATAL);
-  *b = read16(TCS34725_BDATAL);
+  /* the channels read 0 if the sensor does not answer */
+  *c = *r = *g = *b = 0;
+  if (getRawDataBurst(&data))
+  {
+    *c = data.c;
+    *r = data.r;
+    *g = data.g;
+    *b = data.b;
+  }
   
   /* Set a delay for the integration time */
   switch (_tcs34725IntegrationTime)
@@ -253,6 +260,63 @@ void Adafruit_TCS34725::getRawData (uint16_t *r, uint16_t *g, uint16_t *b, uint1
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief  Reads the clear, red, green and blue channels in one
+            transaction, from consecutive registers with auto-increment.
+            With checkValid the status register in front of them is read
+            in the same burst, and false is returned if the channels have
+            not completed an integration cycle (AVALID) yet. Does not wait
+            for the integration time. Returns false if the read failed.
+*/
+/**************************************************************************/
+boolean Adafruit_TCS34725::getRawDataBurst(tcs34725RawData_t *data, boolean checkValid)
+{
+  uint8_t bytes[TCS34725_DATA_BYTES + 1];
+  uint8_t count = checkValid ? TCS34725_DATA_BYTES + 1 : TCS34725_DATA_BYTES;
+
+  if (!_tcs34725Initialised) begin();
+
+  Wire.beginTransmission(TCS34725_ADDRESS);
+  #if ARDUINO >= 100
+  Wire.write(TCS34725_COMMAND_BIT | TCS34725_COMMAND_AUTO_INC | (checkValid ? TCS34725_STATUS : TCS34725_CDATAL));
+  #else
+  Wire.send(TCS34725_COMMAND_BIT | TCS34725_COMMAND_AUTO_INC | (checkValid ? TCS34725_STATUS : TCS34725_CDATAL));
+  #endif
+  Wire.endTransmission(false);  /* repeated start into the read */
+
+  if (Wire.requestFrom((uint8_t)TCS34725_ADDRESS, count) != count)
+  {
+    return false;
+  }
+  for (uint8_t i = 0; i < count; i++)
+  {
+    #if ARDUINO >= 100
+    bytes[i] = Wire.read();
+    #else
+    bytes[i] = Wire.receive();
+    #endif
+  }
+
+  data->status = checkValid ? bytes[0] : 0;
+  unpackRawData(checkValid ? bytes + 1 : bytes, data);
+  return !checkValid || (data->status & TCS34725_STATUS_AVALID);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills in the channels from the TCS34725_DATA_BYTES data
+            registers, low byte first, as read in a burst
+*/
+/**************************************************************************/
+void Adafruit_TCS34725::unpackRawData(const uint8_t *bytes, tcs34725RawData_t *data)
+{
+  data->c = bytes[0] | ((uint16_t)bytes[1] << 8);
+  data->r = bytes[2] | ((uint16_t)bytes[3] << 8);
+  data->g = bytes[4] | ((uint16_t)bytes[5] << 8);
+  data->b = bytes[6] | ((uint16_t)bytes[7] << 8);
+}
+
 /**************************************************************************/
 /*!
     @brief  Converts the raw R/G/B values to color temperature in degrees
@@ -47,6 +47,7 @@
 #define TCS34725_ADDRESS          (0x29)
 
 #define TCS34725_COMMAND_BIT      (0x80)
+#define TCS34725_COMMAND_AUTO_INC (0x20)    /* Command type: auto-increment protocol, for reading registers in one burst */
 
 #define TCS34725_ENABLE           (0x00)
 #define TCS34725_ENABLE_AIEN      (0x10)    /* RGBC Interrupt Enable */
@@ -94,6 +95,7 @@
 #define TCS34725_GDATAH           (0x19)
 #define TCS34725_BDATAL           (0x1A)    /* Blue channel data */
 #define TCS34725_BDATAH           (0x1B)
+#define TCS34725_DATA_BYTES       (8)       /* CDATAL to BDATAH */
 
 typedef enum
 {
@@ -115,6 +117,16 @@ typedef enum
 }
 tcs34725Gain_t;
 
+typedef struct
+{
+  uint8_t  status;                          /**<  TCS34725_STATUS, if it was read      */
+  uint16_t c;
+  uint16_t r;
+  uint16_t g;
+  uint16_t b;
+}
+tcs34725RawData_t;
+
 class Adafruit_TCS34725 {
  public:
   Adafruit_TCS34725(tcs34725IntegrationTime_t = TCS34725_INTEGRATIONTIME_2_4MS, tcs34725Gain_t = TCS34725_GAIN_1X);
@@ -123,6 +135,8 @@ class Adafruit_TCS34725 {
   void     setIntegrationTime(tcs34725IntegrationTime_t it);
   void     setGain(tcs34725Gain_t gain);
   void     getRawData(uint16_t *r, uint16_t *g, uint16_t *b, uint16_t *c);
+  boolean  getRawDataBurst(tcs34725RawData_t *data, boolean checkValid = false);
+  static void unpackRawData(const uint8_t *bytes, tcs34725RawData_t *data);
   uint16_t calculateColorTemperature(uint16_t r, uint16_t g, uint16_t b);
   uint16_t calculateLux(uint16_t r, uint16_t g, uint16_t b);
   void     write8 (uint8_t reg, uint32_t value);
@@ -21,6 +21,10 @@
     // Primes the multiplexer for a command
     void ColorSensor::startMultiplex()
     {
+      if (bus != NULL)
+      {
+        bus->invalidateChannel(); // written around the scheduler
+      } // end if
       Wire.beginTransmission(multiplexer_addr);
       Wire.write(1 << multiplexerPort);
       Wire.endTransmission();
@@ -95,9 +99,57 @@
     ColorSensor::COLOR_NAME ColorSensor::getColor()
     {
       uint16_t r, g, b, c;
-      int redAct, greenAct, blueAct;
   
       getRawColorData(&r, &g, &b, &c);
+      return findColor(r, g, b, c);
+    } // end getColor
+
+    // Without blocking: queues the read on sharedBus, behind the line bar, and returns true;
+    // false while the last read is queued or the sensor has not integrated a new reading since
+    bool ColorSensor::requestColor(I2CScheduler& sharedBus)
+    {
+      if (bus != NULL && colorJob.state == I2C_JOB_QUEUED)
+      {
+        return false; // still queued
+      } // end if
+      if (bus != NULL && millis() - requestTime < INTEGRATION_TIME)
+      {
+        return false; // the last reading again
+      } // end if
+      bus = &sharedBus;
+      requestTime = millis();
+
+      // from the status register on, so AVALID comes in the same transaction as the channels
+      colorJob.setRead(TCS34725_ADDRESS, TCS34725_COMMAND_BIT | TCS34725_COMMAND_AUTO_INC | TCS34725_STATUS, colorData, TCS34725_DATA_BYTES + 1);
+      colorJob.channel = multiplexerPort;
+      colorJob.priority = I2C_PRIORITY_COLOR;
+      bus->submit(colorJob);
+      return true;
+    } // end requestColor
+
+    // True once the requested read is in
+    bool ColorSensor::getIfColorReady()
+    {
+      return bus != NULL && colorJob.state != I2C_JOB_QUEUED;
+    } // end getIfColorReady
+
+    // The color the requested read saw; Unknown if it failed or the sensor had no reading yet
+    ColorSensor::COLOR_NAME ColorSensor::getRequestedColor()
+    {
+      if (bus == NULL || colorJob.state != I2C_JOB_DONE || !(colorData[0] & TCS34725_STATUS_AVALID))
+      {
+        return Unknown;
+      } // end if
+      tcs34725RawData_t data;
+      Adafruit_TCS34725::unpackRawData(colorData + 1, &data);
+      return findColor(data.r, data.g, data.b, data.c);
+    } // end getRequestedColor
+
+    // Finds the color closest to the raw color data
+    ColorSensor::COLOR_NAME ColorSensor::findColor(uint16_t r, uint16_t g, uint16_t b, uint16_t c)
+    {
+      int redAct, greenAct, blueAct;
+
       constrainColors(&r, &g, &b, &c, &redAct, &blueAct, &greenAct);
 
       // find closest color
@@ -129,4 +181,4 @@
       {
         return Unknown;
       } // end if
-    } // end getColor
\ No newline at end of file
+    } // end findColor
\ No newline at end of file
@@ -0,0 +1,100 @@
+#ifndef I2CSCHEDULER_H
+#define I2CSCHEDULER_H
+
+#include "Arduino.h"
+#include "Wire.h"
+
+/*
+Shares the I2C bus between the line bar, the color sensors and the multiplexer in front of them.
+Devices queue jobs, each one short transaction, and run() does the most urgent queued job, so
+the loop never waits for more than one transaction and a line bar read queued behind color reads
+goes first. Jobs belong to whoever queues them; nothing is allocated.
+
+	bus.submit(job);
+	...
+	bus.run(); // every loop
+	if (job.state == I2C_JOB_DONE) { ... job.rx is in ... }
+*/
+
+// priorities, most urgent first
+#define I2C_PRIORITY_LINE 0
+#define I2C_PRIORITY_COLOR 1
+#define I2C_PRIORITY_OTHER 2
+#define I2C_PRIORITIES 3
+
+// job states
+#define I2C_JOB_IDLE 0
+#define I2C_JOB_QUEUED 1
+#define I2C_JOB_DONE 2
+#define I2C_JOB_FAILED 3
+
+#define I2C_JOB_TX 4 // bytes a job writes, the register address included
+#define I2C_NO_CHANNEL 0xFF // device on the main bus, not behind the multiplexer
+#define I2C_MUX_ADDRESS 0x70
+
+struct I2CJob;
+typedef void (*I2CJobDone)(I2CJob& job); // called by run() when the job is done or failed
+
+// one transaction: write tx, then read rxLength bytes into rx; either part can be empty
+struct I2CJob {
+	uint8_t address;
+	uint8_t channel = I2C_NO_CHANNEL; // multiplexer channel the device is on
+	uint8_t priority = I2C_PRIORITY_OTHER;
+	uint8_t tx[I2C_JOB_TX];
+	uint8_t txLength = 0;
+	uint8_t* rx = 0;
+	uint8_t rxLength = 0;
+	uint8_t state = I2C_JOB_IDLE;
+	I2CJobDone done = 0;
+	void* context = 0; // for done
+	unsigned long queuedTime = 0; // micros() when submitted
+	I2CJob* next = 0;
+	// read count bytes from reg on
+	void setRead(uint8_t newAddress, uint8_t reg, uint8_t* data, uint8_t count) {
+		address = newAddress; tx[0] = reg; txLength = 1; rx = data; rxLength = count;
+	};
+	void setWrite(uint8_t newAddress, uint8_t reg, uint8_t value) {
+		address = newAddress; tx[0] = reg; tx[1] = value; txLength = 2; rxLength = 0;
+	};
+};
+
+// since the last resetStats(); times in microseconds
+struct I2CStats {
+	unsigned long jobs;
+	unsigned long failed;
+	unsigned long muxWrites; // channel changes written to the multiplexer
+	unsigned long muxSkipped; // jobs on the channel already selected
+	unsigned long busyTime; // in transactions, multiplexer writes included
+	unsigned long time; // since the stats were reset
+	unsigned long latencyCount[I2C_PRIORITIES]; // jobs started, by priority
+	unsigned long latencyTotal[I2C_PRIORITIES]; // submit to start
+	unsigned long latencyMax[I2C_PRIORITIES];
+	unsigned int utilization() { return time ? (unsigned int)(busyTime * 100.0 / time) : 0; }; // percent
+};
+
+class I2CScheduler {
+	private:
+		uint8_t muxAddress;
+		uint8_t channel = I2C_NO_CHANNEL; // selected on the multiplexer, I2C_NO_CHANNEL if not known
+		I2CJob* queue = 0; // by priority, in order of submission within one
+		I2CStats stats;
+		unsigned long statsStart = 0;
+		bool selectChannel(uint8_t newChannel);
+		bool transfer(I2CJob& job);
+	public:
+		I2CScheduler(uint8_t multiplexerAddress = I2C_MUX_ADDRESS);
+		void begin();
+		// false if the job is already queued
+		bool submit(I2CJob& job);
+		bool cancel(I2CJob& job);
+		// does the most urgent queued job; false if there was none
+		bool run();
+		bool getIfIdle() { return queue == 0; };
+		// the multiplexer was written around the scheduler; select the channel again before the next job on one
+		void invalidateChannel() { channel = I2C_NO_CHANNEL; };
+		uint8_t getChannel() { return channel; };
+		void getStats(I2CStats& copy);
+		void resetStats();
+};
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "Adafruit_TCS34725.h"
 #include "Arduino.h"
+#include "I2CScheduler.h"
 #include <Wire.h>
 
 class ColorSensor
@@ -48,6 +49,15 @@ class ColorSensor
 
     uint8_t multiplexerPort = 0;
 
+    // Integration time the sensor was set to, in milliseconds; a new reading is ready this often
+    const unsigned long INTEGRATION_TIME = 101;
+
+    // Reads through a shared bus: the status and the four channels in one burst
+    I2CScheduler* bus = NULL;
+    I2CJob colorJob;
+    uint8_t colorData[TCS34725_DATA_BYTES + 1];
+    unsigned long requestTime = 0;
+
     // Primes the multiplexer for a command
     void startMultiplex();
 
@@ -83,7 +93,22 @@ class ColorSensor
     void initSensor(uint8_t multiplexerPort);
 
     // Gets the color from the color sensor and returns the enum of the color the sensor sees
+    // Blocks for the read and the integration time
     COLOR_NAME getColor();
+
+    // Without blocking: queues the read on sharedBus, behind the line bar, and returns true;
+    // false while the last read is queued or the sensor has not integrated a new reading since
+    bool requestColor(I2CScheduler& sharedBus);
+
+    // True once the requested read is in
+    bool getIfColorReady();
+
+    // The color the requested read saw; Unknown if it failed or the sensor had no reading yet
+    COLOR_NAME getRequestedColor();
+
+  private:
+    // Finds the color closest to the raw color data
+    COLOR_NAME findColor(uint16_t r, uint16_t g, uint16_t b, uint16_t c);
 };
 
 #endif
\ No newline at end of file
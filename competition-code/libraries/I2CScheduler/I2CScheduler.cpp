@@ -0,0 +1,127 @@
+#include "I2CScheduler.h"
+
+
+I2CScheduler::I2CScheduler(uint8_t multiplexerAddress) {
+	muxAddress = multiplexerAddress;
+	resetStats();
+}
+
+void I2CScheduler::begin() {
+	Wire.begin();
+	invalidateChannel();
+	resetStats();
+}
+
+
+bool I2CScheduler::submit(I2CJob& job) {
+	if (job.state == I2C_JOB_QUEUED) {
+		return false;
+	}
+	if (job.priority >= I2C_PRIORITIES) {
+		job.priority = I2C_PRIORITIES-1;
+	}
+	job.state = I2C_JOB_QUEUED;
+	job.queuedTime = micros();
+	// behind every job of the same or a more urgent priority
+	I2CJob** link = &queue;
+	while (*link && (*link)->priority <= job.priority) {
+		link = &(*link)->next;
+	}
+	job.next = *link;
+	*link = &job;
+	return true;
+}
+
+bool I2CScheduler::cancel(I2CJob& job) {
+	for (I2CJob** link = &queue; *link; link = &(*link)->next) {
+		if (*link == &job) {
+			*link = job.next;
+			job.next = 0;
+			job.state = I2C_JOB_IDLE;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+// the multiplexer keeps its channel until it is written again, so a job on the selected channel needs no write
+bool I2CScheduler::selectChannel(uint8_t newChannel) {
+	if (newChannel == I2C_NO_CHANNEL || newChannel == channel) {
+		stats.muxSkipped += newChannel != I2C_NO_CHANNEL;
+		return true;
+	}
+	Wire.beginTransmission(muxAddress);
+	Wire.write(1 << newChannel);
+	if (Wire.endTransmission() != 0) {
+		invalidateChannel();
+		return false;
+	}
+	channel = newChannel;
+	stats.muxWrites++;
+	return true;
+}
+
+// no waiting for bytes: requestFrom returns once they are read, or with fewer if the device stopped answering
+bool I2CScheduler::transfer(I2CJob& job) {
+	if (job.txLength > 0) {
+		Wire.beginTransmission(job.address);
+		for (uint8_t i = 0; i < job.txLength; i++) {
+			Wire.write(job.tx[i]);
+		}
+		// a read follows with a repeated start
+		if (Wire.endTransmission(job.rxLength == 0) != 0) {
+			return false;
+		}
+	}
+	if (job.rxLength > 0) {
+		if (Wire.requestFrom(job.address,job.rxLength) != job.rxLength) {
+			return false;
+		}
+		for (uint8_t i = 0; i < job.rxLength; i++) {
+			job.rx[i] = Wire.read();
+		}
+	}
+	return true;
+}
+
+
+bool I2CScheduler::run() {
+	I2CJob* job = queue;
+	if (!job) {
+		return false;
+	}
+	queue = job->next;
+	job->next = 0;
+
+	unsigned long start = micros();
+	unsigned long latency = start - job->queuedTime;
+	stats.latencyCount[job->priority]++;
+	stats.latencyTotal[job->priority] += latency;
+	if (latency > stats.latencyMax[job->priority]) {
+		stats.latencyMax[job->priority] = latency;
+	}
+
+	bool ok = selectChannel(job->channel) && transfer(*job);
+	stats.busyTime += micros() - start;
+	stats.jobs++;
+	if (!ok) {
+		stats.failed++;
+	}
+	job->state = ok ? I2C_JOB_DONE : I2C_JOB_FAILED;
+	if (job->done) {
+		job->done(*job);
+	}
+	return true;
+}
+
+
+void I2CScheduler::getStats(I2CStats& copy) {
+	copy = stats;
+	copy.time = micros() - statsStart;
+}
+
+void I2CScheduler::resetStats() {
+	memset(&stats, 0, sizeof(stats));
+	statsStart = micros();
+}
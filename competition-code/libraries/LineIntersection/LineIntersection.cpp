@@ -1,4 +1,5 @@
 #include "LineIntersection.h"
+#include "LineTableData.h"
 
 LineIntersection::LineIntersection()
 {
@@ -7,8 +8,8 @@ LineIntersection::LineIntersection()
 }
 
 
-LineIntersection::LineIntersection(int pin) {
-	mySensorBar = new SensorBar(SX1509_ADDRESS);
+LineIntersection::LineIntersection(int pin, uint8_t interruptPin) {
+	mySensorBar = new SensorBar(SX1509_ADDRESS,255,interruptPin);
 	mySensorBar->clearBarStrobe();
 	mySensorBar->clearInvertBits();
 	mySensorBar->begin();
@@ -16,6 +17,29 @@ LineIntersection::LineIntersection(int pin) {
 
 	// set middlePin
 	middlePin = pin;
+
+	sampleJob.setRead(SX1509_ADDRESS,SENSORBAR_DATA_REGISTER,&sampleData,1);
+	sampleJob.priority = I2C_PRIORITY_LINE;
+	sampleJob.done = sampleRead;
+	sampleJob.context = this;
+}
+
+
+void LineIntersection::scheduleSample(I2CScheduler& bus) {
+	sampledOnBus = true;
+	if (sampleJob.state != I2C_JOB_QUEUED && mySensorBar->takeChange()) {
+		bus.submit(sampleJob);
+	}
+}
+
+void LineIntersection::sampleRead(I2CJob& job) {
+	SensorBar* bar = ((LineIntersection*)job.context)->mySensorBar;
+	if (job.state == I2C_JOB_DONE) {
+		bar->addSample(*job.rx);
+	}
+	else {
+		bar->dropChange();
+	}
 }
 
 
@@ -39,107 +63,54 @@ bool LineIntersection::getMiddleState() {
 
 
 int8_t LineIntersection::getArrayDataSum() {
-	String line_data = getArrayDataInString();
-	int8_t data_sum_vector = 0;
-	for (int8_t i = BYTE_SIZE-1; i >= 0; i--) {
-		if (line_data[i] == ON_LINE && i >= 4) {
-			data_sum_vector++;
-		}
-		else if (line_data[i] == ON_LINE) { // Implying that i <= 3.
-			data_sum_vector--;
-		}
-	}
-}
-
-
-
-
-String LineIntersection::getFullArrayInString() {
-	String lineData = "";
-	density = 0;
-	int bit_value;
-	// get data
 	line_byte = mySensorBar->getRaw();
-	bool state = getMiddleState();
-
-	for (int8_t i = BYTE_SIZE-1; i >= 0; i--) {
-		bit_value = bitRead(line_byte,i);
-		lineData += (bit_value ? ON_LINE : OFF_LINE);
-		density += bit_value;
-		if (i == 4) {
-			lineData += (state ? ON_LINE : OFF_LINE);
-			density += state;
-		}
-
-	}
-	lastFullReading = lineData;
-	return lineData;
+	// right half counts up, left half counts down
+	return getDensity(packReading(line_byte & 0x0F,false)) - getDensity(packReading(line_byte & 0xF0,false));
 }
 
 
-int LineIntersection::getLinePosition(bool getNewData) {
-	int position = 0;
-	// get new data if requested
-	if (getNewData) {
-		getFullArrayInString();
-	}
-	if (lastFullReading[4] == ON_LINE) {
-		// if on the line, only worry about closest two sensors
-		if (lastFullReading[3] == ON_LINE) position -= 1;
-		if (lastFullReading[5] == ON_LINE) position += 1;
-	}
-	else {
-		// otherwise, worry about all
-		if (lastFullReading[3] == ON_LINE || lastFullReading[5] == ON_LINE) {
-			if (lastFullReading[3] == ON_LINE) position -= 4;
-			if (lastFullReading[5] == ON_LINE) position += 4;
-		}
-		else if (lastFullReading[2] == ON_LINE || lastFullReading[6] == ON_LINE) {
-			if (lastFullReading[2] == ON_LINE) position -= 8;
-			if (lastFullReading[6] == ON_LINE) position += 8;
-		}
-		else if (lastFullReading[1] == ON_LINE || lastFullReading[7] == ON_LINE) {
-			if (lastFullReading[1] == ON_LINE) position -= 12;
-			if (lastFullReading[7] == ON_LINE) position += 12;
-		}
-		else if (lastFullReading[0] == ON_LINE || lastFullReading[8] == ON_LINE) {
-			if (lastFullReading[0] == ON_LINE) position -= 16;
-			if (lastFullReading[8] == ON_LINE) position += 16;
-		}
-		// remember last position if no IRs are on_line
-		if (position == 0) {
-			position = lastPosition;
-		}
-	}
-	// set lastPosition to most recent position
-	lastPosition = position;
-	return lastPosition;
+uint8_t LineIntersection::getDensity(uint16_t reading) {
+	return pgm_read_byte(&LINE_DENSITY[reading & (LINE_READING_COUNT-1)]);
 }
 
 
-bool LineIntersection::getIfAtPerpendicular() {
-	int required_density = 5;
-	return getDensity() >= required_density;
+int8_t LineIntersection::getPosition(uint16_t reading) {
+	return (int8_t)pgm_read_byte(&LINE_POSITION[reading & (LINE_READING_COUNT-1)]);
 }
 
 
-bool LineIntersection::getIfAtSeparatingY() {
-	return (lastFullReading[2] == ON_LINE && lastFullReading[6] == ON_LINE)
-			|| (lastFullReading[1] == ON_LINE && lastFullReading[7] == ON_LINE);
+uint8_t LineIntersection::getClass(uint16_t reading) {
+	return pgm_read_byte(&LINE_CLASS[reading & (LINE_READING_COUNT-1)]);
 }
 
 
-bool LineIntersection::getIfAtCrossingY() {
-	return getIfAtSeparatingY();
+uint16_t LineIntersection::readLine() {
+	line_byte = sampledOnBus ? mySensorBar->getLastRaw() : mySensorBar->getRaw();
+	lastReading = packReading(line_byte,getMiddleState());
+	return lastReading;
 }
 
 
-bool LineIntersection::getIfAtRightY() {
-	return getIfAtPerpendicular();
+String LineIntersection::getFullArrayInString() {
+	String lineData = "";
+	readLine();
+	// all 9 bits, leftmost sensor first
+	for (int8_t i = BYTE_SIZE; i >= 0; i--) {
+		lineData += (bitRead(lastReading,i) ? ON_LINE : OFF_LINE);
+	}
+	return lineData;
 }
 
 
-bool LineIntersection::getIfAtLeftY() {
-	return getIfAtPerpendicular();
+int LineIntersection::getLinePosition(bool getNewData) {
+	// get new data if requested
+	if (getNewData) {
+		readLine();
+	}
+	int8_t position = getPosition(lastReading);
+	// remember last position if no IRs are on_line
+	if (position != LINE_NO_POSITION) {
+		lastPosition = position;
+	}
+	return lastPosition;
 }
-
@@ -0,0 +1,255 @@
+#include "LineTracker.h"
+
+
+void LineTracker::getFeatures(uint16_t reading, LineFeatures& f) {
+	f.runs = 0;
+	f.left = -1;
+	f.right = -1;
+	f.gap = 0;
+	int8_t firstEnd = -1; // last sensor of the leftmost line
+	bool previous = false;
+	for (int8_t i = 0; i <= BYTE_SIZE; i++) {
+		bool on = (reading >> (BYTE_SIZE-i)) & 1;
+		if (on && !previous) {
+			f.runs++;
+			if (f.left < 0) {
+				f.left = i;
+			}
+			else {
+				// start of a line right of the first: sensors since the first ended are the gap
+				f.gap = i - firstEnd - 1;
+			}
+		}
+		if (!on && previous && firstEnd < 0) {
+			firstEnd = i - 1;
+		}
+		if (on) {
+			f.right = i;
+		}
+		previous = on;
+	}
+}
+
+
+uint8_t LineTracker::getShape(Approach approachType) {
+	switch (approachType) {
+	case NoFollowUntilPerpendicularLine:
+	case FollowUntilPerpendicularLine:
+	case FollowOnLeftUntilPerpendicularLine:
+	case FollowOnRightUntilPerpendicularLine:
+		return LINE_SHAPE_PERPENDICULAR;
+	case FollowOnLeftUntilCrossesLine:
+		return LINE_SHAPE_LEFT_BRANCH;
+	case FollowOnRightUntilCrossesLine:
+		return LINE_SHAPE_RIGHT_BRANCH;
+	case FollowUntilCrossingY:
+		return LINE_SHAPE_CROSSING_Y;
+	case FollowUntilSeparatingY:
+		return LINE_SHAPE_SEPARATING_Y;
+	default:
+		return LINE_SHAPE_NONE;
+	}
+}
+
+uint8_t LineTracker::getShape(BackwardApproach approachType) {
+	switch (approachType) {
+	case BackwardFollowUntilCrossingY:
+		return LINE_SHAPE_CROSSING_Y;
+	case BackwardFollowUntilSeparatingY:
+		return LINE_SHAPE_SEPARATING_Y;
+	case BackwardFollowUntilPerpendicularLine:
+		return LINE_SHAPE_PERPENDICULAR;
+	default:
+		return LINE_SHAPE_NONE;
+	}
+}
+
+
+void LineTracker::reset() {
+	shape = LINE_SHAPE_NONE;
+	phase = LINE_TRACK_IDLE;
+	distance = 0;
+	historyEnd = 0;
+	apartReadings = 0;
+	apartDistance = -LINE_MERGE_DISTANCE - 1;
+	lineLeft = 4;
+	lineRight = 4;
+	memset(history, 0, sizeof(history));
+}
+
+bool LineTracker::start(uint8_t newShape, long count) {
+	reset();
+	if (newShape == LINE_SHAPE_NONE) {
+		return false;
+	}
+	shape = newShape;
+	phase = LINE_TRACK_FOLLOW;
+	lastCount = count;
+	return true;
+}
+
+
+void LineTracker::record(uint16_t reading) {
+	// after a jump longer than the history, only the newest slots matter
+	long behind = (distance - historyEnd) / LINE_HISTORY_STEP;
+	if (behind >= LINE_HISTORY_SIZE) {
+		historyEnd += (behind - LINE_HISTORY_SIZE + 1) * LINE_HISTORY_STEP;
+	}
+	while (historyEnd <= distance) {
+		history[(historyEnd / LINE_HISTORY_STEP) & (LINE_HISTORY_SIZE-1)] = reading;
+		historyEnd += LINE_HISTORY_STEP;
+	}
+}
+
+uint16_t LineTracker::getReadingBack(long distanceBack) {
+	long at = distance - distanceBack;
+	long oldest = max(0L,historyEnd - LINE_HISTORY_SIZE * LINE_HISTORY_STEP);
+	if (at < oldest) {
+		at = oldest;
+	}
+	return history[(at / LINE_HISTORY_STEP) & (LINE_HISTORY_SIZE-1)];
+}
+
+
+// the line reaches out to the branch side, and not to the other
+bool LineTracker::getIfBranch(const LineFeatures& f) {
+	if (shape == LINE_SHAPE_LEFT_BRANCH) {
+		return f.runs > 0 && f.left <= lineLeft - 2 && f.right <= lineRight + 1;
+	}
+	return f.runs > 0 && f.right >= lineRight + 2 && f.left >= lineLeft - 1;
+}
+
+/*
+What starts each shape, seen from the followed line (lineLeft to lineRight):
+- perpendicular: the line reaches both ends of the bar, and was narrow a short distance before;
+  a line that widens slowly is a fork or a drift, not a line across
+- separating Y: two lines on both sides of where the followed one was
+- crossing Y: a second line in view
+- branches: the line grows to one side only, in one piece; a line seen apart from the followed one
+  first is one coming in at an angle, as in a crossing Y, and only merges into it
+*/
+bool LineTracker::getIfStarted(const LineFeatures& f) {
+	switch (shape) {
+	case LINE_SHAPE_PERPENDICULAR:
+		if (f.left > 1 || f.right < BYTE_SIZE-1) {
+			return false;
+		}
+		for (long back = 0; back <= LINE_EDGE_DISTANCE; back += LINE_HISTORY_STEP) {
+			LineFeatures before;
+			getFeatures(getReadingBack(back),before);
+			if (getIfNarrow(before)) {
+				return true;
+			}
+		}
+		return false;
+	case LINE_SHAPE_SEPARATING_Y:
+		return f.runs >= 2 && f.left <= lineLeft && f.right >= lineRight;
+	case LINE_SHAPE_CROSSING_Y:
+		return f.runs >= 2;
+	case LINE_SHAPE_LEFT_BRANCH:
+	case LINE_SHAPE_RIGHT_BRANCH:
+		return f.runs == 1 && getIfBranch(f) && distance - apartDistance > LINE_MERGE_DISTANCE;
+	default:
+		return false;
+	}
+}
+
+// while started, whether the shape is still developing the way it should
+bool LineTracker::getIfHolding(const LineFeatures& f) {
+	switch (shape) {
+	case LINE_SHAPE_PERPENDICULAR:
+		// a sensor dropping out in the middle splits the line but does not end it
+		return f.left <= 1 && f.right >= BYTE_SIZE-1;
+	case LINE_SHAPE_SEPARATING_Y:
+		return f.runs >= 2 && f.gap >= startGap;
+	case LINE_SHAPE_CROSSING_Y:
+		return f.runs >= 2 && f.gap <= startGap;
+	case LINE_SHAPE_LEFT_BRANCH:
+	case LINE_SHAPE_RIGHT_BRANCH:
+		return getIfBranch(f);
+	default:
+		return false;
+	}
+}
+
+
+bool LineTracker::update(uint16_t reading, long count) {
+	if (phase == LINE_TRACK_IDLE) {
+		return false;
+	}
+	distance += labs(count - lastCount);
+	lastCount = count;
+	record(reading);
+	if (phase == LINE_TRACK_DONE) {
+		return true;
+	}
+	LineFeatures f;
+	getFeatures(reading,f);
+	if (shape == LINE_SHAPE_LEFT_BRANCH || shape == LINE_SHAPE_RIGHT_BRANCH) {
+		// a separate line on the branch side, seen often enough not to be a misreading
+		if (f.runs >= 2 && getIfBranch(f)) {
+			if (apartReadings < LINE_CONFIRM_READINGS) {
+				apartReadings++;
+			}
+			if (apartReadings >= LINE_CONFIRM_READINGS) {
+				apartDistance = distance;
+			}
+		}
+		else {
+			apartReadings = 0;
+		}
+	}
+	if (phase == LINE_TRACK_START) {
+		bool fits = getIfHolding(f);
+		if (fits) {
+			misses = 0;
+			if (startReadings < LINE_CONFIRM_READINGS) {
+				startReadings++;
+			}
+		}
+		bool held = distance - startDistance >= confirmDistance && startReadings >= LINE_CONFIRM_READINGS;
+		if (shape == LINE_SHAPE_CROSSING_Y && f.runs == 1) {
+			// the two lines joined: as wide as the pair was, after the pair held long enough;
+			// a line leaving the bar also leaves one line, but a narrow one
+			if (held && f.right - f.left >= pairWidth - 1) {
+				phase = LINE_TRACK_DONE;
+			}
+			else if (++misses >= LINE_MISS_READINGS) {
+				phase = LINE_TRACK_FOLLOW;
+			}
+		}
+		else if (!fits) {
+			if (++misses >= LINE_MISS_READINGS) {
+				phase = LINE_TRACK_FOLLOW;
+			}
+		}
+		else if (shape == LINE_SHAPE_CROSSING_Y) {
+			// width of the pair, for telling a join from a line leaving
+			pairWidth = f.right - f.left;
+		}
+		else if (held && (shape != LINE_SHAPE_SEPARATING_Y || f.gap > startGap)) {
+			phase = LINE_TRACK_DONE;
+		}
+	}
+	if (phase == LINE_TRACK_FOLLOW) {
+		if (getIfStarted(f)) {
+			phase = LINE_TRACK_START;
+			startDistance = distance;
+			startReadings = 1;
+			misses = 0;
+			startGap = f.gap;
+			pairWidth = f.right - f.left;
+		}
+		else if (getIfNarrow(f) && reading == lastNarrow) {
+			// the followed line moves only when two readings agree, so one misreading cannot move it
+			lineLeft = f.left;
+			lineRight = f.right;
+		}
+	}
+	lastNarrow = getIfNarrow(f) ? reading : 0;
+	if (phase == LINE_TRACK_DONE) {
+		eventCount = count;
+		return true;
+	}
+	return false;
+}
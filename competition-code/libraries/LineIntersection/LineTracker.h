@@ -0,0 +1,99 @@
+#ifndef LINETRACKER_H
+#define LINETRACKER_H
+
+#include "Arduino.h"
+#include "LineIntersection.h"
+#include "Movement.h"
+
+/*
+Tells intersections apart from how the line changes as the robot moves, which a single reading cannot:
+a crossing Y and a separating Y both show two lines, but their gap shrinks in one and grows in the other.
+Readings are kept by encoder distance, not time, so the shapes look the same at any speed and in
+either direction. Distances are in encoder counts.
+
+	tracker.start(FollowUntilSeparatingY,controller.getCount());
+	while (!tracker.update(line.readLine(),controller.getCount())) { ... follow the line ... }
+*/
+
+// shapes an approach ends at
+#define LINE_SHAPE_NONE 0
+#define LINE_SHAPE_PERPENDICULAR 1 // a line across the whole bar
+#define LINE_SHAPE_CROSSING_Y 2 // a second line comes in from the side and joins the followed one
+#define LINE_SHAPE_SEPARATING_Y 3 // the followed line splits in two that move apart
+#define LINE_SHAPE_LEFT_BRANCH 4 // a line meets the followed one from the left only, joined to it as it comes into view
+#define LINE_SHAPE_RIGHT_BRANCH 5 // a line meets the followed one from the right only, joined to it as it comes into view
+
+// tracker phases
+#define LINE_TRACK_IDLE 0
+#define LINE_TRACK_FOLLOW 1 // on a single line, waiting for the shape to start
+#define LINE_TRACK_START 2 // the shape started; waiting until it holds long enough
+#define LINE_TRACK_DONE 3 // confirmed
+
+#define LINE_HISTORY_SIZE 32 // readings kept; power of two
+#define LINE_HISTORY_STEP 2 // counts between kept readings
+#define LINE_CONFIRM_DISTANCE 6 // counts a shape has to hold before it is reported
+#define LINE_CONFIRM_READINGS 3 // and readings, so a sensor misreading twice in a row is not a shape
+#define LINE_MISS_READINGS 2 // readings in a row that break a started shape; fewer are misreadings
+#define LINE_EDGE_DISTANCE 12 // counts over which a perpendicular line goes from narrow to full width
+#define LINE_NARROW_WIDTH 3 // widest single line (sensors, edge to edge) that counts as the followed line
+// counts after a separate line was last seen beside the followed one during which the line growing to
+// that side is the two merging, not a branch; covers lines that join at 20 degrees or more
+#define LINE_MERGE_DISTANCE 24
+
+// runs of sensors on the line in a reading; sensors are numbered from the left, the middle IR is 4
+struct LineFeatures {
+	uint8_t runs; // separate lines seen
+	int8_t left; // leftmost sensor on a line
+	int8_t right; // rightmost sensor on a line
+	int8_t gap; // sensors off the line between the outer two lines, 0 for a single line
+};
+
+class LineTracker {
+	private:
+		uint8_t shape = LINE_SHAPE_NONE;
+		uint8_t phase = LINE_TRACK_IDLE;
+		long lastCount = 0;
+		long distance = 0; // counts travelled since start, either direction
+		long startDistance = 0; // where the shape started
+		uint8_t startReadings = 0; // readings that fit the shape since
+		uint8_t misses = 0; // readings in a row that did not fit the started shape
+		uint8_t apartReadings = 0; // branches: readings in a row with a separate line on the branch side
+		long apartDistance = 0; // where that line was last seen
+		uint16_t lastNarrow = 0; // previous reading, if it was a single narrow line
+		long eventCount = 0; // encoder count the shape was confirmed at
+		int8_t startGap = 0;
+		int8_t pairWidth = 0; // crossing Y: edge to edge width of the two lines
+		int8_t lineLeft = 4; // edges of the followed line
+		int8_t lineRight = 4;
+		long confirmDistance = LINE_CONFIRM_DISTANCE;
+		// readings by distance: slot (d / LINE_HISTORY_STEP) % LINE_HISTORY_SIZE holds the reading at distance d
+		uint16_t history[LINE_HISTORY_SIZE];
+		long historyEnd = 0; // distance of the next slot to fill
+		void record(uint16_t reading);
+		bool getIfNarrow(const LineFeatures& f) { return f.runs == 1 && f.right - f.left < LINE_NARROW_WIDTH; };
+		bool getIfBranch(const LineFeatures& f);
+		bool getIfStarted(const LineFeatures& f);
+		bool getIfHolding(const LineFeatures& f);
+	public:
+		LineTracker() { reset(); };
+		static void getFeatures(uint16_t reading, LineFeatures& f);
+		// shape the approach ends at, LINE_SHAPE_NONE for approaches that do not end at a line
+		static uint8_t getShape(Approach approachType);
+		static uint8_t getShape(BackwardApproach approachType);
+		// look for a shape from the current encoder count; false if there is nothing to look for
+		bool start(uint8_t newShape, long count);
+		bool start(Approach approachType, long count) { return start(getShape(approachType),count); };
+		bool start(BackwardApproach approachType, long count) { return start(getShape(approachType),count); };
+		void reset();
+		// feed every reading with the encoder count it was taken at; true from the reading that confirms the shape
+		bool update(uint16_t reading, long count);
+		// reading distanceBack counts before the newest, as far back as the history goes
+		uint16_t getReadingBack(long distanceBack);
+		uint8_t getPhase() { return phase; };
+		uint8_t getShape() { return shape; };
+		long getDistance() { return distance; };
+		long getEventCount() { return eventCount; };
+		void setConfirmDistance(long counts) { confirmDistance = counts; };
+};
+
+#endif
@@ -21,6 +21,7 @@ namespace moveOptions {
         MoveIntoDropPosition
 	};
 	enum BackwardApproach {
+		NoBackwardApproach=0,
 		BackwardLeaveDropPosition=1,
 		BackwardFollowUntilCrossingY, BackwardFollowUntilSeparatingY,
 		BackwardFollowUntilPerpendicularLine
@@ -29,13 +30,20 @@ namespace moveOptions {
 
 using namespace moveOptions;
 
+#define MOVEMENT_MAX_CHAIN 16 // most approaches followed without stopping in between
+
 class Movement
 {
+protected:
+	bool cruiseThrough = false; // approaches keep their speed instead of stopping at the line when set
 public:
 	Movement();
 	~Movement();
 	void performTurn(Turn turnType);
 	void performApproach(Approach approachType);
+	// follows the approaches one after another at cruise speed; only the last one stops at its line
+	void performApproaches(const Approach* approachTypes, uint8_t count);
+	bool getIfCruising() { return cruiseThrough; }; // true while the current approach is followed by another one
 	void performBackwardApproach(BackwardApproach approachType);
 	// Turn methods
     // TODO: stop using these, make them private if we really need them (I doubt we need them), use the parameter one
@@ -0,0 +1,86 @@
+#include "BoardTable.h"
+#include "BoardTableData.h"
+
+
+uint16_t BoardTable::getStartState() {
+	return BOARD_START_STATE;
+}
+
+uint16_t BoardTable::getNextState(uint16_t state, RouteCommand command) {
+	if (state >= BOARD_STATE_COUNT) {
+		return BOARD_NO_STATE;
+	}
+	return pgm_read_word(&BOARD_STATES[state].next[command]);
+}
+
+uint8_t BoardTable::getMove(uint16_t state, RouteCommand command) {
+	if (state >= BOARD_STATE_COUNT) {
+		return 0;
+	}
+	return pgm_read_byte(&BOARD_STATES[state].move[command]);
+}
+
+bool BoardTable::getIfToken(uint8_t intersection, int round) {
+	if (intersection >= BOARD_INTERSECTION_COUNT || round < 1 || round > 8) {
+		return false;
+	}
+	// bit (round - 1) is set if the intersection has a token that round
+	return (pgm_read_byte(&BOARD_TOKEN_ROUNDS[intersection]) >> (round - 1)) & 1;
+}
+
+uint8_t BoardTable::getPredecessorCount(uint16_t state) {
+	if (state >= BOARD_STATE_COUNT) {
+		return 0;
+	}
+	return pgm_read_word(&BOARD_PREDECESSOR_START[state + 1]) - pgm_read_word(&BOARD_PREDECESSOR_START[state]);
+}
+
+uint16_t BoardTable::getPredecessor(uint16_t state, uint8_t index, RouteCommand& command) {
+	uint16_t entry = pgm_read_word(&BOARD_PREDECESSORS[pgm_read_word(&BOARD_PREDECESSOR_START[state]) + index]);
+	command = RouteCommand(entry % ROUTE_COMMAND_COUNT);
+	return entry / ROUTE_COMMAND_COUNT;
+}
+
+uint8_t BoardTable::findIntersection(String name) {
+	for (uint8_t i = 0; i < BOARD_INTERSECTION_COUNT; i++) {
+		if (strcmp_P(name.c_str(), BOARD_INTERSECTION_NAMES[i]) == 0) {
+			return i;
+		}
+	}
+	return BOARD_NO_INTERSECTION;
+}
+
+size_t BoardTable::formatIntersectionName(uint8_t intersection, char* buffer, size_t length) {
+	if (length == 0) {
+		return 0;
+	}
+	buffer[0] = '\0';
+	if (intersection < BOARD_INTERSECTION_COUNT) {
+		strncpy_P(buffer, BOARD_INTERSECTION_NAMES[intersection], length);
+		buffer[length - 1] = '\0';
+	}
+	return strlen(buffer);
+}
+
+size_t BoardTable::formatStateName(uint16_t state, char* buffer, size_t length) {
+	uint8_t slot = state % BOARD_STATES_PER_INTERSECTION;
+	char name[BOARD_STATE_NAME_LENGTH] = { char('A' + slot / 2), '[', (slot % 2) ? 'F' : 'T', ']', '\0' };
+	if (length == 0) {
+		return 0;
+	}
+	strncpy(buffer, name, length);
+	buffer[length - 1] = '\0';
+	return strlen(buffer);
+}
+
+String BoardTable::getIntersectionName(uint8_t intersection) {
+	char buffer[BOARD_NAME_LENGTH];
+	formatIntersectionName(intersection, buffer, BOARD_NAME_LENGTH);
+	return buffer;
+}
+
+String BoardTable::getStateName(uint16_t state) {
+	char buffer[BOARD_STATE_NAME_LENGTH];
+	formatStateName(state, buffer, BOARD_STATE_NAME_LENGTH);
+	return buffer;
+}
@@ -0,0 +1,55 @@
+#ifndef BOARDTABLE_H
+#define BOARDTABLE_H
+
+#include "Arduino.h"
+#include "Movement.h"
+
+using namespace moveOptions;
+
+/*
+Flash-resident version of the Gameboard state graph.
+State ids match Gameboard::getState(id): intersection index * BOARD_STATES_PER_INTERSECTION + slot,
+with slots in order A To, A From, B To, B From, ... D From.
+The data itself lives in BoardTableData.h, which is generated by BoardTable_Generator
+(navigation-test/board_table_gen.cpp) from the Gameboard pointer graph.
+*/
+
+#define BOARD_INTERSECTION_COUNT 56
+#define BOARD_STATES_PER_INTERSECTION 8
+#define BOARD_STATE_COUNT (BOARD_INTERSECTION_COUNT * BOARD_STATES_PER_INTERSECTION)
+#define BOARD_NAME_LENGTH 24 // longest intersection name + terminator
+#define BOARD_STATE_NAME_LENGTH 5 // "A[T]" + terminator
+#define BOARD_NO_STATE 0xFFFF
+#define BOARD_NO_INTERSECTION 0xFF
+
+// the four moves Navigation can make from a state; also used as table columns
+enum RouteCommand { CommandLeft = 0, CommandRight = 1, CommandForward = 2, CommandBackward = 3 };
+#define ROUTE_COMMAND_COUNT 4
+
+struct BoardStateEntry {
+	uint16_t next[ROUTE_COMMAND_COUNT]; // resulting state per RouteCommand, BOARD_NO_STATE if not possible
+	uint8_t move[ROUTE_COMMAND_COUNT];  // Turn for left/right, Approach for forward, BackwardApproach for backward
+};
+
+
+class BoardTable
+{
+public:
+	static uint16_t getStartState();
+	static uint16_t getNextState(uint16_t state, RouteCommand command);
+	static uint8_t getMove(uint16_t state, RouteCommand command);
+	static uint8_t getIntersection(uint16_t state) { return state / BOARD_STATES_PER_INTERSECTION; };
+	static bool getIfToken(uint8_t intersection, int round);
+	// moves into a state, for searching backward from a target
+	static uint8_t getPredecessorCount(uint16_t state);
+	static uint16_t getPredecessor(uint16_t state, uint8_t index, RouteCommand& command); // state the move starts from
+	// names, read from flash; the format functions truncate to fit and return the length written
+	static uint8_t findIntersection(String name);
+	static size_t formatIntersectionName(uint8_t intersection, char* buffer, size_t length);
+	static size_t formatStateName(uint16_t state, char* buffer, size_t length);
+	static String getIntersectionName(uint8_t intersection);
+	static String getStateName(uint16_t state); // "A[T]", "B[F]", ...
+};
+
+
+#endif
@@ -11,69 +11,84 @@ Gameboard::Gameboard(int round_n, Movement* move)
 
 void Gameboard::initializeBoard() {
 	// creating middle drop token intersections
-	IntersectionDropToken* dropMiddleand0 = new IntersectionDropToken(movement, "Middle drop and  0deg");
-	IntersectionDropToken* dropMiddleand45 = new IntersectionDropToken(movement, "Middle drop and  45deg");
-	IntersectionDropToken* dropMiddleand135 = new IntersectionDropToken(movement, "Middle drop and  135deg");
-	IntersectionDropToken* dropMiddleand180 = new IntersectionDropToken(movement, "Middle drop and  180deg");
-	IntersectionDropToken* dropMiddleand225 = new IntersectionDropToken(movement, "Middle drop and  225deg");
-	IntersectionDropToken* dropMiddleand315 = new IntersectionDropToken(movement, "Middle drop and  315deg");
+	IntersectionDropToken* dropMiddleand0 = new IntersectionDropToken(movement, PSTR("Middle drop and  0deg"));
+	IntersectionDropToken* dropMiddleand45 = new IntersectionDropToken(movement, PSTR("Middle drop and  45deg"));
+	IntersectionDropToken* dropMiddleand135 = new IntersectionDropToken(movement, PSTR("Middle drop and  135deg"));
+	IntersectionDropToken* dropMiddleand180 = new IntersectionDropToken(movement, PSTR("Middle drop and  180deg"));
+	IntersectionDropToken* dropMiddleand225 = new IntersectionDropToken(movement, PSTR("Middle drop and  225deg"));
+	IntersectionDropToken* dropMiddleand315 = new IntersectionDropToken(movement, PSTR("Middle drop and  315deg"));
 	// creating intersections for 1-foot square
-	IntersectionIV* at1and0 = new IntersectionIV(movement, "1ft and 0deg");
-	IntersectionIII* at1and45 = new IntersectionIII(movement, "1ft and 45deg");
-	IntersectionIII* at1and135 = new IntersectionIII(movement, "1ft and 135deg");
-	IntersectionIV* at1and180 = new IntersectionIV(movement, "1ft and 180deg");
-	IntersectionIII* at1and225 = new IntersectionIII(movement, "1ft and 225deg");
-	IntersectionIII* at1and315 = new IntersectionIII(movement, "1ft and 315deg");
+	IntersectionIV* at1and0 = new IntersectionIV(movement, PSTR("1ft and 0deg"));
+	IntersectionIII* at1and45 = new IntersectionIII(movement, PSTR("1ft and 45deg"));
+	IntersectionIII* at1and135 = new IntersectionIII(movement, PSTR("1ft and 135deg"));
+	IntersectionIV* at1and180 = new IntersectionIV(movement, PSTR("1ft and 180deg"));
+	IntersectionIII* at1and225 = new IntersectionIII(movement, PSTR("1ft and 225deg"));
+	IntersectionIII* at1and315 = new IntersectionIII(movement, PSTR("1ft and 315deg"));
 	// creating intersections for 2-foot square
-	IntersectionII* at2and0 = new IntersectionII(movement, "2ft and 0deg");
-	IntersectionI* at2and45 = new IntersectionI(movement, "2ft and 45deg");
-	IntersectionI* at2and135 = new IntersectionI(movement, "2ft and 135deg");
-	IntersectionII* at2and180 = new IntersectionII(movement, "2ft and 180deg");
-	IntersectionI* at2and225 = new IntersectionI(movement, "2ft and 225deg");
-	IntersectionI* at2and315 = new IntersectionI(movement, "2ft and 315deg");
+	IntersectionII* at2and0 = new IntersectionII(movement, PSTR("2ft and 0deg"));
+	IntersectionI* at2and45 = new IntersectionI(movement, PSTR("2ft and 45deg"));
+	IntersectionI* at2and135 = new IntersectionI(movement, PSTR("2ft and 135deg"));
+	IntersectionII* at2and180 = new IntersectionII(movement, PSTR("2ft and 180deg"));
+	IntersectionI* at2and225 = new IntersectionI(movement, PSTR("2ft and 225deg"));
+	IntersectionI* at2and315 = new IntersectionI(movement, PSTR("2ft and 315deg"));
 	// creating intersections for 3-foot squate
-	IntersectionII* at3and0 = new IntersectionII(movement, "3ft and 0deg");
-	IntersectionI* at3and45 = new IntersectionI(movement, "3ft and 45deg");
-	IntersectionI* at3and135 = new IntersectionI(movement, "3ft and 135deg");
-	IntersectionII* at3and180 = new IntersectionII(movement, "3ft and 180deg");
-	IntersectionI* at3and225 = new IntersectionI(movement, "3ft and 225deg");
-	IntersectionI* at3and315 = new IntersectionI(movement, "3ft and 315deg");
+	IntersectionII* at3and0 = new IntersectionII(movement, PSTR("3ft and 0deg"));
+	IntersectionI* at3and45 = new IntersectionI(movement, PSTR("3ft and 45deg"));
+	IntersectionI* at3and135 = new IntersectionI(movement, PSTR("3ft and 135deg"));
+	IntersectionII* at3and180 = new IntersectionII(movement, PSTR("3ft and 180deg"));
+	IntersectionI* at3and225 = new IntersectionI(movement, PSTR("3ft and 225deg"));
+	IntersectionI* at3and315 = new IntersectionI(movement, PSTR("3ft and 315deg"));
 	// creating intersections for 4-foot square
-	IntersectionII* at4and0 = new IntersectionII(movement, "4ft and 0deg");
-	IntersectionI* at4and45 = new IntersectionI(movement, "4ft and 45deg");
-	IntersectionV* at4and90 = new IntersectionV(movement, "4ft and 90deg");
-	IntersectionI* at4and135 = new IntersectionI(movement, "4ft and 135deg");
-	IntersectionII* at4and180 = new IntersectionII(movement, "4ft and 180deg");
-	IntersectionI* at4and225 = new IntersectionI(movement, "4ft and 225deg");
-	IntersectionV* at4and270 = new IntersectionV(movement, "4ft and 270deg");
-	IntersectionI* at4and315 = new IntersectionI(movement, "4ft and 315deg");
+	IntersectionII* at4and0 = new IntersectionII(movement, PSTR("4ft and 0deg"));
+	IntersectionI* at4and45 = new IntersectionI(movement, PSTR("4ft and 45deg"));
+	IntersectionV* at4and90 = new IntersectionV(movement, PSTR("4ft and 90deg"));
+	IntersectionI* at4and135 = new IntersectionI(movement, PSTR("4ft and 135deg"));
+	IntersectionII* at4and180 = new IntersectionII(movement, PSTR("4ft and 180deg"));
+	IntersectionI* at4and225 = new IntersectionI(movement, PSTR("4ft and 225deg"));
+	IntersectionV* at4and270 = new IntersectionV(movement, PSTR("4ft and 270deg"));
+	IntersectionI* at4and315 = new IntersectionI(movement, PSTR("4ft and 315deg"));
 	// creating intersections for 5-foot square
-	IntersectionII* at5and0 = new IntersectionII(movement, "5ft and 0deg");
-	IntersectionI* at5and45 = new IntersectionI(movement, "5ft and 45deg");
-	IntersectionV* at5and90 = new IntersectionV(movement, "5ft and 90deg");
-	IntersectionI* at5and135 = new IntersectionI(movement, "5ft and 135deg");
-	IntersectionII* at5and180 = new IntersectionII(movement, "5ft and 180deg");
-	IntersectionI* at5and225 = new IntersectionI(movement, "5ft and 225deg");
-	IntersectionV* at5and270 = new IntersectionV(movement, "5ft and 270deg");
-	IntersectionI* at5and315 = new IntersectionI(movement, "5ft and 315deg");
+	IntersectionII* at5and0 = new IntersectionII(movement, PSTR("5ft and 0deg"));
+	IntersectionI* at5and45 = new IntersectionI(movement, PSTR("5ft and 45deg"));
+	IntersectionV* at5and90 = new IntersectionV(movement, PSTR("5ft and 90deg"));
+	IntersectionI* at5and135 = new IntersectionI(movement, PSTR("5ft and 135deg"));
+	IntersectionII* at5and180 = new IntersectionII(movement, PSTR("5ft and 180deg"));
+	IntersectionI* at5and225 = new IntersectionI(movement, PSTR("5ft and 225deg"));
+	IntersectionV* at5and270 = new IntersectionV(movement, PSTR("5ft and 270deg"));
+	IntersectionI* at5and315 = new IntersectionI(movement, PSTR("5ft and 315deg"));
 	// creating intersections for outer squares
-	IntersectionIV* atOuterand0 = new IntersectionIV(movement, "Outer and 0deg");
-	IntersectionIII* atOuterand45 = new IntersectionIII(movement, "Outer and 45deg");
-	IntersectionV* atOuterand90 = new IntersectionV(movement, "Outer and 90deg");
-	IntersectionIII* atOuterand135 = new IntersectionIII(movement, "Outer and 135deg");
-	IntersectionIV* atOuterand180 = new IntersectionIV(movement, "Outer and 180deg");
-	IntersectionIII* atOuterand225 = new IntersectionIII(movement, "Outer and 225deg");
-	IntersectionV* atOuterand270 = new IntersectionV(movement, "Outer and 270deg");
-	IntersectionIII* atOuterand315 = new IntersectionIII(movement, "Outer and 315deg");
+	IntersectionIV* atOuterand0 = new IntersectionIV(movement, PSTR("Outer and 0deg"));
+	IntersectionIII* atOuterand45 = new IntersectionIII(movement, PSTR("Outer and 45deg"));
+	IntersectionV* atOuterand90 = new IntersectionV(movement, PSTR("Outer and 90deg"));
+	IntersectionIII* atOuterand135 = new IntersectionIII(movement, PSTR("Outer and 135deg"));
+	IntersectionIV* atOuterand180 = new IntersectionIV(movement, PSTR("Outer and 180deg"));
+	IntersectionIII* atOuterand225 = new IntersectionIII(movement, PSTR("Outer and 225deg"));
+	IntersectionV* atOuterand270 = new IntersectionV(movement, PSTR("Outer and 270deg"));
+	IntersectionIII* atOuterand315 = new IntersectionIII(movement, PSTR("Outer and 315deg"));
 	// creating drop token + start intersections for outer squares
-	IntersectionDropToken* dropOuterand0 = new IntersectionDropToken(movement, "Outer drop and 0deg");
-	IntersectionDropToken* dropOuterand45 = new IntersectionDropToken(movement, "Outer drop and 45deg");
-	IntersectionStart* dropOuterand90 = new IntersectionStart(movement, "Start and 90deg");
-	IntersectionDropToken* dropOuterand135 = new IntersectionDropToken(movement, "Outer drop and 135deg");
-	IntersectionDropToken* dropOuterand180 = new IntersectionDropToken(movement, "Outer drop and 180deg");
-	IntersectionDropToken* dropOuterand225 = new IntersectionDropToken(movement, "Outer drop and 225deg");
-	IntersectionStart* dropOuterand270 = new IntersectionStart(movement, "Start and 270deg");
-	IntersectionDropToken* dropOuterand315 = new IntersectionDropToken(movement, "Outer drop and 315deg");
+	IntersectionDropToken* dropOuterand0 = new IntersectionDropToken(movement, PSTR("Outer drop and 0deg"));
+	IntersectionDropToken* dropOuterand45 = new IntersectionDropToken(movement, PSTR("Outer drop and 45deg"));
+	IntersectionStart* dropOuterand90 = new IntersectionStart(movement, PSTR("Start and 90deg"));
+	IntersectionDropToken* dropOuterand135 = new IntersectionDropToken(movement, PSTR("Outer drop and 135deg"));
+	IntersectionDropToken* dropOuterand180 = new IntersectionDropToken(movement, PSTR("Outer drop and 180deg"));
+	IntersectionDropToken* dropOuterand225 = new IntersectionDropToken(movement, PSTR("Outer drop and 225deg"));
+	IntersectionStart* dropOuterand270 = new IntersectionStart(movement, PSTR("Start and 270deg"));
+	IntersectionDropToken* dropOuterand315 = new IntersectionDropToken(movement, PSTR("Outer drop and 315deg"));
+
+	// register intersections so their states can be looked up by id
+	Intersection* created[] = {
+		dropMiddleand0, dropMiddleand45, dropMiddleand135, dropMiddleand180, dropMiddleand225, dropMiddleand315,
+		at1and0, at1and45, at1and135, at1and180, at1and225, at1and315,
+		at2and0, at2and45, at2and135, at2and180, at2and225, at2and315,
+		at3and0, at3and45, at3and135, at3and180, at3and225, at3and315,
+		at4and0, at4and45, at4and90, at4and135, at4and180, at4and225, at4and270, at4and315,
+		at5and0, at5and45, at5and90, at5and135, at5and180, at5and225, at5and270, at5and315,
+		atOuterand0, atOuterand45, atOuterand90, atOuterand135, atOuterand180, atOuterand225, atOuterand270, atOuterand315,
+		dropOuterand0, dropOuterand45, dropOuterand90, dropOuterand135, dropOuterand180, dropOuterand225, dropOuterand270, dropOuterand315
+	};
+	for (int i = 0; i < GAMEBOARD_INTERSECTION_COUNT; i++) {
+		addIntersection(created[i]);
+	}
 
 	// CONNECTIONS
 
@@ -227,6 +242,45 @@ void Gameboard::initializeBoard() {
 }
 
 
+void Gameboard::addIntersection(Intersection* intersection) {
+	if (intersectionCount >= GAMEBOARD_INTERSECTION_COUNT) {
+		return;
+	}
+	// give each state an id so planners can keep per-state arrays
+	for (int slot = 0; slot < INTERSECTION_STATE_COUNT; slot++) {
+		intersection->getState(slot)->setId(intersectionCount * INTERSECTION_STATE_COUNT + slot);
+	}
+	intersections[intersectionCount++] = intersection;
+}
+
+
+Intersection* Gameboard::getIntersection(int index) {
+	if (index < 0 || index >= intersectionCount) {
+		return nullptr;
+	}
+	return intersections[index];
+}
+
+
+Intersection* Gameboard::findIntersection(String name) {
+	for (int i = 0; i < intersectionCount; i++) {
+		if (intersections[i]->hasName(name.c_str())) {
+			return intersections[i];
+		}
+	}
+	return nullptr;
+}
+
+
+IntersectionState* Gameboard::getState(int id) {
+	Intersection* intersection = getIntersection(id / INTERSECTION_STATE_COUNT);
+	if (!intersection) {
+		return nullptr;
+	}
+	return intersection->getState(id % INTERSECTION_STATE_COUNT);
+}
+
+
 Gameboard::~Gameboard()
 {
 }
@@ -8,17 +8,34 @@
 #include "IntersectionState.h"
 #include "Intersection.h"
 
+/*
+Pointer graph of the board. It is built on the pc to generate BoardTable and to check Navigation against it;
+the sketch navigates with BoardTable instead, so its names and formatting do not affect the board's SRAM.
+*/
+
+// number of intersections created by initializeBoard
+#define GAMEBOARD_INTERSECTION_COUNT 56
+
 class Gameboard
 {
 private:
 	IntersectionState* startState = nullptr;
+	Intersection* intersections[GAMEBOARD_INTERSECTION_COUNT];
+	int intersectionCount = 0;
 	Movement* movement;
 	int round = 1;
 	void initializeBoard();
+	void addIntersection(Intersection* intersection);
 public:
 	Gameboard(int round_n, Movement* move);
 	~Gameboard();
 	IntersectionState* getStartState() { return startState; };
+	// intersection/state lookup; state ids are intersection index * INTERSECTION_STATE_COUNT + slot
+	int getIntersectionCount() { return intersectionCount; };
+	int getStateCount() { return intersectionCount * INTERSECTION_STATE_COUNT; };
+	Intersection* getIntersection(int index);
+	Intersection* findIntersection(String name);
+	IntersectionState* getState(int id);
 };
 
 
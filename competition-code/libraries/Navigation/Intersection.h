@@ -8,6 +8,10 @@
 
 class IntersectionState;
 
+// number of states per intersection (To/From for A, B, C, D)
+#define INTERSECTION_STATE_COUNT 8
+// longest intersection name + terminator
+#define INTERSECTION_NAME_LENGTH 24
 
 struct IntersectionStatePair {
 	IntersectionState* To;
@@ -21,11 +25,11 @@ protected:
 	IntersectionStatePair* stateB;
 	IntersectionStatePair* stateC;
 	IntersectionStatePair* stateD;
-	String intersectName;
-	bool hasToken;
+	PGM_P intersectName; // flash string, pass names in with PSTR
+	bool hasToken = false;
 	Movement* movement;
 public:
-	Intersection(Movement* move, String name);
+	Intersection(Movement* move, PGM_P name);
 	~Intersection();
 
 	enum Direction { To = 0, From = 1 };
@@ -41,55 +45,58 @@ public:
 	void createBackwardConnectionUsingStateC(IntersectionStatePair* dropStateArr) { createBackwardConnection(stateC, dropStateArr); };
 	void createBackwardConnectionUsingStateD(IntersectionStatePair* dropStateArr) { createBackwardConnection(stateD, dropStateArr); };
 	// getters
-	String getName() { return intersectName; };
+	String getName(); // copies the name out of flash, for debugging
+	size_t formatName(char* buffer, size_t length); // returns the length written, truncates to fit
+	bool hasName(const char* name);
 	bool getIfToken() { return hasToken; };
-	bool setIfToken(bool token) { hasToken = token; };
+	void setIfToken(bool token) { hasToken = token; };
 	IntersectionStatePair* getStateA() { return stateA; };
 	IntersectionStatePair* getStateB() { return stateB; };
 	IntersectionStatePair* getStateC() { return stateC; };
 	IntersectionStatePair* getStateD() { return stateD; };
+	IntersectionState* getState(int slot); // slot 0-7 in order A To, A From, B To, ... D From
 };
 
 // Type Start intersection
 class IntersectionStart : public Intersection {
 public:
-	IntersectionStart(Movement* move, String name);
+	IntersectionStart(Movement* move, PGM_P name);
 };
 
 // Type I intersection
 class IntersectionI : public Intersection {
 public:
-	IntersectionI(Movement* move, String name);
+	IntersectionI(Movement* move, PGM_P name);
 };
 
 // Type II intersection
 class IntersectionII : public Intersection {
 public:
-	IntersectionII(Movement* move, String name);
+	IntersectionII(Movement* move, PGM_P name);
 };
 
 // Type III intersection
 class IntersectionIII : public Intersection {
 public:
-	IntersectionIII(Movement* move, String name);
+	IntersectionIII(Movement* move, PGM_P name);
 };
 
 // Type IV intersection
 class IntersectionIV : public Intersection {
 public:
-	IntersectionIV(Movement* move, String name);
+	IntersectionIV(Movement* move, PGM_P name);
 };
 
 // Type V intersection
 class IntersectionV : public Intersection {
 public:
-	IntersectionV(Movement* move, String name);
+	IntersectionV(Movement* move, PGM_P name);
 };
 
 // Type DropToken intersection
 class IntersectionDropToken : public Intersection {
 public:
-	IntersectionDropToken(Movement* move, String name);
+	IntersectionDropToken(Movement* move, PGM_P name);
 };
 
 
@@ -1,9 +1,9 @@
 #include "IntersectionState.h"
 
 
-IntersectionState::IntersectionState(Movement* move, Intersection* intersection, String name)
+IntersectionState::IntersectionState(Movement* move, Intersection* intersection, uint8_t stateSlot)
 {
-	movement = move; container = intersection; stateName = name;
+	movement = move; container = intersection; slot = stateSlot;
 }
 
 void IntersectionState::connectTo(IntersectionState& state) {
@@ -50,8 +50,45 @@ IntersectionState* IntersectionState::performBackwardApproach() {
 }
 
 
-String IntersectionState::getFullName() {
-	return "Intersection |" + container->getName() + "| in state " + getName();
+// copies a flash string to buffer + written as far as it fits, returns the new length
+static size_t appendFlashString(char* buffer, size_t written, size_t length, PGM_P text) {
+	if (written + 1 >= length) {
+		return written;
+	}
+	strncpy_P(buffer + written, text, length - written);
+	buffer[length - 1] = '\0';
+	return written + strlen(buffer + written);
+}
+
+String IntersectionState::getName() {
+	char buffer[INTERSECTION_STATE_NAME_LENGTH];
+	formatName(buffer, sizeof(buffer));
+	return buffer;
+}
+
+size_t IntersectionState::formatName(char* buffer, size_t length) {
+	char name[INTERSECTION_STATE_NAME_LENGTH] = { char('A' + slot / 2), '[', (slot % 2) ? 'F' : 'T', ']', '\0' };
+	if (length == 0) {
+		return 0;
+	}
+	strncpy(buffer, name, length);
+	buffer[length - 1] = '\0';
+	return strlen(buffer);
+}
+
+size_t IntersectionState::formatFullName(char* buffer, size_t length) {
+	if (length == 0) {
+		return 0;
+	}
+	// "Intersection |" + intersection name + "| in state " + state name, truncated to fit
+	buffer[0] = '\0';
+	size_t written = appendFlashString(buffer, 0, length, PSTR("Intersection |"));
+	if (container) {
+		written += container->formatName(buffer + written, length - written);
+	}
+	written = appendFlashString(buffer, written, length, PSTR("| in state "));
+	written += formatName(buffer + written, length - written);
+	return written;
 }
 
 IntersectionState* IntersectionState::turnLeft() {
@@ -96,6 +133,50 @@ IntersectionState* IntersectionState::goBackward() {
 }
 
 
+IntersectionState* IntersectionState::peekForward() {
+	// same checks as goForward + performApproach, without moving
+	if (!connectedState || !connectedState->approachEnum) {
+		return nullptr;
+	}
+	if (connectedState->transitionState) {
+		return connectedState->transitionState;
+	}
+	return connectedState;
+}
+
+
+IntersectionState* IntersectionState::peekBackward() {
+	// same checks as goBackward + performBackwardApproach, without moving
+	if (!backwardState || !backwardState->backwardConnectedState) {
+		return nullptr;
+	}
+	IntersectionState* approachState = backwardState->backwardConnectedState;
+	if (!approachState->backwardApproachEnum) {
+		return nullptr;
+	}
+	if (approachState->backwardTransitionState) {
+		return approachState->backwardTransitionState;
+	}
+	return approachState;
+}
+
+
+Approach IntersectionState::getForwardApproach() {
+	if (!connectedState) {
+		return NoApproach;
+	}
+	return connectedState->approachEnum;
+}
+
+
+BackwardApproach IntersectionState::getBackwardApproach() {
+	if (!backwardState || !backwardState->backwardConnectedState) {
+		return NoBackwardApproach;
+	}
+	return backwardState->backwardConnectedState->backwardApproachEnum;
+}
+
+
 IntersectionState::~IntersectionState()
 {
 }
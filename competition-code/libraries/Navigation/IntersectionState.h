@@ -7,6 +7,9 @@
 
 using namespace moveOptions;
 
+// "A[T]" + terminator
+#define INTERSECTION_STATE_NAME_LENGTH 5
+
 
 class Intersection;
 
@@ -16,11 +19,12 @@ class IntersectionState
 {
 private:
 	Movement* movement;
-	String stateName;
+	uint8_t slot = 0; // position within the container, 0-7 in order A To, A From, B To, ... D From
+	uint16_t stateId = 0; // index into the gameboard's state list, set by Gameboard
 	Turn leftTurnEnum;
 	Turn rightTurnEnum;
-	Approach approachEnum;
-	BackwardApproach backwardApproachEnum;
+	Approach approachEnum = NoApproach;
+	BackwardApproach backwardApproachEnum = NoBackwardApproach;
 	IntersectionState* leftState = nullptr;
 	IntersectionState* rightState = nullptr;
 	IntersectionState* transitionState = nullptr;
@@ -31,7 +35,7 @@ protected:
 	
 public:
 	IntersectionState() {};
-	IntersectionState(Movement* move, Intersection* intersection, String name);
+	IntersectionState(Movement* move, Intersection* intersection, uint8_t stateSlot);
 	// setters
 	void setLeftTurn(Turn enumVal, IntersectionState* state) { leftTurnEnum = enumVal; leftState = state; };
 	void setRightTurn(Turn enumVal, IntersectionState* state) { rightTurnEnum = enumVal; rightState = state; };
@@ -41,10 +45,25 @@ public:
 	void setApproach(Approach enumVal) { approachEnum = enumVal; };
 	void setBackwardApproach(BackwardApproach enumVal) { backwardApproachEnum = enumVal; };
 	void setContainer(Intersection* intersection) { container = intersection; };
+	void setId(uint16_t id) { stateId = id; };
 	// getters
-	String getName() { return stateName; };
-	String getFullName();
+	// names are formatted on request from the slot and the container's flash name (host side, see Gameboard.h)
+	String getName(); // "A[T]", "B[F]", ...
+	size_t formatName(char* buffer, size_t length);
+	size_t formatFullName(char* buffer, size_t length); // "Intersection |1ft and 0deg| in state A[T]"
+	uint8_t getSlot() { return slot; };
 	IntersectionState* getSelf() { return this; };
+	Intersection* getContainer() { return container; };
+	uint16_t getId() { return stateId; };
+	// look-ahead getters; these report where a move would end up without performing it
+	IntersectionState* getLeftState() { return leftState; };
+	IntersectionState* getRightState() { return rightState; };
+	Turn getLeftTurn() { return leftTurnEnum; };
+	Turn getRightTurn() { return rightTurnEnum; };
+	IntersectionState* peekForward();
+	IntersectionState* peekBackward();
+	Approach getForwardApproach();
+	BackwardApproach getBackwardApproach();
 	// other functions
 	IntersectionState* connectedState = nullptr;
 	IntersectionState* backwardConnectedState = nullptr;
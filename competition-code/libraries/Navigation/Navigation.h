@@ -4,27 +4,66 @@
 
 #include "Arduino.h"
 #include "Movement.h"
-#include "Gameboard.h"
+#include "BoardTable.h"
+#include "RoutePlanner.h"
+#include "RouteTable.h"
+#include "IncrementalPlanner.h"
 
 using namespace std;
 
-class Gameboard;
+// the searches (RoutePlanner, IncrementalPlanner) take several KB of SRAM, more than the Uno's 2 KB; on the
+// board routes come only from the flash RouteTable, which covers every state reachable from the start
+#if !defined(__AVR__)
+#define NAVIGATION_PLANNERS
+#endif
+
+#define NAVIGATION_MAX_BLOCKED 8 // blocked moves Navigation remembers
 
+// walks the flash-resident BoardTable by state id; the Gameboard pointer graph is only used to generate it
 class Navigation
 {
 private:
-	IntersectionState* currentState = nullptr;
-	Gameboard* gameboard;
+	uint16_t currentState = BOARD_NO_STATE;
+	int round = 1;
 	Movement* movement;
+	RoutePlanner* planner = nullptr; // created on first planRoute call
+	IncrementalPlanner* replanner = nullptr; // created on first replanRoute call
+	uint16_t blockedMoves[NAVIGATION_MAX_BLOCKED]; // state * ROUTE_COMMAND_COUNT + command
+	uint8_t blockedCount = 0;
+	bool move(RouteCommand command);
+	void copyFrom(const Navigation& other);
 public:
 	Navigation() {};
 	Navigation(int round_n, Movement& move);
+	// copies the position; the planners are not shared, each Navigation creates its own when needed
+	Navigation(const Navigation& other);
+	Navigation& operator=(const Navigation& other);
 	~Navigation();
-	bool turnLeft();
-	bool turnRight();
-	bool goForward();
-	bool goBackward();
+	bool turnLeft() { return move(CommandLeft); };
+	bool turnRight() { return move(CommandRight); };
+	bool goForward() { return move(CommandForward); };
+	bool goBackward() { return move(CommandBackward); };
 	String getCurrentStateInfo();
+	uint16_t getCurrentState() { return currentState; };
+	bool getIfToken(uint8_t intersection) { return BoardTable::getIfToken(intersection, round); };
+	// route planning from the current state; does not move the robot
+	bool planRoute(uint8_t target, Route& route); // searches the board; only with NAVIGATION_PLANNERS
+	bool planRoute(String targetName, Route& route);
+	bool lookupRoute(uint8_t target, Route& route); // reads the precomputed RouteTable, falls back to planRoute
+	                                                // (or replanRoute once a move has been blocked)
+	bool lookupRoute(String targetName, Route& route);
+	// blocked moves: when a move from the current state fails on the board, block it and replan around it;
+	// replanning toward the same target repairs the previous search instead of starting over.
+	// Blocked moves are refused by the turn/go methods and executePlan. blockMove returns false once
+	// NAVIGATION_MAX_BLOCKED moves are blocked. Without NAVIGATION_PLANNERS replanRoute only gives the
+	// table route, and fails if that route uses a blocked move
+	bool blockMove(RouteCommand command);
+	bool getIfBlocked(uint16_t state, RouteCommand command);
+	bool replanRoute(uint8_t target, Route& route);
+	// drives a whole route; runs of forward moves are handed to Movement together so the robot keeps
+	// cruise speed through the intersections in between and only stops before turns, backward moves
+	// and the end of the route. Checks the route first and does not move if it is invalid from here.
+	bool executePlan(Route& route);
 };
 
 
@@ -7,37 +7,41 @@
 
 
 class Navigation17 {
-private:
+public:
     const static int MAX_R = 7;  // r coordinate for drop locations - TODO: verify
 
+private:
     Movement* movement;
     Coordinate current_position;
     Direction facing;
-    Coordinate available_directions[DIRECTION_COUNT];
-    Approach approaches[DIRECTION_COUNT];
 
-    /** call this when arriving somewhere **/
-    void set_available_directions();  // and approaches
+    /** packed move table entry for moving in direction from the current position **/
+    uint16_t get_move(const int& direction);
+    /** follow the move table entry and arrive at the new position **/
+    void move_by(const uint16_t& move);
     /** 1 for left, -1 for right **/
     bool turn(const int& direction);
 public:
     // TODO: starting position and starting facing direction
     Navigation17() : movement(nullptr),
                      current_position(6, 7),
-                     facing(NORTH) {
-        set_available_directions();
-    }
+                     facing(NORTH) {}
     explicit Navigation17(Movement* _movement) : movement(_movement),
                                                  current_position(6, 7),
-                                                 facing(NORTH) {
-        set_available_directions();
-    }
+                                                 facing(NORTH) {}
+
+    /** step (t mod DIRECTION_COUNT, r) taken moving in direction from position, (0, 0) if not available **/
+    static Coordinate getStep(const Coordinate& position, const Direction& direction);
+    /** approach used moving in direction from position **/
+    static Approach getApproach(const Coordinate& position, const Direction& direction);
 
     bool turnLeft();
     bool turnRight();
     bool goForward();
     bool goBackward();
 
+    Coordinate getPosition() { return current_position; }
+    Direction getFacing() { return facing; }
     String getCurrentStateInfo();
 };
 
@@ -0,0 +1,250 @@
+#include "RoutePlanner.h"
+
+using namespace moveOptions;
+
+// cost tables indexed by enum value, in tenths of a second; estimates that can be replaced at run time
+static uint8_t TURN_COSTS[] = {
+	0,      // no turn
+	5, 5,   // Left45, Right45
+	8, 8,   // Left90, Right90
+	11, 11, // Left135, Right135
+	14, 14  // Left180, Right180
+};
+static uint8_t APPROACH_COSTS[] = {
+	0,      // NoApproach
+	15,     // NoFollowUntilPerpendicularLine
+	15,     // FollowUntilPerpendicularLine
+	12,     // FollowUntilTokenSlot
+	16, 16, // FollowOnLeft/RightUntilPerpendicularLine
+	18, 18, // FollowOnLeft/RightUntilCrossesLine
+	15,     // FollowUntilCrossingY
+	15,     // FollowUntilSeparatingY
+	10,     // MoveIntoStart
+	8       // MoveIntoDropPosition
+};
+static uint8_t BACKWARD_APPROACH_COSTS[] = {
+	0,      // NoBackwardApproach
+	8,      // BackwardLeaveDropPosition
+	16,     // BackwardFollowUntilCrossingY
+	16,     // BackwardFollowUntilSeparatingY
+	16      // BackwardFollowUntilPerpendicularLine
+};
+
+
+// Route
+
+bool Route::addCommand(RouteCommand command) {
+	if (length >= ROUTE_MAX_COMMANDS) {
+		return false;
+	}
+	setCommand(length, command);
+	length++;
+	return true;
+}
+
+void Route::setCommand(uint8_t index, RouteCommand command) {
+	uint8_t shift = (index % 4) * 2;
+	commands[index / 4] = (commands[index / 4] & ~(0x03 << shift)) | (command << shift);
+}
+
+RouteCommand Route::getCommand(uint8_t index) {
+	return RouteCommand((commands[index / 4] >> ((index % 4) * 2)) & 0x03);
+}
+
+String Route::toString() {
+	const char letters[] = { 'l', 'r', 'f', 'b' };
+	String result = "";
+	for (uint8_t i = 0; i < length; i++) {
+		result += letters[getCommand(i)];
+	}
+	return result;
+}
+
+
+// RoutePlanner
+
+RoutePlanner::RoutePlanner()
+{
+	// about 4 KB; on the Arduino new gives 0 when it does not fit, and the planner then plans nothing
+	dist = new uint16_t[BOARD_STATE_COUNT];
+	prevState = new uint16_t[BOARD_STATE_COUNT];
+	prevCommand = new uint8_t[BOARD_STATE_COUNT];
+	heap = new uint16_t[BOARD_STATE_COUNT];
+	heapPos = new uint16_t[BOARD_STATE_COUNT];
+	if (!dist || !prevState || !prevCommand || !heap || !heapPos) {
+		release();
+	}
+}
+
+
+RoutePlanner::~RoutePlanner()
+{
+	release();
+}
+
+
+void RoutePlanner::release() {
+	delete[] dist;
+	delete[] prevState;
+	delete[] prevCommand;
+	delete[] heap;
+	delete[] heapPos;
+	dist = prevState = heap = heapPos = nullptr;
+	prevCommand = nullptr;
+}
+
+
+uint8_t RoutePlanner::getTurnCost(Turn turn) {
+	return TURN_COSTS[turn];
+}
+
+uint8_t RoutePlanner::getApproachCost(Approach approach) {
+	return APPROACH_COSTS[approach];
+}
+
+uint8_t RoutePlanner::getBackwardApproachCost(BackwardApproach approach) {
+	return BACKWARD_APPROACH_COSTS[approach];
+}
+
+void RoutePlanner::setTurnCost(Turn turn, uint8_t cost) {
+	TURN_COSTS[turn] = cost;
+}
+
+void RoutePlanner::setApproachCost(Approach approach, uint8_t cost) {
+	APPROACH_COSTS[approach] = cost;
+}
+
+void RoutePlanner::setBackwardApproachCost(BackwardApproach approach, uint8_t cost) {
+	BACKWARD_APPROACH_COSTS[approach] = cost;
+}
+
+uint8_t RoutePlanner::getMoveCost(uint16_t state, RouteCommand command) {
+	uint8_t move = BoardTable::getMove(state, command);
+	switch (command) {
+	case CommandLeft:
+	case CommandRight:
+		return getTurnCost(Turn(move));
+	case CommandForward:
+		return getApproachCost(Approach(move));
+	default:
+		return getBackwardApproachCost(BackwardApproach(move));
+	}
+}
+
+
+bool RoutePlanner::planRoute(uint16_t start, uint8_t target, Route& route) {
+	route.clear();
+	expanded = 0;
+	if (!getIfAllocated() || start >= BOARD_STATE_COUNT || target >= BOARD_INTERSECTION_COUNT) {
+		return false;
+	}
+	// reset search data
+	for (uint16_t i = 0; i < BOARD_STATE_COUNT; i++) {
+		dist[i] = ROUTE_UNREACHED;
+		heapPos[i] = ROUTE_UNREACHED;
+	}
+	heapSize = 0;
+	dist[start] = 0;
+	heapPush(start);
+
+	while (heapSize > 0) {
+		uint16_t id = heapPop();
+		expanded++;
+		// reached the target intersection; walk back through prev to build the route
+		if (BoardTable::getIntersection(id) == target) {
+			uint8_t len = 0;
+			for (uint16_t s = id; s != start; s = prevState[s]) {
+				len++;
+			}
+			if (len > ROUTE_MAX_COMMANDS) {
+				return false;
+			}
+			route.setLength(len);
+			for (uint16_t s = id; s != start; s = prevState[s]) {
+				route.setCommand(--len, RouteCommand(prevCommand[s]));
+			}
+			route.setCost(dist[id]);
+			return true;
+		}
+		// expand the four moves Navigation can make
+		for (uint8_t c = 0; c < ROUTE_COMMAND_COUNT; c++) {
+			uint16_t next = BoardTable::getNextState(id, RouteCommand(c));
+			if (next != BOARD_NO_STATE) {
+				relax(id, next, RouteCommand(c), getMoveCost(id, RouteCommand(c)));
+			}
+		}
+	}
+	// target cannot be reached from start
+	return false;
+}
+
+
+void RoutePlanner::relax(uint16_t from, uint16_t toId, RouteCommand command, uint16_t edgeCost) {
+	uint16_t newDist = dist[from] + edgeCost;
+	if (newDist >= dist[toId]) {
+		return;
+	}
+	dist[toId] = newDist;
+	prevState[toId] = from;
+	prevCommand[toId] = command;
+	if (heapPos[toId] == ROUTE_UNREACHED) {
+		heapPush(toId);
+	}
+	else {
+		heapDecrease(toId);
+	}
+}
+
+
+// heap helpers
+
+void RoutePlanner::heapSwap(uint16_t a, uint16_t b) {
+	uint16_t tmp = heap[a];
+	heap[a] = heap[b];
+	heap[b] = tmp;
+	heapPos[heap[a]] = a;
+	heapPos[heap[b]] = b;
+}
+
+void RoutePlanner::heapPush(uint16_t id) {
+	heap[heapSize] = id;
+	heapPos[id] = heapSize;
+	heapSize++;
+	heapDecrease(id);
+}
+
+void RoutePlanner::heapDecrease(uint16_t id) {
+	// sift up
+	uint16_t i = heapPos[id];
+	while (i > 0) {
+		uint16_t parent = (i - 1) / 2;
+		if (dist[heap[parent]] <= dist[heap[i]]) {
+			break;
+		}
+		heapSwap(i, parent);
+		i = parent;
+	}
+}
+
+uint16_t RoutePlanner::heapPop() {
+	uint16_t top = heap[0];
+	heapSize--;
+	if (heapSize > 0) {
+		heapSwap(0, heapSize);
+		// sift down
+		uint16_t i = 0;
+		while (true) {
+			uint16_t left = 2 * i + 1;
+			uint16_t right = left + 1;
+			uint16_t smallest = i;
+			if (left < heapSize && dist[heap[left]] < dist[heap[smallest]]) smallest = left;
+			if (right < heapSize && dist[heap[right]] < dist[heap[smallest]]) smallest = right;
+			if (smallest == i) break;
+			heapSwap(i, smallest);
+			i = smallest;
+		}
+	}
+	// popped states are settled; mark them as never re-entering the heap
+	heapPos[top] = ROUTE_UNREACHED - 1;
+	return top;
+}
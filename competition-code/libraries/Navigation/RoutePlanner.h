@@ -0,0 +1,76 @@
+#ifndef ROUTEPLANNER_H
+#define ROUTEPLANNER_H
+
+#include "Arduino.h"
+#include "Movement.h"
+#include "BoardTable.h"
+
+// longest route that can be stored (commands are packed 4 per byte)
+#define ROUTE_MAX_COMMANDS 64
+// distance value for states that have not been reached
+#define ROUTE_UNREACHED 0xFFFF
+
+
+// compact sequence of Navigation commands, 2 bits per command
+class Route
+{
+private:
+	uint8_t commands[ROUTE_MAX_COMMANDS / 4];
+	uint8_t length = 0;
+	uint16_t cost = 0;
+public:
+	Route() {};
+	void clear() { length = 0; cost = 0; };
+	bool addCommand(RouteCommand command);
+	void setCommand(uint8_t index, RouteCommand command);
+	RouteCommand getCommand(uint8_t index);
+	void setLength(uint8_t len) { length = len; };
+	uint8_t getLength() { return length; };
+	void setCost(uint16_t c) { cost = c; };
+	uint16_t getCost() { return cost; };
+	String toString(); // one letter per command, same letters as the serial protocol (l, r, f, b)
+};
+
+
+// Dijkstra search over the BoardTable state graph; its search data takes about 4 KB, more than the
+// Uno's SRAM, so Navigation only uses it on the pc (see NAVIGATION_PLANNERS)
+class RoutePlanner
+{
+private:
+	// per-state search data, indexed by state id
+	uint16_t* dist;
+	uint16_t* prevState;
+	uint8_t* prevCommand;
+	// indexed binary min-heap of state ids keyed by dist
+	uint16_t* heap;
+	uint16_t* heapPos;
+	uint16_t heapSize = 0;
+	uint16_t expanded = 0; // states expanded by the last search
+	void heapPush(uint16_t id);
+	uint16_t heapPop();
+	void heapDecrease(uint16_t id);
+	void heapSwap(uint16_t a, uint16_t b);
+	void relax(uint16_t from, uint16_t to, RouteCommand command, uint16_t edgeCost);
+	void release();
+public:
+	RoutePlanner();
+	~RoutePlanner();
+	bool getIfAllocated() { return dist != nullptr; }; // false if the search data did not fit in memory
+	// fills route with the cheapest command sequence from start to any state of target
+	bool planRoute(uint16_t start, uint8_t target, Route& route);
+	uint16_t getExpandedCount() { return expanded; };
+	// edge costs, in tenths of a second
+	static uint8_t getTurnCost(Turn turn);
+	static uint8_t getApproachCost(Approach approach);
+	static uint8_t getBackwardApproachCost(BackwardApproach approach);
+	static uint8_t getMoveCost(uint16_t state, RouteCommand command); // cost of a BoardTable move
+	// replace the duration estimates, e.g. with times measured on the robot
+	// (RouteTableData.h is generated with the defaults; its routes stay valid but may no longer be the cheapest;
+	// TourPlanner caches drop run costs, see TourPlanner::invalidateCosts)
+	static void setTurnCost(Turn turn, uint8_t cost);
+	static void setApproachCost(Approach approach, uint8_t cost);
+	static void setBackwardApproachCost(BackwardApproach approach, uint8_t cost);
+};
+
+
+#endif
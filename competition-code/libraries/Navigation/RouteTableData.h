@@ -0,0 +1,256 @@
+// generated by RouteTable_Generator (navigation-test/route_table_gen.cpp) - do not edit
+#ifndef ROUTETABLEDATA_H
+#define ROUTETABLEDATA_H
+
+#include "RouteTable.h"
+
+#define ROUTE_TABLE_ROWS 211
+
+// row of ROUTE_TABLE_COMMANDS for each state, ROUTE_TABLE_NO_ROW if the state cannot reach every intersection
+static const uint8_t ROUTE_TABLE_STATE_ROWS[BOARD_STATE_COUNT] PROGMEM = {
+	255, 255,   1, 255, 255, 255, 255, 255, 255, 255,   2, 255, 255, 255, 255, 255,
+	255, 255,   3, 255, 255, 255, 255, 255, 255, 255,   4, 255, 255, 255, 255, 255,
+	255, 255,   5, 255, 255, 255, 255, 255, 255, 255,   6, 255, 255, 255, 255, 255,
+	  7, 255,   8, 255,   9, 255,  10, 255,  11, 255,  12,  13,  14, 255,  15,  16,
+	 17, 255,  18,  19,  20, 255,  21,  22,  23, 255,  24, 255,  25, 255,  26, 255,
+	 27, 255,  28,  29,  30, 255,  31,  32,  33, 255,  34,  35,  36, 255,  37,  38,
+	 39, 255,  40, 255,  41, 255,  42, 255,  43, 255,  44,  45,  46, 255,  47,  48,
+	 49, 255,  50,  51,  52, 255,  53,  54,  55, 255,  56, 255,  57, 255,  58, 255,
+	 59, 255,  60,  61,  62, 255,  63,  64,  65, 255,  66,  67,  68, 255,  69,  70,
+	 71, 255,  72, 255,  73, 255,  74, 255,  75, 255,  76,  77,  78, 255,  79,  80,
+	 81, 255,  82,  83,  84, 255,  85,  86,  87, 255,  88, 255,  89, 255,  90, 255,
+	 91, 255,  92,  93,  94, 255,  95,  96,  97, 255,  98,  99, 100, 255, 101, 102,
+	103, 255, 104, 255, 105, 255, 106, 255, 107, 255, 108, 109, 110, 255, 111, 112,
+	113, 255, 114, 255, 115, 255, 116, 255, 117, 255, 118, 119, 120, 255, 121, 122,
+	123, 255, 124, 255, 125, 255, 126, 255, 127, 255, 128, 129, 130, 255, 131, 132,
+	133, 255, 134, 255, 135, 255, 136, 255, 137, 255, 138, 139, 140, 255, 141, 142,
+	143, 255, 144, 255, 145, 255, 146, 255, 147, 255, 148, 149, 150, 255, 151, 152,
+	153, 255, 154, 255, 155, 255, 156, 255, 157, 255, 158, 159, 160, 255, 161, 162,
+	163, 255, 164, 255, 165, 255, 166, 255, 167, 255, 168, 169, 170, 255, 171, 172,
+	173, 255, 174, 255, 175, 255, 176, 255, 177, 255, 178, 179, 180, 255, 181, 182,
+	  0, 255,   0, 255, 183, 255, 184, 255,   0, 255,   0, 185, 186, 255, 185,   0,
+	187, 255, 188, 255, 189, 255, 190, 255,   0, 255,   0, 191, 192, 255, 191,   0,
+	  0, 255,   0, 255, 193, 255, 194, 255,   0, 255,   0, 195, 196, 255, 195,   0,
+	197, 255, 198, 255, 199, 255, 200, 255,   0, 255,   0, 201, 202, 255, 201,   0,
+	255, 255, 203, 255, 255, 255, 255, 255, 255, 255, 204, 255, 255, 255, 255, 255,
+	205, 255,   0, 255, 255, 255, 255, 255, 255, 255, 206, 255, 255, 255, 255, 255,
+	255, 255, 207, 255, 255, 255, 255, 255, 255, 255, 208, 255, 255, 255, 255, 255,
+	209, 255,   0, 255, 255, 255, 255, 255, 255, 255, 210, 255, 255, 255, 255, 255,
+};
+
+// first command toward each target intersection, 2 bits per target (RouteCommand values)
+static const uint8_t ROUTE_TABLE_COMMANDS[ROUTE_TABLE_ROWS][ROUTE_TABLE_ROW_BYTES] PROGMEM = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+	{ 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+	{ 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+	{ 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+	{ 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+	{ 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+	{ 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },
+	{ 0x00, 0x05, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+	{ 0xA8, 0x85, 0x5A, 0xA9, 0x95, 0x5A, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56 },
+	{ 0x56, 0x40, 0x05, 0xFF, 0xDF, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF },
+	{ 0x81, 0x0A, 0xA8, 0x80, 0x0A, 0xA8, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA },
+	{ 0x01, 0x14, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+	{ 0xA0, 0x02, 0x2A, 0xA0, 0x40, 0x2A, 0x94, 0x0A, 0x94, 0x0A, 0x94, 0x0A, 0x94, 0x0A },
+	{ 0x05, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00 },
+	{ 0x58, 0x01, 0x05, 0xFF, 0x4F, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF },
+	{ 0x56, 0x2A, 0xA5, 0x56, 0x25, 0xA5, 0x42, 0xA5, 0x42, 0xA5, 0x42, 0xA5, 0x42, 0xA5 },
+	{ 0x01, 0x14, 0x40, 0x55, 0x55, 0x55, 0x15, 0x54, 0x15, 0x54, 0x15, 0x55, 0x15, 0x55 },
+	{ 0x05, 0x54, 0x40, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+	{ 0x80, 0x0A, 0xA8, 0x80, 0x00, 0xA9, 0x50, 0x2A, 0x50, 0x2A, 0x50, 0x2A, 0x50, 0x2A },
+	{ 0x15, 0x54, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00 },
+	{ 0x60, 0x01, 0x14, 0xFF, 0xFF, 0xF5, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFD },
+	{ 0x5A, 0xA9, 0x94, 0x5A, 0xA9, 0x94, 0x0A, 0x95, 0x0A, 0x95, 0x0A, 0x95, 0x0A, 0x95 },
+	{ 0x05, 0x50, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x54 },
+	{ 0x15, 0x40, 0x01, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+	{ 0x16, 0x6A, 0xA1, 0x56, 0x6A, 0xA5, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9 },
+	{ 0x80, 0x15, 0x50, 0xFF, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD },
+	{ 0x6A, 0xA0, 0x02, 0x2A, 0xA0, 0x02, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00 },
+	{ 0x54, 0x40, 0x05, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+	{ 0x0A, 0xA8, 0x80, 0x02, 0xA8, 0x90, 0x0A, 0x94, 0x0A, 0x94, 0x02, 0x94, 0x02, 0x94 },
+	{ 0x54, 0x41, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01 },
+	{ 0x01, 0x16, 0x40, 0xFF, 0xFF, 0xD3, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4 },
+	{ 0xA9, 0x95, 0x4A, 0x95, 0x95, 0x4A, 0xA5, 0x42, 0xA5, 0x42, 0xA5, 0x42, 0xA5, 0x42 },
+	{ 0x50, 0x00, 0x05, 0x55, 0x55, 0x55, 0x54, 0x15, 0x54, 0x15, 0x55, 0x15, 0x55, 0x15 },
+	{ 0x40, 0x01, 0x15, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+	{ 0x2A, 0xA0, 0x02, 0x02, 0xA0, 0x42, 0x2A, 0x50, 0x2A, 0x50, 0x2A, 0x50, 0x2A, 0x50 },
+	{ 0x50, 0x05, 0x15, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04 },
+	{ 0x15, 0x58, 0x00, 0xFF, 0xDF, 0x7F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F, 0xFD, 0x5F },
+	{ 0xA5, 0x56, 0x2A, 0xA5, 0x56, 0x2A, 0x95, 0x0A, 0x95, 0x0A, 0x95, 0x0A, 0x95, 0x0A },
+	{ 0x40, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x54, 0x55 },
+	{ 0x00, 0x05, 0x50, 0x00, 0xA5, 0xAA, 0x2A, 0xA4, 0x2A, 0xA4, 0x22, 0x64, 0x22, 0x64 },
+	{ 0xA8, 0x85, 0x0A, 0xA8, 0x95, 0x5A, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56 },
+	{ 0x56, 0xA0, 0xA6, 0x54, 0x50, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01 },
+	{ 0x81, 0x5A, 0xA9, 0x80, 0x0A, 0xA8, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA },
+	{ 0x01, 0x14, 0x40, 0x01, 0xA5, 0xAA, 0x2A, 0xA0, 0x2A, 0xA0, 0x29, 0x60, 0x29, 0x60 },
+	{ 0xA0, 0x02, 0x2A, 0xA0, 0x42, 0x2A, 0x94, 0x0A, 0x94, 0x0A, 0x94, 0x0A, 0x94, 0x0A },
+	{ 0x05, 0x55, 0x51, 0x01, 0x15, 0x50, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54 },
+	{ 0x58, 0xA1, 0x96, 0x50, 0x40, 0x15, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05 },
+	{ 0x56, 0x6A, 0xA5, 0x52, 0x2A, 0xA5, 0x42, 0xA9, 0x42, 0xA9, 0x42, 0xA9, 0x42, 0xA9 },
+	{ 0x01, 0x04, 0x00, 0x01, 0x54, 0x40, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50 },
+	{ 0x05, 0x54, 0x40, 0x05, 0xA4, 0xAA, 0xA5, 0x6A, 0xA5, 0x6A, 0xA5, 0x60, 0xA5, 0x60 },
+	{ 0x80, 0x0A, 0xA8, 0x80, 0x0A, 0xA9, 0x50, 0xAA, 0x50, 0xAA, 0x50, 0xAA, 0x50, 0xAA },
+	{ 0x15, 0x54, 0x55, 0x05, 0x54, 0x40, 0x05, 0x40, 0x05, 0x40, 0x05, 0x40, 0x05, 0x40 },
+	{ 0x60, 0x81, 0x2A, 0x40, 0x01, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15 },
+	{ 0x5A, 0xA9, 0x95, 0x4A, 0xA9, 0x94, 0x0A, 0x95, 0x0A, 0x95, 0x0A, 0x95, 0x0A, 0x95 },
+	{ 0x05, 0x10, 0x00, 0x05, 0x50, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00 },
+	{ 0x15, 0x50, 0x01, 0x14, 0xA0, 0xAA, 0xA5, 0x2A, 0xA5, 0x2A, 0x65, 0x22, 0x65, 0x22 },
+	{ 0x16, 0x2A, 0xA0, 0x16, 0x6A, 0xA5, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9 },
+	{ 0x80, 0x85, 0xAA, 0x01, 0x05, 0x54, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55 },
+	{ 0x6A, 0xA0, 0x56, 0x2A, 0xA0, 0x02, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00 },
+	{ 0x54, 0x40, 0x05, 0x54, 0xA0, 0xAA, 0xA4, 0x2A, 0xA4, 0x2A, 0x64, 0x29, 0x64, 0x29 },
+	{ 0x0A, 0xA8, 0x80, 0x0A, 0xA8, 0x90, 0x0A, 0x94, 0x0A, 0x94, 0x0A, 0x94, 0x0A, 0x94 },
+	{ 0x54, 0x41, 0x55, 0x54, 0x40, 0x05, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01 },
+	{ 0x01, 0x16, 0xAA, 0x01, 0x14, 0x50, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54 },
+	{ 0xA9, 0x95, 0x5A, 0xA9, 0x94, 0x4A, 0xA9, 0x42, 0xA9, 0x42, 0xA9, 0x42, 0xA9, 0x42 },
+	{ 0x50, 0x00, 0x00, 0x50, 0x00, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15 },
+	{ 0x40, 0x01, 0x14, 0x50, 0xA1, 0xAA, 0x2A, 0xA5, 0x2A, 0xA5, 0x20, 0xA5, 0x20, 0xA5 },
+	{ 0x2A, 0xA0, 0x02, 0x2A, 0xA0, 0x42, 0xAA, 0x50, 0xAA, 0x50, 0xAA, 0x50, 0xAA, 0x50 },
+	{ 0x50, 0x55, 0x55, 0x50, 0x01, 0x15, 0x40, 0x05, 0x40, 0x05, 0x40, 0x05, 0x40, 0x05 },
+	{ 0x15, 0xA8, 0xA1, 0x05, 0x50, 0x41, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50 },
+	{ 0xA5, 0x56, 0x6A, 0xA5, 0x52, 0x2A, 0x95, 0x0A, 0x95, 0x0A, 0x95, 0x0A, 0x95, 0x0A },
+	{ 0x40, 0x01, 0x04, 0x40, 0x01, 0x54, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55 },
+	{ 0x00, 0x05, 0x50, 0x00, 0x05, 0x50, 0x2A, 0xA4, 0x2A, 0xA4, 0x22, 0x64, 0x22, 0x64 },
+	{ 0xA8, 0x80, 0x0A, 0xA8, 0x80, 0x5A, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0x4A, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01 },
+	{ 0x95, 0x5A, 0xA9, 0x95, 0x0A, 0xA8, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA },
+	{ 0x01, 0x14, 0x40, 0x01, 0x10, 0x50, 0x2A, 0xA0, 0x2A, 0xA0, 0x29, 0x60, 0x29, 0x60 },
+	{ 0xA0, 0x02, 0x2A, 0x80, 0x00, 0x2A, 0x94, 0x0A, 0x94, 0x0A, 0x94, 0x0A, 0x94, 0x0A },
+	{ 0x05, 0x55, 0x51, 0x55, 0x15, 0x50, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05 },
+	{ 0x56, 0x6A, 0xA5, 0x56, 0x25, 0xA5, 0x42, 0xA9, 0x42, 0xA9, 0x42, 0xA9, 0x42, 0xA9 },
+	{ 0x01, 0x04, 0x00, 0x00, 0x10, 0x40, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50 },
+	{ 0x05, 0x54, 0x40, 0x01, 0x50, 0x40, 0xA5, 0x6A, 0xA5, 0x6A, 0xA5, 0x60, 0xA5, 0x60 },
+	{ 0x80, 0x0A, 0xA8, 0x80, 0x00, 0xA8, 0x50, 0xAA, 0x50, 0xAA, 0x50, 0xAA, 0x50, 0xAA },
+	{ 0x15, 0x54, 0x55, 0x55, 0x55, 0x40, 0x05, 0x40, 0x05, 0x40, 0x05, 0x40, 0x05, 0x40 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x14, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15 },
+	{ 0x5A, 0xA9, 0x95, 0x56, 0xA9, 0x94, 0x0A, 0x95, 0x0A, 0x95, 0x0A, 0x95, 0x0A, 0x95 },
+	{ 0x05, 0x10, 0x00, 0x00, 0x50, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00 },
+	{ 0x15, 0x50, 0x01, 0x15, 0x40, 0x01, 0xA5, 0x2A, 0xA5, 0x2A, 0x65, 0x22, 0x65, 0x22 },
+	{ 0x02, 0x2A, 0xA0, 0x02, 0x6A, 0xA1, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0x1A, 0x50, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55 },
+	{ 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0x02, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00 },
+	{ 0x54, 0x40, 0x05, 0x40, 0x40, 0x05, 0xA4, 0x2A, 0xA4, 0x2A, 0x64, 0x29, 0x64, 0x29 },
+	{ 0x0A, 0xA8, 0x80, 0x02, 0xA0, 0x80, 0x0A, 0x94, 0x0A, 0x94, 0x0A, 0x94, 0x0A, 0x94 },
+	{ 0x54, 0x41, 0x55, 0x55, 0x45, 0x05, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0x1A, 0x40, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54 },
+	{ 0xA9, 0x95, 0x5A, 0x99, 0x95, 0x4A, 0xA9, 0x42, 0xA9, 0x42, 0xA9, 0x42, 0xA9, 0x42 },
+	{ 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15 },
+	{ 0x40, 0x01, 0x14, 0x40, 0x00, 0x15, 0x2A, 0xA5, 0x2A, 0xA5, 0x20, 0xA5, 0x20, 0xA5 },
+	{ 0x2A, 0xA0, 0x02, 0x02, 0xA0, 0x02, 0xAA, 0x50, 0xAA, 0x50, 0xAA, 0x50, 0xAA, 0x50 },
+	{ 0x50, 0x55, 0x55, 0x55, 0x05, 0x15, 0x40, 0x05, 0x40, 0x05, 0x40, 0x05, 0x40, 0x05 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x00, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50, 0x55, 0x50 },
+	{ 0xA5, 0x56, 0x6A, 0xA5, 0x55, 0x2A, 0x95, 0x0A, 0x95, 0x0A, 0x95, 0x0A, 0x95, 0x0A },
+	{ 0x40, 0x01, 0x04, 0x00, 0x00, 0x14, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55 },
+	{ 0x00, 0x05, 0x50, 0x00, 0x05, 0x50, 0x00, 0x54, 0xAA, 0xAA, 0x22, 0x64, 0x22, 0x64 },
+	{ 0xA8, 0x80, 0x0A, 0xA8, 0x80, 0x0A, 0xA8, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x56 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x54, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01 },
+	{ 0x95, 0x5A, 0xA9, 0x95, 0x5A, 0xA9, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA },
+	{ 0x01, 0x14, 0x50, 0x01, 0x10, 0x00, 0x01, 0x54, 0xAA, 0xAA, 0x29, 0x60, 0x29, 0x60 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0xA4, 0x0A, 0xA4, 0x0A, 0xA4, 0x0A },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x50, 0x01, 0x54, 0x05, 0x54, 0x05, 0x54, 0x05 },
+	{ 0x56, 0x69, 0xA5, 0x56, 0x65, 0x55, 0x52, 0xA9, 0x52, 0xA9, 0x52, 0xA9, 0x52, 0xA9 },
+	{ 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x15, 0x50, 0x05, 0x50, 0x05, 0x50 },
+	{ 0x05, 0x54, 0x40, 0x05, 0x54, 0x40, 0x05, 0x40, 0xAA, 0xAA, 0x25, 0x40, 0x25, 0x40 },
+	{ 0xA5, 0x56, 0x6A, 0xA5, 0x56, 0x6A, 0x85, 0x6A, 0x95, 0x6A, 0x95, 0x6A, 0x95, 0x6A },
+	{ 0x50, 0x01, 0x15, 0x50, 0x01, 0x15, 0x40, 0x15, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15 },
+	{ 0x0A, 0xA8, 0x80, 0x0A, 0xA8, 0x80, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0xAA, 0xAA, 0xA5, 0x60, 0xA5, 0x60 },
+	{ 0x80, 0x02, 0xA8, 0x80, 0x00, 0x08, 0x00, 0xAA, 0x40, 0xAA, 0x40, 0xAA, 0x40, 0xAA },
+	{ 0x15, 0x54, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x05, 0x40, 0x15, 0x40, 0x15, 0x40 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x15, 0x40, 0x15, 0x40, 0x15, 0x40, 0x15 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2A, 0x95, 0x2A, 0x95, 0x2A, 0x95, 0x2A, 0x95 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00 },
+	{ 0x15, 0x50, 0x01, 0x14, 0x40, 0x01, 0x54, 0x00, 0xAA, 0xAA, 0x65, 0x22, 0x65, 0x22 },
+	{ 0x02, 0x2A, 0xA0, 0x02, 0x2A, 0xA0, 0x56, 0xA8, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x01, 0x54, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55 },
+	{ 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0x56, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00 },
+	{ 0x50, 0x40, 0x05, 0x40, 0x00, 0x04, 0x54, 0x01, 0xAA, 0xAA, 0x64, 0x29, 0x64, 0x29 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0xA4, 0x0A, 0xA4, 0x0A, 0xA4 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x01, 0x50, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54 },
+	{ 0xA9, 0x95, 0x5A, 0x99, 0x95, 0x59, 0xA9, 0x52, 0xA9, 0x52, 0xA9, 0x52, 0xA9, 0x52 },
+	{ 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x50, 0x15, 0x50, 0x05, 0x50, 0x05 },
+	{ 0x50, 0x01, 0x15, 0x50, 0x01, 0x15, 0x40, 0x05, 0xAA, 0xAA, 0x50, 0x25, 0x50, 0x25 },
+	{ 0x5A, 0xA9, 0x95, 0x5A, 0xA9, 0x95, 0x6A, 0x85, 0x6A, 0x95, 0x6A, 0x95, 0x6A, 0x95 },
+	{ 0x05, 0x54, 0x40, 0x05, 0x54, 0x40, 0x15, 0x40, 0x15, 0x50, 0x05, 0x50, 0x05, 0x50 },
+	{ 0xA0, 0x02, 0x2A, 0xA0, 0x02, 0x2A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0xAA, 0xAA, 0x20, 0xA5, 0x20, 0xA5 },
+	{ 0x2A, 0xA0, 0x02, 0x02, 0x20, 0x00, 0xAA, 0x00, 0xAA, 0x40, 0xAA, 0x40, 0xAA, 0x40 },
+	{ 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15, 0x40, 0x05, 0x40, 0x15, 0x40, 0x15 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x15, 0x00, 0x55, 0x40, 0x55, 0x40, 0x55, 0x40 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2A, 0x95, 0x2A, 0x95, 0x2A, 0x95, 0x2A },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55 },
+	{ 0x00, 0x05, 0x50, 0x00, 0x05, 0x50, 0x00, 0x54, 0x00, 0x54, 0x02, 0x54, 0x02, 0x54 },
+	{ 0xA8, 0x80, 0x0A, 0xA8, 0x80, 0x0A, 0xA8, 0x02, 0xA8, 0x56, 0xA9, 0x56, 0xA9, 0x56 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x54, 0x01, 0x55, 0x01, 0x55, 0x01 },
+	{ 0x95, 0x5A, 0xA9, 0x95, 0x5A, 0xA9, 0x55, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA },
+	{ 0x01, 0x14, 0x50, 0x01, 0x10, 0x00, 0x01, 0x00, 0x01, 0x54, 0x09, 0x50, 0x09, 0x50 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x0A, 0xA4, 0x0A, 0xA4, 0x0A },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x54, 0x01, 0x54, 0x01, 0x54 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x50, 0x01, 0x54, 0x05, 0x54, 0x05 },
+	{ 0x56, 0x69, 0xA5, 0x56, 0x65, 0x55, 0x56, 0x55, 0x52, 0xA9, 0x52, 0xA9, 0x52, 0xA9 },
+	{ 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x50, 0x05, 0x50 },
+	{ 0x05, 0x54, 0x40, 0x05, 0x54, 0x40, 0x05, 0x40, 0x05, 0x40, 0x25, 0x40, 0x25, 0x40 },
+	{ 0xA5, 0x56, 0x6A, 0xA5, 0x56, 0x6A, 0x80, 0x2A, 0x85, 0x6A, 0x95, 0x6A, 0x95, 0x6A },
+	{ 0x50, 0x01, 0x15, 0x50, 0x01, 0x15, 0xAA, 0xAA, 0x40, 0x15, 0x50, 0x15, 0x50, 0x15 },
+	{ 0x0A, 0xA8, 0x80, 0x0A, 0xA8, 0x80, 0x5A, 0xA5, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x15, 0x40, 0x95, 0x40, 0x95, 0x40 },
+	{ 0x80, 0x02, 0xA8, 0x80, 0x00, 0x08, 0x00, 0x02, 0x00, 0xAA, 0x40, 0xAA, 0x40, 0xAA },
+	{ 0x15, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x15, 0x40, 0x15, 0x40 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x15, 0x40, 0x15, 0x40, 0x15 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x95, 0x2A, 0x95, 0x2A, 0x95, 0x2A, 0x95 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x55, 0x00, 0x55, 0x00 },
+	{ 0x15, 0x50, 0x01, 0x14, 0x40, 0x01, 0x55, 0x00, 0x54, 0x00, 0x55, 0x02, 0x55, 0x02 },
+	{ 0x02, 0x2A, 0xA0, 0x02, 0x2A, 0xA0, 0x02, 0xA8, 0x56, 0xA8, 0x56, 0xA9, 0x56, 0xA9 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x01, 0x54, 0x00, 0x55, 0x00, 0x55 },
+	{ 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0x56, 0xAA, 0x55, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00 },
+	{ 0x50, 0x40, 0x05, 0x40, 0x00, 0x04, 0x00, 0x01, 0x54, 0x01, 0x54, 0x09, 0x54, 0x09 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0A, 0xA0, 0x0A, 0xA4, 0x0A, 0xA4 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x01, 0x54, 0x01, 0x54, 0x01 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x01, 0x50, 0x01, 0x54, 0x01, 0x54 },
+	{ 0xA9, 0x95, 0x5A, 0x99, 0x95, 0x59, 0x69, 0x56, 0xA9, 0x52, 0xA9, 0x52, 0xA9, 0x52 },
+	{ 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x50, 0x05, 0x50, 0x05 },
+	{ 0x50, 0x01, 0x15, 0x50, 0x01, 0x15, 0x40, 0x05, 0x40, 0x05, 0x50, 0x25, 0x50, 0x25 },
+	{ 0x5A, 0xA9, 0x95, 0x5A, 0xA9, 0x95, 0x2A, 0x80, 0x6A, 0x85, 0x6A, 0x95, 0x6A, 0x95 },
+	{ 0x05, 0x54, 0x40, 0x05, 0x54, 0x40, 0xAA, 0xAA, 0x15, 0x40, 0x05, 0x50, 0x05, 0x50 },
+	{ 0xA0, 0x02, 0x2A, 0xA0, 0x02, 0x2A, 0xA5, 0x5A, 0xA0, 0x0A, 0xA0, 0x0A, 0xA0, 0x0A },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x15, 0x00, 0x95, 0x00, 0x95 },
+	{ 0x2A, 0xA0, 0x02, 0x02, 0x20, 0x00, 0x22, 0x00, 0xAA, 0x00, 0xAA, 0x40, 0xAA, 0x40 },
+	{ 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15, 0x40, 0x15, 0x40, 0x15 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x15, 0x00, 0x55, 0x40, 0x55, 0x40 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x95, 0x2A, 0x95, 0x2A, 0x95, 0x2A },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x55, 0x00, 0x55 },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55 },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFB, 0xFF },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0x9A, 0xAA },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x45, 0x55 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55 },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xBF, 0xFF },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55 },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFB },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0x9A },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x45 },
+	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55 },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xBF },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0xAA },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3 },
+	{ 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A },
+	{ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F },
+};
+
+#endif
@@ -0,0 +1,339 @@
+#include "TourPlanner.h"
+
+
+TourPlanner::TourPlanner(int round, uint8_t tokenCapacity)
+{
+	capacity = tokenCapacity > 0 ? tokenCapacity : 1;
+	for (uint8_t i = 0; i < BOARD_INTERSECTION_COUNT && tokenCount < TOUR_MAX_TOKENS; i++) {
+		if (BoardTable::getIfToken(i, round)) {
+			tokens[tokenCount++] = i;
+		}
+	}
+	findDrops();
+	invalidateCosts();
+	for (uint8_t i = 0; i < tokenCount; i++) {
+		order[i] = i;
+	}
+	orderCount = tokenCount;
+}
+
+
+void TourPlanner::findDrops() {
+	// drop intersections are the ones entered with a MoveIntoDropPosition approach
+	bool isDrop[BOARD_INTERSECTION_COUNT] = { false };
+	for (uint16_t state = 0; state < BOARD_STATE_COUNT; state++) {
+		uint16_t next = BoardTable::getNextState(state, CommandForward);
+		if (next != BOARD_NO_STATE && BoardTable::getMove(state, CommandForward) == MoveIntoDropPosition) {
+			isDrop[BoardTable::getIntersection(next)] = true;
+		}
+	}
+	for (uint8_t i = 0; i < BOARD_INTERSECTION_COUNT && dropCount < TOUR_MAX_DROPS; i++) {
+		if (isDrop[i]) {
+			drops[dropCount++] = i;
+		}
+	}
+}
+
+
+bool TourPlanner::costToToken(uint16_t& state, uint8_t tokenIndex, uint32_t& cost) {
+	uint16_t legCost;
+	uint16_t end;
+	if (!RouteTable::lookupCost(state, tokens[tokenIndex], legCost, end)) {
+		return false;
+	}
+	cost += legCost + pickupTime;
+	state = end;
+	return true;
+}
+
+
+void TourPlanner::invalidateCosts() {
+	for (uint8_t i = 0; i < TOUR_DROP_CACHE_SIZE; i++) {
+		dropCacheState[i] = BOARD_NO_STATE;
+	}
+}
+
+
+bool TourPlanner::costToDrop(uint16_t& state, uint32_t& cost) {
+	uint8_t slot = state % TOUR_DROP_CACHE_SIZE;
+	if (dropCacheState[slot] == state) {
+		cost += dropCacheCost[slot] + dropTime;
+		state = dropCacheEnd[slot];
+		return true;
+	}
+	uint16_t bestLeg = 0xFFFF;
+	uint16_t bestEnd = BOARD_NO_STATE;
+	for (uint8_t d = 0; d < dropCount; d++) {
+		uint16_t legCost;
+		uint16_t end;
+		if (RouteTable::lookupCost(state, drops[d], legCost, end) && legCost < bestLeg) {
+			bestLeg = legCost;
+			bestEnd = end;
+		}
+	}
+	if (bestEnd == BOARD_NO_STATE) {
+		return false;
+	}
+	dropCacheState[slot] = state;
+	dropCacheCost[slot] = bestLeg;
+	dropCacheEnd[slot] = bestEnd;
+	cost += bestLeg + dropTime;
+	state = bestEnd;
+	return true;
+}
+
+
+uint32_t TourPlanner::evaluate(uint16_t start, const uint8_t* tokenOrder) {
+	return evaluateFrom(0, start, 0, tokenOrder, tokenCount, TOUR_NO_COST);
+}
+
+
+uint32_t TourPlanner::evaluate(uint16_t start, const uint8_t* tokenOrder, uint8_t count) {
+	return evaluateFrom(0, start, 0, tokenOrder, count, TOUR_NO_COST);
+}
+
+
+uint32_t TourPlanner::evaluateFrom(uint8_t position, uint16_t state, uint32_t cost, const uint8_t* tokenOrder,
+	uint8_t count, uint32_t limit) {
+	for (uint8_t i = position; i < count; i++) {
+		if (!costToToken(state, tokenOrder[i], cost)) {
+			return TOUR_NO_COST;
+		}
+		// drop run when full or after the last token
+		if ((i + 1) % capacity == 0 || i + 1 == count) {
+			if (!costToDrop(state, cost)) {
+				return TOUR_NO_COST;
+			}
+		}
+		if (cost >= limit) {
+			return TOUR_NO_COST;
+		}
+	}
+	return cost;
+}
+
+
+void TourPlanner::tracePrefix(uint16_t start, uint16_t* prefixState, uint32_t* prefixCost) {
+	uint16_t state = start;
+	uint32_t cost = 0;
+	for (uint8_t i = 0; i < orderCount; i++) {
+		prefixState[i] = state;
+		prefixCost[i] = cost;
+		costToToken(state, order[i], cost);
+		if ((i + 1) % capacity == 0) {
+			costToDrop(state, cost);
+		}
+	}
+	prefixState[orderCount] = state;
+	prefixCost[orderCount] = cost;
+}
+
+
+void TourPlanner::moveToken(uint8_t* candidate, uint8_t from, uint8_t to) {
+	uint8_t moved = order[from];
+	uint8_t k = 0;
+	for (uint8_t i = 0; i < orderCount; i++) {
+		if (i == from) {
+			continue;
+		}
+		if (k == to) {
+			candidate[k++] = moved;
+		}
+		candidate[k++] = order[i];
+	}
+	if (k == to) {
+		candidate[k++] = moved;
+	}
+}
+
+
+uint32_t TourPlanner::planHeuristic(uint16_t start, uint8_t maxPasses) {
+	// the move costs may have changed since the last plan
+	invalidateCosts();
+	// nearest neighbour: repeatedly take the cheapest next token, with drop runs as in evaluate
+	bool used[TOUR_MAX_TOKENS] = { false };
+	uint16_t state = start;
+	for (uint8_t i = 0; i < tokenCount; i++) {
+		uint8_t best = 0;
+		uint32_t bestLeg = TOUR_NO_COST;
+		uint16_t bestState = state;
+		for (uint8_t t = 0; t < tokenCount; t++) {
+			uint32_t leg = 0;
+			uint16_t legState = state;
+			if (!used[t] && costToToken(legState, t, leg) && leg < bestLeg) {
+				best = t;
+				bestLeg = leg;
+				bestState = legState;
+			}
+		}
+		used[best] = true;
+		order[i] = best;
+		state = bestState;
+		if ((i + 1) % capacity == 0) {
+			uint32_t ignored = 0;
+			costToDrop(state, ignored);
+		}
+	}
+	orderCount = tokenCount;
+	bestCost = evaluate(start, order);
+
+	// or-opt: move one token to another position while that lowers the cost;
+	// candidates share the tour up to the first changed position, so only the rest is evaluated
+	uint8_t candidate[TOUR_MAX_TOKENS];
+	uint16_t prefixState[TOUR_MAX_TOKENS + 1];
+	uint32_t prefixCost[TOUR_MAX_TOKENS + 1];
+	tracePrefix(start, prefixState, prefixCost);
+	for (uint8_t pass = 0; pass < maxPasses; pass++) {
+		bool improved = false;
+		for (uint8_t from = 0; from < tokenCount; from++) {
+			for (uint8_t to = 0; to < tokenCount; to++) {
+				if (to == from) {
+					continue;
+				}
+				moveToken(candidate, from, to);
+				uint8_t first = from < to ? from : to;
+				uint32_t cost = evaluateFrom(first, prefixState[first], prefixCost[first], candidate, tokenCount, bestCost);
+				if (cost < bestCost) {
+					bestCost = cost;
+					memcpy(order, candidate, tokenCount);
+					tracePrefix(start, prefixState, prefixCost);
+					improved = true;
+				}
+			}
+		}
+		if (!improved) {
+			break;
+		}
+	}
+	return bestCost;
+}
+
+
+void TourPlanner::setOrder(const uint8_t* tokenOrder, uint32_t cost) {
+	memcpy(order, tokenOrder, tokenCount);
+	orderCount = tokenCount;
+	bestCost = cost;
+}
+
+
+// deadline mode
+
+void TourPlanner::beginDeadline(uint16_t start, uint32_t budget) {
+	invalidateCosts();
+	deadlineStart = start;
+	deadlineBudget = budget;
+	orderCount = 0;
+	bestCost = 0;
+}
+
+
+bool TourPlanner::improveDeadline() {
+	if (deadlineStart == BOARD_NO_STATE) {
+		return false;
+	}
+	// more tokens first; a shorter plan can make room for another one
+	return insertToken() || shortenPlan();
+}
+
+
+bool TourPlanner::insertToken() {
+	if (orderCount >= tokenCount) {
+		return false;
+	}
+	bool used[TOUR_MAX_TOKENS] = { false };
+	for (uint8_t i = 0; i < orderCount; i++) {
+		used[order[i]] = true;
+	}
+	uint8_t candidate[TOUR_MAX_TOKENS];
+	uint16_t prefixState[TOUR_MAX_TOKENS + 1];
+	uint32_t prefixCost[TOUR_MAX_TOKENS + 1];
+	tracePrefix(deadlineStart, prefixState, prefixCost);
+	// cheapest insertion of any unused token that still fits the budget; the budget may be TOUR_NO_COST
+	// (no deadline), so the first candidate is only limited by it when it is less
+	bool found = false;
+	uint32_t best = 0;
+	uint32_t budgetLimit = deadlineBudget < TOUR_NO_COST ? deadlineBudget + 1 : TOUR_NO_COST;
+	uint8_t bestToken = 0;
+	uint8_t bestPosition = 0;
+	for (uint8_t t = 0; t < tokenCount; t++) {
+		if (used[t]) {
+			continue;
+		}
+		for (uint8_t p = 0; p <= orderCount; p++) {
+			memcpy(candidate, order, p);
+			candidate[p] = t;
+			memcpy(candidate + p + 1, order + p, orderCount - p);
+			uint32_t cost = evaluateFrom(p, prefixState[p], prefixCost[p], candidate, orderCount + 1,
+				found ? best : budgetLimit);
+			if (cost != TOUR_NO_COST && cost <= deadlineBudget && (!found || cost < best)) {
+				found = true;
+				best = cost;
+				bestToken = t;
+				bestPosition = p;
+			}
+		}
+	}
+	if (!found) {
+		return false;
+	}
+	memmove(order + bestPosition + 1, order + bestPosition, orderCount - bestPosition);
+	order[bestPosition] = bestToken;
+	orderCount++;
+	bestCost = best;
+	return true;
+}
+
+
+bool TourPlanner::shortenPlan() {
+	uint8_t candidate[TOUR_MAX_TOKENS];
+	uint16_t prefixState[TOUR_MAX_TOKENS + 1];
+	uint32_t prefixCost[TOUR_MAX_TOKENS + 1];
+	tracePrefix(deadlineStart, prefixState, prefixCost);
+	// move a planned token somewhere else (or-opt)
+	for (uint8_t from = 0; from < orderCount; from++) {
+		for (uint8_t to = 0; to < orderCount; to++) {
+			if (to == from) {
+				continue;
+			}
+			moveToken(candidate, from, to);
+			uint8_t first = from < to ? from : to;
+			uint32_t cost = evaluateFrom(first, prefixState[first], prefixCost[first], candidate, orderCount, bestCost);
+			if (cost < bestCost) {
+				memcpy(order, candidate, orderCount);
+				bestCost = cost;
+				return true;
+			}
+		}
+	}
+	// swap a planned token for one that is not planned
+	bool used[TOUR_MAX_TOKENS] = { false };
+	for (uint8_t i = 0; i < orderCount; i++) {
+		used[order[i]] = true;
+	}
+	memcpy(candidate, order, orderCount);
+	for (uint8_t p = 0; p < orderCount; p++) {
+		for (uint8_t t = 0; t < tokenCount; t++) {
+			if (used[t]) {
+				continue;
+			}
+			candidate[p] = t;
+			uint32_t cost = evaluateFrom(p, prefixState[p], prefixCost[p], candidate, orderCount, bestCost);
+			if (cost < bestCost) {
+				order[p] = t;
+				bestCost = cost;
+				return true;
+			}
+		}
+		candidate[p] = order[p];
+	}
+	return false;
+}
+
+
+uint8_t TourPlanner::planDeadline(uint16_t start, uint32_t budget, uint32_t maxMillis) {
+	unsigned long begin = millis();
+	beginDeadline(start, budget);
+	while (millis() - begin < maxMillis && improveDeadline()) {
+	}
+	return orderCount;
+}
@@ -7,6 +7,23 @@
 
 // ScrapMotorControl constants
 #define SCRAPMOTORCONTROL_MINPOWER 50
+#define SCRAPMOTORCONTROL_MAXPOWER 255
+// PID gains: PWM per (encoder count/s) of error, PWM per encoder count of integrated error, PWM per (count/s) change per update
+#define SCRAPMOTORCONTROL_KP 0.15
+#define SCRAPMOTORCONTROL_KI 3.0
+#define SCRAPMOTORCONTROL_KD 0.0
+// setGains clamps to these, so gain*error and ki*dt*error fit in 32 bits
+#define SCRAPMOTORCONTROL_MAXGAIN 2.0 // kp and kd
+#define SCRAPMOTORCONTROL_MAXKI 64.0
+#define SCRAPMOTORCONTROL_MAXERROR 4095 // speed error is clamped to this (counts/s)
+#define SCRAPMOTORCONTROL_MAXINTERVAL 100000 // longest time step (us) integrated in one update
+// below this many counts per update, speed is measured over the last edges instead of the update interval;
+// 4 is one full quadrature cycle, so uneven spacing between the channels cancels out
+#define SCRAPMOTORCONTROL_SPANEDGES 4
+#define SCRAPMOTORCONTROL_STOPTIME 100000 // no edge for this long (us) reads as stopped
+
+// ScrapEncoder constants
+#define SCRAPENCODER_EDGES 8 // edge timestamps kept by the encoder interrupt; power of two
 
 // ScrapController constants
 #define SCRAPCONTROLLER_ENCTOLERANCE 5
@@ -14,9 +31,19 @@
 #define SCRAPCONTROLLER_MINSLOWPOWER 120
 #define SCRAPCONTROLLER_MINENCSPEED 200
 #define SCRAPCONTROLLER_MAXENCSPEED 2000
+// speed profile: starts, stops and the slowdown toward the goal keep within these
+#define SCRAPCONTROLLER_ACCEL 5000 // counts/s^2
+#define SCRAPCONTROLLER_JERK 50000 // counts/s^3; full acceleration is reached in ACCEL/JERK seconds
+
+// ScrapProfile constants
+// time (s) the wheel speed trails a changing speed goal by, through the PID loop and the motor; braking
+// starts this much earlier so the wheel, not just the profile, comes to rest at the goal
+#define SCRAPPROFILE_LAG 0.05
+// counts the wheel coasts past the point the profile stops at; the speed loop only drives forward,
+// so at low speed the wheel slows by friction alone, slower than the profile brakes
+#define SCRAPPROFILE_OVERRUN 16
 
 // ScrapDualController constants
-#define SCRAPDUALCONTROLLER_DIFFTOLERANCE 40
 #define SCRAPDUALCONTROLLER_ENCTOLERANCE 5
 #define SCRAPDUALCONTROLLER_SLOWDOWNTHRESH1 500
 #define SCRAPDUALCONTROLLER_SLOWDOWNTHRESH2 500
@@ -24,7 +51,39 @@
 #define SCRAPDUALCONTROLLER_MINSLOWPOWER2 65
 #define SCRAPDUALCONTROLLER_MINENCSPEED 200
 #define SCRAPDUALCONTROLLER_MAXENCSPEED 1400
-#define SCRAPDUALCONTROLLER_ENCSPEEDBALANCE 10
+#define SCRAPDUALCONTROLLER_ACCEL 5000
+#define SCRAPDUALCONTROLLER_JERK 50000
+// cross coupling: speed (counts/s) moved toward the lagging wheel per count it is behind, and at most
+#define SCRAPDUALCONTROLLER_SYNCGAIN 5.0
+#define SCRAPDUALCONTROLLER_MAXSYNC 300
+
+// ScrapFullController motion queue constants, in encoder counts
+#define SCRAPFULLCONTROLLER_QUEUESIZE 8 // segments planned ahead
+#define SCRAPFULLCONTROLLER_SPEED 1200 // default path speed (counts/s)
+#define SCRAPFULLCONTROLLER_ACCEL 4000 // path acceleration (counts/s^2)
+#define SCRAPFULLCONTROLLER_JUNCTIONDEV 20 // how far (counts) a corner may be cut at speed; sets the corner speed
+// largest step in axis speed (counts/s) at a corner; the speed loops lag behind a step, and the lag is
+// what carries the gantry past the corner
+#define SCRAPFULLCONTROLLER_MAXJUMP 400
+#define SCRAPFULLCONTROLLER_PATHGAIN 10.0 // speed (counts/s) back toward the line per count off it
+#define SCRAPFULLCONTROLLER_MINSPEED 60 // slowest path speed before the end of the queue is reached
+#define SCRAPFULLCONTROLLER_ENCTOLERANCE 5 // end of the queue is reached within this many counts on both axes
+
+// ScrapHoming constants
+#define SCRAPHOMING_FASTSPEED 800 // approach from wherever the axis is (counts/s)
+#define SCRAPHOMING_SLOWSPEED 80 // second approach; the switch is caught within about a count
+#define SCRAPHOMING_BACKOFFSPEED 200
+#define SCRAPHOMING_BACKOFFCOUNT 5 // counts past where the switch lets go before the slow approach
+
+// ScrapScheduler constants
+// control updates per second; speed comes from edge times, so a few counts per update are enough.
+// the load on the board is not measured yet; ScrapScheduler::getStats() reports the longest update
+#define SCRAPSCHEDULER_RATE 1000
+#define SCRAPSCHEDULER_MAXCONTROLS 4 // of each kind
 
+// marks the points between the loads of an encoder snapshot; host tests run an interrupt there
+#ifndef SCRAP_PREEMPTION_POINT
+#define SCRAP_PREEMPTION_POINT()
+#endif
 
 #endif //SCRAPCONTROLLER_SCRAPDEFINITIONS_H
@@ -9,31 +9,94 @@ ScrapMotorControl::ScrapMotorControl(ScrapMotorInterface& mot, ScrapEncoderInter
 	attachEncoder(enc);
 }
 
-float ScrapMotorControl::calcSpeed() {
-	// get some values for calculation
-	unsigned long newTime = micros();
-	long newCount = encoder->getCount();
-	float currSpeed = 0;
+/*
+Combined M/T speed estimate from the edge times the encoder interrupt records:
+- many counts per update: counts over the time between the edges this and the last estimate ended on,
+  so the count is exact and the time is not rounded to the update period
+- a few counts: the last SCRAPMOTORCONTROL_SPANEDGES edges over their own time span (1/T)
+- no count: at most one count over the time since the last edge, and 0 after SCRAPMOTORCONTROL_STOPTIME
+Spans are whole multiples of SCRAPMOTORCONTROL_SPANEDGES edges where possible, so the uneven spacing of
+the edges within a quadrature cycle cancels out.
+*/
+long ScrapMotorControl::calcSpeed() {
+	// get some values for calculation; count and time from the same instant
+	ScrapEncoderSnapshot snapshot;
+	encoder->getSnapshot(snapshot);
+	unsigned long newTime = snapshot.time;
+	long newCount = snapshot.count;
+	long currSpeed = 0;
+	// the newest edge ends the span unless a better one is found
+	long edgeCount = snapshot.count;
+	unsigned long edgeTime = snapshot.edgeTime;
 	// check if prevTime exists
-	if (prevTime == 0)
+	if (prevTime == 0) {
 		prevTime = newTime;
+		prevCount = newCount;
+		prevEdgeCount = edgeCount;
+		prevEdgeTime = edgeTime;
+	}
 		
 	unsigned long timeDelta = newTime - prevTime;
+	unsigned long countDelta = abs(newCount-prevCount);
+	long spanCount;
+	unsigned long spanTime;
 	// avoid zero division; no time has passed anyway
-	if (timeDelta != 0) {
-		currSpeed = 1000000*(float(abs(newCount-prevCount))/float(timeDelta));
+	if (timeDelta == 0) {
+		currSpeed = prevSpeed;
+	}
+	else if (countDelta >= SCRAPMOTORCONTROL_SPANEDGES) {
+		// end on the newest edge in the same place of the cycle as the edge the last estimate ended on
+		for (uint8_t back = 0; back < SCRAPMOTORCONTROL_SPANEDGES; back++) {
+			if (encoder->getEdge(back,spanCount,spanTime) && spanCount != prevEdgeCount && (spanCount-prevEdgeCount) % SCRAPMOTORCONTROL_SPANEDGES == 0) {
+				edgeCount = spanCount;
+				edgeTime = spanTime;
+				break;
+			}
+		}
+		currSpeed = scaleSpeed(abs(edgeCount-prevEdgeCount),edgeTime-prevEdgeTime);
+	}
+	else if (countDelta > 0) {
+		// only trust the span if the wheel kept one direction over it
+		if (encoder->getEdge(SCRAPMOTORCONTROL_SPANEDGES,spanCount,spanTime) && abs(snapshot.count-spanCount) == SCRAPMOTORCONTROL_SPANEDGES) {
+			currSpeed = scaleSpeed(SCRAPMOTORCONTROL_SPANEDGES,snapshot.edgeTime-spanTime);
+		}
+		else {
+			currSpeed = scaleSpeed(countDelta,snapshot.edgeTime-prevEdgeTime);
+		}
 	}
 	else {
-		currSpeed = prevSpeed;
+		unsigned long sinceEdge = newTime - snapshot.edgeTime;
+		if (snapshot.edgeTime == 0 || sinceEdge > SCRAPMOTORCONTROL_STOPTIME) {
+			currSpeed = 0;
+		}
+		else {
+			currSpeed = min(prevSpeed,scaleSpeed(1,sinceEdge));
+		}
 	}
 	// update prev values for next iteration
+	prevInterval = timeDelta;
 	prevTime = newTime;
 	prevCount = newCount;
+	prevEdgeCount = edgeCount;
+	prevEdgeTime = edgeTime;
 	prevSpeed = currSpeed;
 	
 	return currSpeed;
 }
 
+long ScrapMotorControl::scaleSpeed(unsigned long counts, unsigned long time) {
+	if (time == 0) {
+		return 0;
+	}
+	// scale in two steps when counts*1000000 would overflow
+	if (counts < 4000) {
+		return counts*1000000UL/time;
+	}
+	else {
+		return counts*1000UL/max(1UL,time/1000);
+	}
+}
+
 // map function for floats
 float ScrapMotorControl::mapFloat(float x, float in_min, float in_max, float out_min, float out_max) {
 	return (constrainFloat(x,in_min,in_max)-in_min)*(out_max-out_min)/(in_max-in_min) + out_min;
@@ -57,6 +120,7 @@ float ScrapMotorControl::constrainFloat(float x, float min, float max) {
 
 void ScrapMotorControl::reset() {
 	speedGoal = 0;
+	integral = 0;
 	motor->stop();
 	encoder->resetCount();
 	prevSpeed = 0;
@@ -66,15 +130,23 @@ void ScrapMotorControl::reset() {
 
 void ScrapMotorControl::stop() {
 	speedGoal = 0;
+	integral = 0;
 	prevSpeed = 0;
+	prevTime = 0; // the next speed is measured from the restart, not from the stop
 	motor->stop();
 }
 
 void ScrapMotorControl::setSpeed(float newSpeed) {
-	speedGoal = newSpeed;
+	speedGoal = (long)(newSpeed + 0.5);
 }
 
 void ScrapMotorControl::setControl(float newSpeed) {
+	int newDirection = (newSpeed < 0) ? -1 : 1;
+	// integrated power belongs to the old direction
+	if (newDirection != goalDirection) {
+		integral = 0;
+		goalDirection = newDirection;
+	}
 	if (newSpeed < 0) {
 		motor->setDirection(-1);
 		setSpeed(newSpeed*-1);
@@ -85,35 +157,42 @@ void ScrapMotorControl::setControl(float newSpeed) {
 	}
 }
 
+void ScrapMotorControl::setGains(float newKp, float newKi, float newKd) {
+	kp = q16FromFloat(constrain(newKp,-SCRAPMOTORCONTROL_MAXGAIN,SCRAPMOTORCONTROL_MAXGAIN));
+	ki = q16FromFloat(constrain(newKi,-SCRAPMOTORCONTROL_MAXKI,SCRAPMOTORCONTROL_MAXKI));
+	kd = q16FromFloat(constrain(newKd,-SCRAPMOTORCONTROL_MAXGAIN,SCRAPMOTORCONTROL_MAXGAIN));
+	integral = 0;
+}
+
 void ScrapMotorControl::performMovement() {
+	// a stopped wheel keeps its count; reset() is for homing
 	if (speedGoal == 0) {
-		reset();
+		stop();
 	}
 	else {
 		// calculate speed
-		float currSpeed = calcSpeed();
-		int powChange = 0;
-		// change power according to proportion of speeds
-		if (currSpeed < speedGoal) {
-			// avoid division by zero
-			if (currSpeed != 0) {
-				powChange = (int)mapFloat(speedGoal/currSpeed,1.0,2.0,1.0,6.0);
-			}
-			else {
-				powChange = 6;
-			}
-			motor->setPower(max(minPower,motor->getPower()+powChange));
-		}
-		else if (currSpeed > speedGoal) {
-			// avoid division by zero
-			if (currSpeed != 0) {
-				powChange = (int)mapFloat(currSpeed/speedGoal,1.0,2.0,1.0,6.0);
-			}
-			else {
-				powChange = 6;
-			}
-			motor->setPower(max(minPower,motor->getPower()-powChange));
+		long lastSpeed = prevSpeed;
+		long currSpeed = calcSpeed();
+		// error and gains are clamped, so every product below fits in 32 bits; the P and D terms are under 2^29 each
+		long error = constrain(speedGoal-currSpeed,-SCRAPMOTORCONTROL_MAXERROR,SCRAPMOTORCONTROL_MAXERROR);
+		long change = constrain(lastSpeed-currSpeed,-SCRAPMOTORCONTROL_MAXERROR,SCRAPMOTORCONTROL_MAXERROR);
+		// time step in Q16.16 seconds: us*65536/1000000 is about us*4295/65536; at most 0.1 s, under 2^13
+		unsigned long interval = min(prevInterval,(unsigned long)SCRAPMOTORCONTROL_MAXINTERVAL);
+		q16_t dt = (q16_t)((interval*4295UL) >> 16);
+		q16_t low = q16FromInt(minPower);
+		q16_t high = q16FromInt(SCRAPMOTORCONTROL_MAXPOWER);
+		// PID terms; derivative acts on the measured speed so a new goal does not kick the motor
+		q16_t proportional = q16MulInt(kp,error);
+		q16_t derivative = q16MulInt(kd,change);
+		// integral step: ki is scaled by dt before the error, so nothing is clipped before dt shrinks it
+		q16_t newIntegral = q16Constrain(integral + q16MulInt(q16MulSmall(ki,dt),error),-high,high);
+		q16_t power = proportional + newIntegral + derivative;
+		// anti-windup: hold the integral while the output is saturated in the direction the error pushes
+		if (!(power > high && error > 0) && !(power < low && error < 0)) {
+			integral = newIntegral;
 		}
+		power = q16Constrain(proportional + integral + derivative,low,high);
+		motor->setPower(q16Round(power));
 	}
 }
 
@@ -0,0 +1,123 @@
+#include "ScrapController.h"
+
+//ScrapProfile::
+
+// integer square root, rounded down; the profile runs in the control interrupt, where a float sqrt is too slow
+static uint16_t scrapSqrt(uint32_t a) {
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+	while (bit > a) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (a >= root + bit) {
+			a -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
+
+// what step() and getStopDistance() need from the limits, so they do not divide
+void ScrapProfile::setLimits(float newAccel, float newJerk) {
+	maxAccel = newAccel;
+	jerk = newJerk;
+	invAccel = (maxAccel > 0) ? 1/maxAccel : 0;
+	invJerk = (jerk > 0) ? 1/jerk : 0;
+	rampSpeed = maxAccel*maxAccel*invJerk;
+}
+
+/*
+The acceleration heads for the most the speed error allows: from there, bringing the acceleration back
+to 0 by jerk*dt every step lands on the target. So the speed eases into the target instead of
+overshooting it, and follows a moving target with an S-shaped curve.
+Stepping down from a by s = jerk*dt covers a*(a + s)/(2*jerk) of error, so the bound is
+a = (sqrt(s^2 + 8*jerk*error) - s)/2. Past rampSpeed of error it is over maxAccel, so the root is only
+taken near the target, where 8*jerk*error is under 8*maxAccel^2 and fits in 32 bits.
+*/
+float ScrapProfile::step(float target) {
+	unsigned long now = micros();
+	if (!getIfEnabled()) {
+		speed = target;
+		prevTime = now;
+		return speed;
+	}
+	if (prevTime == 0) {
+		prevTime = now;
+	}
+	float dt = min(now - prevTime,(unsigned long)SCRAPMOTORCONTROL_MAXINTERVAL) * 0.000001;
+	prevTime = now;
+	float error = target - speed;
+	float wanted = (error > 0) ? maxAccel : -maxAccel;
+	float landing = 0; // error the last step before the target covers
+	if (jerk > 0) {
+		float jerkStep = jerk*dt;
+		landing = jerkStep*dt;
+		if (fabs(error) < rampSpeed) {
+			float easing = (scrapSqrt((uint32_t)(jerkStep*jerkStep + 8*jerk*fabs(error))) - jerkStep)/2;
+			wanted = constrain(wanted,-easing,easing);
+		}
+		// acceleration changes by at most jerk*dt
+		accel = constrain(wanted,accel-jerkStep,accel+jerkStep);
+	}
+	else {
+		accel = wanted;
+	}
+	float change = accel*dt;
+	// close enough to land on the target this step; under a jerk limit the acceleration left, about one
+	// jerk step by now, is ramped out over the next steps rather than dropped
+	if (fabs(error) <= landing || ((error >= 0) ? change >= error : change <= error)) {
+		speed = target;
+		if (jerk <= 0) {
+			accel = 0;
+		}
+	}
+	else {
+		speed += change;
+	}
+	return speed;
+}
+
+/*
+Braking from v with the acceleration ramped in and out at the jerk limit takes v/maxAccel + maxAccel/jerk
+seconds, and the speed falls symmetrically, so the distance is v*(v/maxAccel + maxAccel/jerk)/2.
+Below rampSpeed full acceleration is never reached, and the distance is v*sqrt(v/jerk).
+An acceleration already under way is first ramped to 0, which adds accel^2/(2*jerk) to the speed; a
+braking already under way is counted from where it started.
+*/
+float ScrapProfile::getStopDistance() {
+	float v = fabs(speed);
+	// acceleration along the direction of motion
+	float a = (speed < 0) ? -accel : accel;
+	if (jerk <= 0) {
+		return v*v*invAccel/2;
+	}
+	float t = fabs(a)*invJerk; // time to ramp the acceleration to or from 0
+	// speeding up: the speed it reaches once the acceleration is ramped out;
+	// slowing down: the speed the braking started from
+	float peak = v + fabs(a)*t/2;
+	// distance while ramping out the acceleration, or the part of the braking already done
+	float ramp = peak*t - jerk*t*t*t/6;
+	float braking;
+	if (peak >= rampSpeed) {
+		braking = peak*(peak*invAccel + maxAccel*invJerk)/2;
+	}
+	else {
+		// sqrt(v/jerk) in units of 10 us; v/jerk is under (maxAccel/jerk)^2, so this fits in 32 bits
+		// while full acceleration is reached in under 0.6 s
+		braking = peak*scrapSqrt((uint32_t)(peak*invJerk*1.0e10))*0.00001;
+	}
+	return (a > 0) ? braking + ramp : braking - ramp;
+}
+
+bool ScrapProfile::getIfBraking(long remaining) {
+	// moving away from the goal or standing still, there is nothing to brake for
+	if ((remaining > 0) != (speed > 0) || speed == 0) {
+		return false;
+	}
+	return getStopDistance() + fabs(speed)*lag + overrun >= abs(remaining);
+}
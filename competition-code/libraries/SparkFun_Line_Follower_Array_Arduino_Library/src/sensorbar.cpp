@@ -47,6 +47,12 @@ SensorBar::SensorBar(uint8_t address, uint8_t resetPin, uint8_t interruptPin, ui
   pinReset = resetPin;
   invertBits = 0;
   barStrobe = 0; //Default always on
+  sampling = 0;
+  changePending = 0;
+  changeTaken = 0;
+  countSource = 0;
+  sampleHead = 0;
+  samplesTaken = 0;
   
 }
 
@@ -219,6 +225,118 @@ void SensorBar::clearInvertBits( void )
 	invertBits = 0; //Always on
 }
 
+//****************************************************************************//
+//
+//  Sampling on the interrupt pin
+//
+//****************************************************************************//
+
+uint8_t SensorBar::beginSampling( SensorBarCountSource source )
+{
+  if( pinInterrupt == 255 )
+  {
+    return 0;
+  }
+  countSource = source;
+  //A strobed bar changes every time the IR is switched, so the IR stays on
+  barStrobe = 0;
+  writeByte(REG_DATA_B, 0x00);
+  //Reading RegDataA clears the interrupt (RegMisc bit 0 = 0), so a sample is a single read
+  writeByte(REG_MISC, readByte(REG_MISC) & ~0x01);
+  writeWord(REG_SENSE_HIGH_A, 0xFFFF); //Both edges on all of bank A
+  writeByte(REG_INTERRUPT_MASK_A, 0x00);
+  sampleHead = 0;
+  samplesTaken = 0;
+  changeTaken = 0;
+  sampling = 1;
+  //First sample, also clears anything pending from before
+  markChange();
+  updateSample();
+  return 1;
+}
+
+void SensorBar::markChange( void )
+{
+  //The pin stays low until the bar is read, so this runs once per sample
+  if( changePending == 0 )
+  {
+    changeTime = micros();
+    changeCount = countSource ? countSource() : 0;
+    changePending = 1;
+  }
+}
+
+uint8_t SensorBar::updateSample( void )
+{
+  if( takeChange() == 0 )
+  {
+    return 0;
+  }
+  addSample( readByte( SENSORBAR_DATA_REGISTER ) );
+  return 1;
+}
+
+uint8_t SensorBar::takeChange( void )
+{
+  if( changeTaken == 1 )
+  {
+    return 0; //The read of the last change is still to come, and it will see this one too
+  }
+  if( changePending == 0 )
+  {
+    if( digitalRead(pinInterrupt) == HIGH )
+    {
+      return 0; //No change, no bus traffic
+    }
+    markChange(); //No ISR attached, the change is stamped now
+  }
+  SensorBarSample &sample = samples[sampleHead];
+  noInterrupts();
+  sample.time = changeTime;
+  sample.count = changeCount;
+  changePending = 0;
+  interrupts();
+  //A change from here on is in the read, or pulls the pin low again once the read clears it
+  changeTaken = 1;
+  return 1;
+}
+
+void SensorBar::addSample( uint8_t raw )
+{
+  SensorBarSample &sample = samples[sampleHead];
+  if( invertBits == 1 )
+  {
+    raw ^= 0xFF;
+  }
+  sample.raw = raw;
+  lastBarRawValue = raw;
+  sampleHead = (sampleHead + 1) & (SENSORBAR_SAMPLES - 1);
+  samplesTaken++;
+  changeTaken = 0;
+}
+
+//The pin stays low without the read, so no new falling edge comes; the change is pending again
+void SensorBar::dropChange( void )
+{
+  noInterrupts();
+  changeTime = samples[sampleHead].time;
+  changeCount = samples[sampleHead].count;
+  changePending = 1;
+  interrupts();
+  changeTaken = 0;
+}
+
+//Samples are only written by addSample(), never from the ISR, so they can be copied as they are
+uint8_t SensorBar::getSample( uint8_t back, SensorBarSample &sample )
+{
+  if( back >= SENSORBAR_SAMPLES || back >= samplesTaken )
+  {
+    return 0;
+  }
+  sample = samples[(sampleHead - 1 - back) & (SENSORBAR_SAMPLES - 1)];
+  return 1;
+}
+
 //****************************************************************************//
 //
 //  Bar functions
@@ -308,6 +426,11 @@ uint8_t SensorBar::getDensity( void )
 //****************************************************************************//
 void SensorBar::scan( void )
 {
+  if( sampling == 1 )
+  {
+    updateSample(); //Reads the bar only if it changed since the last sample
+    return;
+  }
   if( barStrobe == 1 )
   {
     writeByte(REG_DATA_B, 0x02); //Turn on IR
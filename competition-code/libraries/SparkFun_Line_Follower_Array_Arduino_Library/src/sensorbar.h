@@ -45,6 +45,22 @@ Distributed as-is; no warranty is given.
 #define INTERNAL_CLOCK	2
 #define EXTERNAL_CLOCK	1
 
+// Samples kept while sampling on the interrupt pin; power of two
+#define SENSORBAR_SAMPLES 8
+// RegDataA, the bar bits, for reads that go around the library (see takeChange())
+#define SENSORBAR_DATA_REGISTER 0x11
+
+// Bar byte as read after a line bit changed, with when and where it changed
+struct SensorBarSample
+{
+  uint8_t raw;
+  unsigned long time; // micros() when the change was signalled
+  long count; // count source (an encoder) when the change was signalled
+};
+
+// Called from the interrupt pin's ISR, so it has to be safe there (reading an encoder count is)
+typedef long (*SensorBarCountSource)( void );
+
 class SensorBar
 {
   public:
@@ -52,6 +68,7 @@ class SensorBar
     SensorBar( uint8_t address, uint8_t resetPin = 255, uint8_t interruptPin = 255, uint8_t oscillatorPin = 255 );
     uint8_t begin( void );
     uint8_t getRaw( void );
+    uint8_t getLastRaw( void ) { return lastBarRawValue; }; //Bits of the last scan or sample, without reading the bar
     int8_t getPosition( void );
     uint8_t getDensity( void );
 	void setBarStrobe( void );
@@ -59,6 +76,27 @@ class SensorBar
 	void setInvertBits( void ); //Dark (no reflection) = 1, position returns center of dark
 	void clearInvertBits( void ); //Light (reflection) = 1, position returns center of light
 
+	//Sampling on the interrupt pin: the SX1509 pulls it low when a line bit changes, and the
+	//bar is only read then.  getRaw(), getPosition() and getDensity() return the cached sample
+	//and cost no bus traffic until the next change.  Needs interruptPin; the IR stays on.
+	//Returns 1 for success
+	uint8_t beginSampling( SensorBarCountSource countSource = 0 );
+	//Call from the ISR attached (FALLING) to the interrupt pin; stamps the change.  Without
+	//an ISR the pin is polled and a change is stamped when it is read
+	void markChange( void );
+	//Reads the bar if a change is pending; returns 1 if a new sample was taken
+	uint8_t updateSample( void );
+	//updateSample() in two halves, for reading the bar through a shared bus scheduler:
+	//takeChange() returns 1 if a change is pending and stamps the next sample, which the caller
+	//completes with addSample() and the byte read from SENSORBAR_DATA_REGISTER, or gives back
+	//with dropChange() if the read failed.  No change is taken in between, so scans read nothing
+	uint8_t takeChange( void );
+	void addSample( uint8_t raw );
+	void dropChange( void );
+	//Sample back samples before the newest; returns 0 if it was not taken yet
+	uint8_t getSample( uint8_t back, SensorBarSample &sample );
+	unsigned long getSampleCount( void ) { return samplesTaken; }; //Samples taken since beginSampling
+
 	//Functions pulled from the SX1509 driver
     void reset( void );
 	void debounceConfig( uint8_t configValue );
@@ -77,6 +115,17 @@ class SensorBar
 	uint8_t deviceAddress; // I2C Address of SX1509
 	uint8_t barStrobe; // 0 = always on, 1 = power saving by IR LED strobe
 	uint8_t invertBits; // 1 = invert
+	uint8_t sampling; // 1 = read only after the interrupt pin signals a change
+
+	//Sampling state; the stamps are written by markChange() in the ISR
+	volatile uint8_t changePending;
+	uint8_t changeTaken; // stamped into the next sample, waiting for its read
+	volatile unsigned long changeTime;
+	volatile long changeCount;
+	SensorBarCountSource countSource;
+	SensorBarSample samples[SENSORBAR_SAMPLES];
+	uint8_t sampleHead; // slot of the next sample
+	unsigned long samplesTaken;
 
     // Pin definitions:
     uint8_t pinInterrupt;
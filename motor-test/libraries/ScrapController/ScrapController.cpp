@@ -3,38 +3,41 @@
 //ScrapController::
 
 ScrapController::ScrapController() {
-	
+	initValues();
 }
 
 ScrapController::ScrapController(ScrapMotorControl& motorControl) {
+	initValues();
 	speedControl = &motorControl;
 	stop();
 }
 
 ScrapController::ScrapController(ScrapMotor& mot, ScrapEncoder& enc) {
+	initValues();
 	speedControl = new ScrapMotorControl(mot,enc);
 	stop();
 }
 
 ScrapController::ScrapController(ScrapMotor& mot, ScrapEncoder& enc, ScrapSwitch& swi) {
+	initValues();
 	attachSwitch(swi);
 	speedControl = new ScrapMotorControl(mot,enc);
 	stop();
 }
 
-// move back until switches are activated
+void ScrapController::initValues() {
+	goal = 0;
+	encTolerance = SCRAPCONTROLLER_ENCTOLERANCE;
+	slowdownThresh = SCRAPCONTROLLER_SLOWDOWNTHRESH;
+	minSlowPower = SCRAPCONTROLLER_MINSLOWPOWER;
+	minEncSpeed = SCRAPCONTROLLER_MINENCSPEED;
+	maxEncSpeed = SCRAPCONTROLLER_MAXENCSPEED;
+	profile.setLimits(SCRAPCONTROLLER_ACCEL,SCRAPCONTROLLER_JERK);
+}
+
+// move back until switches are activated; see ScrapHoming
 bool ScrapController::performReset() {
-	speedControl->stop();
-	// check if switch is pressed
-	if (resetswitch->getIfPressed()) {
-		speedControl->reset();
-		return true;
-	}
-	else {
-		speedControl->setControl(-100);
-		speedControl->performMovement();
-		return false;
-	}
+	return homing.perform(*speedControl,*resetswitch);
 }
 
 bool ScrapController::set(long g) {
@@ -43,6 +46,7 @@ bool ScrapController::set(long g) {
 }
 
 void ScrapController::stop() {
+	profile.reset();
 	speedControl->stop();
 	speedControl->performMovement();
 }
@@ -54,12 +58,8 @@ bool ScrapController::performMovement() {
 	}
 	//else, gotta do stuff
 	else {
-		if (speedControl->getCount() < goal) {
-			speedControl->setControl(calcSpeed());
-		}
-		else {
-			speedControl->setControl(-calcSpeed());
-		}
+		float target = (speedControl->getCount() < goal) ? calcSpeed() : -calcSpeed();
+		speedControl->setControl(profile.step(target));
 	}
 	speedControl->performMovement();
 	return false;
@@ -68,6 +68,10 @@ bool ScrapController::performMovement() {
 // calculate speed to give motor
 float ScrapController::calcSpeed() {
 	long diff = getDiff();
+	// full speed until stopping takes all of the distance left
+	if (profile.getIfEnabled()) {
+		return profile.getIfBraking(goal - speedControl->getCount()) ? 0 : maxEncSpeed;
+	}
 	return speedControl->mapFloat(diff,1,slowdownThresh,minEncSpeed,maxEncSpeed);
 }
 
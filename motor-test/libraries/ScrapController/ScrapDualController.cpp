@@ -3,22 +3,25 @@
 //ScrapDualController::
 
 ScrapDualController::ScrapDualController() {
-
+	initValues();
 }
 
 ScrapDualController::ScrapDualController(ScrapMotorControl& motorControl1, ScrapMotorControl& motorControl2) {
+	initValues();
 	speedControl1 = &motorControl1;
 	speedControl2 = &motorControl2;
 	stop();
 }
 
 ScrapDualController::ScrapDualController(ScrapMotor& mot1, ScrapMotor& mot2, ScrapEncoder& enc1, ScrapEncoder& enc2) {
+	initValues();
 	speedControl1 = new ScrapMotorControl(mot1,enc1);
 	speedControl2 = new ScrapMotorControl(mot2,enc2);
 	stop();
 }
 
 ScrapDualController::ScrapDualController(ScrapMotor& mot1, ScrapMotor& mot2, ScrapEncoder& enc1, ScrapEncoder& enc2, ScrapSwitch& swi1, ScrapSwitch& swi2) {
+	initValues();
 	speedControl1 = new ScrapMotorControl(mot1,enc1);
 	speedControl2 = new ScrapMotorControl(mot2,enc2);
 	attachSwitch1(swi1);
@@ -26,33 +29,19 @@ ScrapDualController::ScrapDualController(ScrapMotor& mot1, ScrapMotor& mot2, Scr
 	stop();
 }
 
-// move back until switches are activated
+// values shared with ScrapControllerInterface
+void ScrapDualController::initValues() {
+	encTolerance = SCRAPDUALCONTROLLER_ENCTOLERANCE;
+	minEncSpeed = SCRAPDUALCONTROLLER_MINENCSPEED;
+	maxEncSpeed = SCRAPDUALCONTROLLER_MAXENCSPEED;
+	setProfile(SCRAPDUALCONTROLLER_ACCEL,SCRAPDUALCONTROLLER_JERK);
+}
+
+// move back until switches are activated; each wheel homes on its own switch, see ScrapHoming
 bool ScrapDualController::performReset() {
-	speedControl1->stop();
-	speedControl2->stop();
-	// check if both switches are pressed
-	if (switch1->getIfPressed() && switch2->getIfPressed()) {
-		speedControl1->reset();
-		speedControl2->reset();
-		return true;
-	}
-	else {
-		if (switch1->getIfPressed()) {
-			speedControl1->setSpeed(0);
-		}
-		else {
-			speedControl1->setControl(-100);
-		}
-		if (switch2->getIfPressed()) {
-			speedControl2->setSpeed(0);
-		}
-		else {
-			speedControl2->setControl(-100);
-		}
-		speedControl1->performMovement();
-		speedControl2->performMovement();
-		return false;
-	}
+	bool done1 = homing1.perform(*speedControl1,*switch1);
+	bool done2 = homing2.perform(*speedControl2,*switch2);
+	return done1 && done2;
 }
 
 bool ScrapDualController::set(long g1, long g2) {
@@ -79,26 +68,20 @@ bool ScrapDualController::performMovement() {
 	}
 	//else, gotta do stuff
 	if (checkIfDone1()) {
+		profile1.reset();
 		speedControl1->stop();
 	}
 	else {
-		if (speedControl1->getCount() < goal1) {
-			speedControl1->setControl(calcSpeed1());
-		}
-		else {
-			speedControl1->setControl(-calcSpeed1());
-		}
+		float target = (speedControl1->getCount() < goal1) ? calcSpeed1() : -calcSpeed1();
+		speedControl1->setControl(profile1.step(target));
 	}
 	if (checkIfDone2()) {
+		profile2.reset();
 		speedControl2->stop();
 	}
 	else {
-		if (speedControl2->getCount() < goal2) {
-			speedControl2->setControl(calcSpeed2());
-		}
-		else {
-			speedControl2->setControl(-calcSpeed2());
-		}
+		float target = (speedControl2->getCount() < goal2) ? calcSpeed2() : -calcSpeed2();
+		speedControl2->setControl(profile2.step(target));
 	}
 	// based on separation, balance speed of each motor
 	balanceSpeed();
@@ -117,12 +100,18 @@ bool ScrapDualController::checkIfNoSpeed() {
 // calculate speed to give motor
 float ScrapDualController::calcSpeed1() {
 	long diff = getDiff1();
+	if (profile1.getIfEnabled()) {
+		return profile1.getIfBraking(goal1 - speedControl1->getCount()) ? 0 : maxEncSpeed;
+	}
 	return speedControl1->mapFloat(diff,1,slowdownThresh1,minEncSpeed,maxEncSpeed);
 }
 
 // calculate speed to give motor
 float ScrapDualController::calcSpeed2() {
 	long diff = getDiff2();
+	if (profile2.getIfEnabled()) {
+		return profile2.getIfBraking(goal2 - speedControl2->getCount()) ? 0 : maxEncSpeed;
+	}
 	return speedControl2->mapFloat(diff,1,slowdownThresh2,minEncSpeed,maxEncSpeed);
 }
 
@@ -135,6 +124,8 @@ long ScrapDualController::getDiff2() {
 }
 
 void ScrapDualController::stop() {
+	profile1.reset();
+	profile2.reset();
 	speedControl1->stop();
 	speedControl2->stop();
 }
@@ -150,24 +141,30 @@ void ScrapDualController::decrementSpeed(float speedDiff) {
 	speedControl2->decrementSpeed(speedDiff);
 }
 
+long ScrapDualController::getCount() {
+	ScrapEncoderPairSnapshot snapshot;
+	ScrapEncoderInterface::getSnapshot(speedControl1->getEncoder(),speedControl2->getEncoder(),snapshot);
+	return (snapshot.count1+snapshot.count2)/2;
+}
+
+/*
+Cross coupling: the difference in distance left is the position error between the wheels, and a speed
+proportional to it moves from the leading wheel to the lagging one, on top of each wheel's own goal.
+Both counts come from the same instant, so an edge between two reads does not show up as error.
+*/
 void ScrapDualController::balanceSpeed() {
-	float common_speed;
-	// if 1 too far ahead, balance power towards 2
-	if (abs((speedControl1->getCount() - speedControl2->getCount())*speedControl1->getDirection()) >= diffTolerance) {
-		moveSpeedToward2(speedBalance);
-	}
-	// if 2 too far ahead, balance power towards 1
-	else if (abs((speedControl1->getCount() - speedControl2->getCount())*speedControl1->getDirection()) <= -diffTolerance) {
-		moveSpeedToward1(speedBalance);
-	}
-	// otherwise, make speeds match if possible
-	else {
-		if (speedControl1->getSpeedGoal() != 0 && speedControl1->getSpeedGoal() != 0) {
-			common_speed = (speedControl1->getSpeedGoal() + speedControl2->getSpeedGoal())/2.0;
-			speedControl1->setSpeed(common_speed);
-			speedControl2->setSpeed(common_speed);
-		}
+	// a wheel that is done stays stopped
+	if (checkIfDone1() || checkIfDone2()) {
+		return;
 	}
+	ScrapEncoderPairSnapshot snapshot;
+	ScrapEncoderInterface::getSnapshot(speedControl1->getEncoder(),speedControl2->getEncoder(),snapshot);
+	// positive when wheel 1 is behind
+	long syncError = abs(goal1 - snapshot.count1) - abs(goal2 - snapshot.count2);
+	float correction = speedControl1->constrainFloat(syncGain*syncError,-maxSync,maxSync);
+	// the lagging wheel may go past maxEncSpeed by up to maxSync, so both wheels do not have to slow down
+	speedControl1->setSpeed(max(0.0f,speedControl1->getSpeedGoal()+correction));
+	speedControl2->setSpeed(max(0.0f,speedControl2->getSpeedGoal()-correction));
 }
 
 // balance speed
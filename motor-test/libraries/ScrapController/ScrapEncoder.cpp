@@ -1,9 +1,20 @@
 #include "ScrapController.h"
 
+// count change for each (previous AB, current AB) pair, indexed by previous << 2 | current;
+// forward is 00 -> 01 -> 11 -> 10, SCRAPENCODER_MISSED marks a skipped state
+#define SCRAPENCODER_MISSED 2
+static const int8_t QUADRATURE_STEPS[16] = {
+	0, 1, -1, SCRAPENCODER_MISSED,
+	-1, 0, SCRAPENCODER_MISSED, 1,
+	1, SCRAPENCODER_MISSED, 0, -1,
+	SCRAPENCODER_MISSED, -1, 1, 0
+};
 
-ScrapEncoder::ScrapEncoder(int pinA, int pinB) {
+
+ScrapEncoder::ScrapEncoder(int pinA, int pinB, bool flip) {
 	PINA_INTERRUPT = pinA;
 	PINB_CHECKER = pinB;
+	flipped = flip;
 	initEncoder();
 }
 
@@ -11,50 +22,156 @@ ScrapEncoder::ScrapEncoder(int pinA, int pinB) {
 void ScrapEncoder::initEncoder() {
 	pinMode(PINA_INTERRUPT,INPUT);
 	pinMode(PINB_CHECKER,INPUT);
-	resetCount();
+	portA = portInputRegister(digitalPinToPort(PINA_INTERRUPT));
+	portB = portInputRegister(digitalPinToPort(PINB_CHECKER));
+	maskA = digitalPinToBitMask(PINA_INTERRUPT);
+	maskB = digitalPinToBitMask(PINB_CHECKER);
+	prevState = readState();
+	// no interrupt is attached yet, and a global encoder is built before interrupts may be turned on
+	encCount = 0;
+	markCountSet();
 }
 
-// call to get count
+// call to get count; read like a snapshot, so an edge in the middle cannot tear it
 long ScrapEncoder::getCount() {
-	return encCount;
+	return readCount();
 }
 
 // reset encCount to 0
 void ScrapEncoder::resetCount() {
-	encCount = 0;
+	setCount(0);
 }
 
+// the interrupt also writes the count and the sequence, so both are changed with it held off
 void ScrapEncoder::setCount(long newCount) {
+	noInterrupts();
 	encCount = newCount;
+	markCountSet();
+	interrupts();
 }
 
 
-// for some reason one encoder does not like this
-// therefore, rest in peace. currently deprecated
+// on an A edge, A == B means forward
 void ScrapEncoder::checkEncoder() {
-	if (digitalRead(PINA_INTERRUPT) == digitalRead(PINB_CHECKER)) {
-		incrementCount();
+	uint8_t state = readState();
+	prevState = state;
+	if (state == 0 || state == 3) {
+		encCount++;
 	}
 	else {
-		decrementCount();
+		encCount--;
 	}
+	markEdge();
 }
 
 void ScrapEncoder::checkEncoderFlipped() {
-	if (digitalRead(PINA_INTERRUPT) == digitalRead(PINB_CHECKER)) {
-		decrementCount();
+	uint8_t state = readState();
+	prevState = state;
+	if (state == 0 || state == 3) {
+		encCount--;
 	}
 	else {
-		incrementCount();
+		encCount++;
+	}
+	markEdge();
+}
+
+void ScrapEncoder::update() {
+	uint8_t state = readState();
+	int8_t step = QUADRATURE_STEPS[(prevState << 2) | state];
+	prevState = state;
+	if (step == SCRAPENCODER_MISSED) {
+		// an edge was lost; the direction is unknown, so leave the count alone
+		errorCount++;
+	}
+	else if (step != 0) {
+		if (flipped) {
+			encCount -= step;
+		}
+		else {
+			encCount += step;
+		}
+		markEdge();
 	}
 }
 
 // call to increment count
 void ScrapEncoder::incrementCount() {
 	encCount++;
+	markEdge();
 }
 
 // call to decrement count
 void ScrapEncoder::decrementCount() {
 	encCount--;
+	markEdge();
+}
+
+
+// the encoder interrupt cannot be interrupted by the reader, so if the sequence is the same
+// before and after the loads, no edge landed in between and nothing is torn
+void ScrapEncoderInterface::getSnapshot(ScrapEncoderSnapshot& snapshot) {
+	uint8_t sequence;
+	do {
+		sequence = edgeSequence;
+		SCRAP_PREEMPTION_POINT();
+		snapshot.count = encCount;
+		SCRAP_PREEMPTION_POINT();
+		snapshot.edgeTime = edgeTime;
+		SCRAP_PREEMPTION_POINT();
+		snapshot.time = micros();
+		SCRAP_PREEMPTION_POINT();
+	} while (sequence != edgeSequence);
+}
+
+long ScrapEncoderInterface::readCount() {
+	uint8_t sequence;
+	long count;
+	do {
+		sequence = edgeSequence;
+		SCRAP_PREEMPTION_POINT();
+		count = encCount;
+		SCRAP_PREEMPTION_POINT();
+	} while (sequence != edgeSequence);
+	return count;
+}
+
+void ScrapEncoderInterface::getSnapshot(ScrapEncoderInterface& enc1, ScrapEncoderInterface& enc2, ScrapEncoderPairSnapshot& snapshot) {
+	uint8_t sequence1;
+	uint8_t sequence2;
+	do {
+		sequence1 = enc1.edgeSequence;
+		SCRAP_PREEMPTION_POINT();
+		sequence2 = enc2.edgeSequence;
+		SCRAP_PREEMPTION_POINT();
+		snapshot.count1 = enc1.encCount;
+		SCRAP_PREEMPTION_POINT();
+		snapshot.edgeTime1 = enc1.edgeTime;
+		SCRAP_PREEMPTION_POINT();
+		snapshot.count2 = enc2.encCount;
+		SCRAP_PREEMPTION_POINT();
+		snapshot.edgeTime2 = enc2.edgeTime;
+		SCRAP_PREEMPTION_POINT();
+		snapshot.time = micros();
+		SCRAP_PREEMPTION_POINT();
+	} while (sequence1 != enc1.edgeSequence || sequence2 != enc2.edgeSequence);
+}
+
+// the interrupt only writes the slot at the head, so reading an older slot is safe unless the ring
+// laps it during the read; the sequence check throws that away like a torn snapshot
+bool ScrapEncoderInterface::getEdge(uint8_t back, long& count, unsigned long& time) {
+	uint8_t sequence;
+	bool found;
+	do {
+		sequence = edgeSequence;
+		SCRAP_PREEMPTION_POINT();
+		found = back < edgeFilled;
+		uint8_t slot = (edgeHead - 1 - back) & (SCRAPENCODER_EDGES - 1);
+		SCRAP_PREEMPTION_POINT();
+		count = edgeCounts[slot];
+		SCRAP_PREEMPTION_POINT();
+		time = edgeTimes[slot];
+		SCRAP_PREEMPTION_POINT();
+	} while (sequence != edgeSequence);
+	return found;
 }
@@ -11,7 +11,8 @@
 
 
 
-ScrapEncoder encoderL = ScrapEncoder(ENCODER_LEFT_INT,ENCODER_LEFT_DIG);
+// left encoder is mounted mirrored, so it counts the other way
+ScrapEncoder encoderL = ScrapEncoder(ENCODER_LEFT_INT,ENCODER_LEFT_DIG,true);
 ScrapEncoder encoderR = ScrapEncoder(ENCODER_RIGHT_INT,ENCODER_RIGHT_DIG);
 
 
@@ -32,30 +33,37 @@ unsigned long previousTime;
 void setup() {
 	motorControlL.setMinPower(35);
 	motorControlR.setMinPower(45);
-	motorControlL.setMinSpeed(160);
-	motorControlL.setMaxSpeed(1800);
-	motorControlR.setMinSpeed(160);
-	motorControlR.setMaxSpeed(1800);
+	// speeds are in 4x counts (every edge of both channels), twice the 2x numbers;
+	// the default gains are tuned for 2x counts, so halve them
+	motorControlL.setGains(SCRAPMOTORCONTROL_KP/2,SCRAPMOTORCONTROL_KI/2);
+	motorControlR.setGains(SCRAPMOTORCONTROL_KP/2,SCRAPMOTORCONTROL_KI/2);
+	motorControlL.setMinSpeed(320);
+	motorControlL.setMaxSpeed(3600);
+	motorControlR.setMinSpeed(320);
+	motorControlR.setMaxSpeed(3600);
 	initEncoders();
 	//motorControlL.stop();
 	//motorControlR.stop();
-	motorControlL.setControl(1800);
-	motorControlR.setControl(1800);
+	motorControlL.setControl(3600);
+	motorControlR.setControl(3600);
 	motorControlL.stop();
 	motorControlR.stop();
+	// speed control runs from a timer interrupt from here on
+	ScrapScheduler::add(motorControlL);
+	ScrapScheduler::add(motorControlR);
+	ScrapScheduler::begin();
 	Serial.begin(9600);
 	unsigned long previousTime = millis();
 }
 
 void loop() {
-	delay(2);
-	motorControlL.performMovement();
-	motorControlR.performMovement();
 	currentTime = millis();
 	if (currentTime-previousTime > 1000) {
 		Serial.print(encoderL.getCount());
 		Serial.print("\t");
 		Serial.println(encoderR.getCount());
+		ScrapScheduler::printStats();
+		ScrapScheduler::resetStats();
 		previousTime = currentTime;
 	}
 
@@ -75,13 +83,15 @@ void loopOLD() {
 
 void initEncoders() {
 	attachInterrupt(digitalPinToInterrupt(ENCODER_LEFT_INT),checkEncoderL,CHANGE);
+	attachInterrupt(digitalPinToInterrupt(ENCODER_LEFT_DIG),checkEncoderL,CHANGE);
 	attachInterrupt(digitalPinToInterrupt(ENCODER_RIGHT_INT),checkEncoderR,CHANGE);
+	attachInterrupt(digitalPinToInterrupt(ENCODER_RIGHT_DIG),checkEncoderR,CHANGE);
 }
 
 void checkEncoderL() {
-	encoderL.checkEncoderFlipped();
+	encoderL.update();
 }
 
 void checkEncoderR() {
-	encoderR.checkEncoder();
+	encoderR.update();
 }
@@ -2,6 +2,7 @@
 #define SCRAPCONTROLLER_H
 #include "Arduino.h"
 #include "ScrapDefinitions.h"
+#include "ScrapFixed.h"
 
 
 // abstract classes (interfaces)
@@ -24,11 +25,58 @@ class ScrapMotorInterface {
 };
 
 
+// encoder count and the time of its last edge, read together
+struct ScrapEncoderSnapshot {
+	long count;
+	unsigned long edgeTime; // micros() at the last counted edge
+	unsigned long time; // micros() when the snapshot was taken
+};
+
+// both encoders of a pair read at the same instant
+struct ScrapEncoderPairSnapshot {
+	long count1;
+	long count2;
+	unsigned long edgeTime1;
+	unsigned long edgeTime2;
+	unsigned long time;
+};
+
+
 class ScrapEncoderInterface {
 	protected:
 		volatile long encCount;
+		volatile unsigned long edgeTime = 0; // micros() at the last counted edge
+		// bumped after every change of the count, so snapshot readers can tell they were interrupted
+		volatile uint8_t edgeSequence = 0;
+		// ring of the last edges, written only by the encoder interrupt
+		volatile unsigned long edgeTimes[SCRAPENCODER_EDGES];
+		volatile long edgeCounts[SCRAPENCODER_EDGES];
+		volatile uint8_t edgeHead = 0; // slot of the next edge
+		volatile uint8_t edgeFilled = 0; // edges in the ring since the count was last set
 		virtual void initEncoder() = 0;
+		void markEdge() {
+			unsigned long now = micros();
+			uint8_t slot = edgeHead;
+			edgeTime = now;
+			edgeTimes[slot] = now;
+			edgeCounts[slot] = encCount;
+			edgeHead = (slot + 1) & (SCRAPENCODER_EDGES - 1);
+			if (edgeFilled < SCRAPENCODER_EDGES) {
+				edgeFilled++;
+			}
+			edgeSequence++;
+		};
+		// edges before a set count are not comparable; call with interrupts off, the encoder interrupt bumps the sequence too
+		void markCountSet() { edgeFilled = 0; edgeSequence++; };
+		long readCount(); // the count alone, with the same sequence check as getSnapshot
 	public:
+		// consistent count and edge time without turning interrupts off; the count is read
+		// one byte at a time on the AVR, so reading encCount directly from outside the encoder interrupt can tear
+		void getSnapshot(ScrapEncoderSnapshot& snapshot);
+		static void getSnapshot(ScrapEncoderInterface& enc1, ScrapEncoderInterface& enc2, ScrapEncoderPairSnapshot& snapshot);
+		// count and time of the edge back edges before the newest one;
+		// false if it was not recorded since the count was last set
+		bool getEdge(uint8_t back, long& count, unsigned long& time);
 		virtual long getCount() = 0;
 		virtual void resetCount() = 0;
 		virtual void setCount(long newCount) = 0;
@@ -87,16 +135,29 @@ class ScrapEncoder: public ScrapEncoderInterface {
 	protected:
 		int PINA_INTERRUPT;
 		int PINB_CHECKER;
+		bool flipped = false; // update() counts the other way
+		// cached input registers and bit masks, so interrupts do not go through digitalRead
+		volatile uint8_t* portA;
+		volatile uint8_t* portB;
+		uint8_t maskA;
+		uint8_t maskB;
+		uint8_t prevState = 0; // last reading, A in bit 1 and B in bit 0
+		volatile unsigned long errorCount = 0; // transitions where both channels changed at once
 		virtual void initEncoder();
+		uint8_t readState() { return ((*portA & maskA) ? 2 : 0) | ((*portB & maskB) ? 1 : 0); };
 	public:
-		ScrapEncoder(int pinA, int pinB);
+		ScrapEncoder(int pinA, int pinB, bool flip = false);
 		virtual long getCount();
 		virtual void resetCount();
 		virtual void setCount(long newCount);
 		virtual void incrementCount();
 		virtual void decrementCount();
+		// 2x decoding: attach to CHANGE on pin A only
 		virtual void checkEncoder();
 		virtual void checkEncoderFlipped();
+		// 4x decoding: attach to CHANGE on both pins
+		void update();
+		unsigned long getErrorCount() { return errorCount; };
 };
 
 
@@ -104,18 +165,29 @@ class ScrapMotorControl {
 	/*
 	Speed is stored as Encoder Value Change PER Second
 	MicroSpeed is stored as Encoder Value Change PER Microsecond
+	Power is set by a PID loop in Q16.16 fixed point; see performMovement
 	*/
 	protected:
 		unsigned long prevTime = 0; // time of previous speed calculation
-		float prevSpeed = 0.0; // previously-calculated speed
-		float speedGoal = 0.0; // speed to reach
+		unsigned long prevInterval = 0; // time (us) between the last two speed calculations
+		long prevSpeed = 0; // previously-calculated speed
+		long speedGoal = 0; // speed to reach
 		long prevCount = 0; // previous encoder count
+		unsigned long prevEdgeTime = 0; // time of the edge the previous speed was measured to
+		long prevEdgeCount = 0; // count at that edge
 		int minPower = 0; // minimum power to get motor to move
 		float minSpeed;
 		float maxSpeed;
+		// PID state, all Q16.16
+		q16_t kp = Q16(SCRAPMOTORCONTROL_KP);
+		q16_t ki = Q16(SCRAPMOTORCONTROL_KI);
+		q16_t kd = Q16(SCRAPMOTORCONTROL_KD);
+		q16_t integral = 0; // integrated error times ki, in PWM
+		int goalDirection = 1; // direction given to the last setControl
 		ScrapMotorInterface* motor; // motor
 		ScrapEncoderInterface* encoder; // encoder
-		float calcSpeed(); // calculates speed and updates relevant time
+		long calcSpeed(); // calculates speed and updates relevant time
+		static long scaleSpeed(unsigned long counts, unsigned long time); // counts over time (us) in counts/s
 	public:
 		ScrapMotorControl();
 		ScrapMotorControl(ScrapMotorInterface& mot, ScrapEncoderInterface& enc);
@@ -129,6 +201,8 @@ class ScrapMotorControl {
 		void setMaxSpeed(float newMax) { maxSpeed = newMax; };
 		// set min motor power
 		void setMinPower(int power) { minPower = power; };
+		// set PID gains; see SCRAPMOTORCONTROL_KP for units
+		void setGains(float newKp, float newKi, float newKd = 0);
 		// change speed
 		void incrementSpeed(float speedDiff);
 		void decrementSpeed(float speedDiff);
@@ -141,6 +215,7 @@ class ScrapMotorControl {
 		void stop();
 		// get/set encoder count
 		long getCount() { return encoder->getCount(); };
+		ScrapEncoderInterface& getEncoder() { return *encoder; };
 		void setCount(long count) { encoder->setCount(count); };
 		void resetCount() { encoder->resetCount(); };
 		// get motor direction
@@ -150,7 +225,7 @@ class ScrapMotorControl {
 		float getSpeedGoal() { return speedGoal; }; // return speed goal
 		// get time of previous reading
 		unsigned long getTime();
-		// perform movement, incrementing speed/power/time
+		// perform movement, updating speed/power/time
 		void performMovement();
 		// attach motor/encoder
 		void attachMotor(ScrapMotorInterface& mot) { motor = &mot; };
@@ -175,6 +250,62 @@ class ScrapSwitch {
 };
 
 
+// homing phases
+#define SCRAPHOMING_IDLE 0
+#define SCRAPHOMING_FAST 1 // driving toward the switch at the fast speed
+#define SCRAPHOMING_BACKOFF 2 // found it; backing away until it lets go
+#define SCRAPHOMING_SLOW 3 // creeping back onto it for the precise zero
+#define SCRAPHOMING_DONE 4
+
+// ScrapHoming: homes one axis onto its switch; call perform() every control step until it returns true
+class ScrapHoming {
+	private:
+		uint8_t phase = SCRAPHOMING_IDLE;
+		float fastSpeed = SCRAPHOMING_FASTSPEED;
+		float slowSpeed = SCRAPHOMING_SLOWSPEED;
+		float backoffSpeed = SCRAPHOMING_BACKOFFSPEED;
+		long backoffCount = SCRAPHOMING_BACKOFFCOUNT;
+		long releaseCount = 0; // last count the switch was still pressed at while backing off
+		unsigned long startTime = 0;
+		unsigned long duration = 0; // us the last homing took
+	public:
+		bool perform(ScrapMotorControl& control, ScrapSwitch& swi); // true once homed; the count is then 0
+		uint8_t getPhase() { return phase; };
+		bool getIfDone() { return phase == SCRAPHOMING_DONE; };
+		unsigned long getDuration() { return duration; };
+		void setSpeeds(float fast, float slow) { fastSpeed = fast; slowSpeed = slow; };
+		void setBackoff(long counts, float speed) { backoffCount = counts; backoffSpeed = speed; };
+};
+
+
+// ScrapProfile: limits how fast a speed command may change, in acceleration and in jerk (the change of
+// acceleration); jerk 0 gives a trapezoidal profile, acceleration 0 passes commands straight through
+class ScrapProfile {
+	private:
+		float speed = 0; // counts/s, signed
+		float accel = 0; // counts/s^2, signed
+		float maxAccel = 0;
+		float jerk = 0; // counts/s^3
+		float lag = SCRAPPROFILE_LAG; // s the wheel trails the profile by
+		float overrun = SCRAPPROFILE_OVERRUN; // counts the wheel coasts on once the profile has stopped
+		// from the limits, worked out in setLimits so the control interrupt does not divide
+		float invAccel = 0; // 1/maxAccel
+		float invJerk = 0; // 1/jerk
+		float rampSpeed = 0; // speed change while ramping full acceleration in and out, maxAccel^2/jerk
+		unsigned long prevTime = 0;
+	public:
+		float step(float target); // moves the speed toward target by the time since the last step; returns it
+		float getStopDistance(); // counts the profile covers before it can come to rest
+		bool getIfBraking(long remaining); // true once stopping takes all of the remaining counts (signed) toward a goal
+		void reset() { speed = 0; accel = 0; prevTime = 0; };
+		void setLimits(float newAccel, float newJerk);
+		void setLag(float newLag) { lag = newLag; };
+		bool getIfEnabled() { return maxAccel > 0; };
+		float getSpeed() { return speed; };
+		float getAccel() { return accel; };
+};
+
+
 class ScrapControllerInterface {
 	protected:
 		long goal;
@@ -215,7 +346,10 @@ class ScrapController: public ScrapControllerInterface  {
 	protected:
 		ScrapSwitch* resetswitch;
 		ScrapMotorControl* speedControl;
+		ScrapHoming homing;
+		ScrapProfile profile;
 		virtual float calcSpeed();
+		void initValues();
 	public:
 		ScrapController();
 		ScrapController(ScrapMotorControl& motorControl);
@@ -239,6 +373,12 @@ class ScrapController: public ScrapControllerInterface  {
 		virtual bool performMovement();
 		virtual void performSpeedMovement() { speedControl->performMovement(); };
 		virtual bool performReset();
+		// homing speeds (counts/s) and time (us) the last reset took
+		void setHomingSpeeds(float fast, float slow) { homing.setSpeeds(fast,slow); };
+		void setHomingBackoff(long counts, float speed) { homing.setBackoff(counts,speed); };
+		unsigned long getHomingTime() { return homing.getDuration(); };
+		// acceleration (counts/s^2) and jerk (counts/s^3) limits; acceleration 0 uses the slowdown threshold instead
+		void setProfile(float accel, float jerk) { profile.setLimits(accel,jerk); };
 		// attach components
 		void attachSwitch(ScrapSwitch& swi) { resetswitch = &swi; };
 };
@@ -246,23 +386,28 @@ class ScrapController: public ScrapControllerInterface  {
 
 class ScrapDualController: public ScrapControllerInterface {
 	protected:
-		long goal1;
-		long goal2;
-		long diffTolerance;
-		long encTolerance1;
-		long encTolerance2;
-		long slowdownThresh1;
-		long slowdownThresh2;
-		int minSlowPower1;
-		int minSlowPower2;
-		float speedBalance; // speed to increment/decrement to balance motors
+		long goal1 = 0;
+		long goal2 = 0;
+		long encTolerance1 = SCRAPDUALCONTROLLER_ENCTOLERANCE;
+		long encTolerance2 = SCRAPDUALCONTROLLER_ENCTOLERANCE;
+		long slowdownThresh1 = SCRAPDUALCONTROLLER_SLOWDOWNTHRESH1;
+		long slowdownThresh2 = SCRAPDUALCONTROLLER_SLOWDOWNTHRESH2;
+		int minSlowPower1 = SCRAPDUALCONTROLLER_MINSLOWPOWER1;
+		int minSlowPower2 = SCRAPDUALCONTROLLER_MINSLOWPOWER2;
+		float syncGain = SCRAPDUALCONTROLLER_SYNCGAIN; // speed moved toward the lagging wheel per count it is behind
+		float maxSync = SCRAPDUALCONTROLLER_MAXSYNC; // most speed moved between the wheels
 		ScrapSwitch* switch1;
 		ScrapSwitch* switch2;
 		ScrapMotorControl* speedControl1;
 		ScrapMotorControl* speedControl2;
+		ScrapHoming homing1;
+		ScrapHoming homing2;
+		ScrapProfile profile1;
+		ScrapProfile profile2;
 		virtual float calcSpeed1();
 		virtual float calcSpeed2();
 		virtual float calcSpeed() { return (calcSpeed1() + calcSpeed2())/2.0; }; 
+		void initValues();
 	public:
 		ScrapDualController();
 		ScrapDualController(ScrapMotorControl& motorControl1, ScrapMotorControl& motorControl2);
@@ -296,12 +441,18 @@ class ScrapDualController: public ScrapControllerInterface {
 		// get encoder count
 		long getCount1() { return speedControl1->getCount(); };
 		long getCount2() { return speedControl2->getCount(); };
-		long getCount() { return (getCount1()+getCount2())/2; }; //returns average of encoder counts
+		long getCount(); //returns average of encoder counts
 		void resetCount() { speedControl1->resetCount(); speedControl2->resetCount();};
 		// perform movement or reset
 		bool performMovement();
 		void performSpeedMovement() { speedControl1->performMovement(); speedControl2->performMovement(); };
 		bool performReset();
+		// homing speeds (counts/s) for both wheels, and time (us) the last reset took
+		void setHomingSpeeds(float fast, float slow) { homing1.setSpeeds(fast,slow); homing2.setSpeeds(fast,slow); };
+		void setHomingBackoff(long counts, float speed) { homing1.setBackoff(counts,speed); homing2.setBackoff(counts,speed); };
+		unsigned long getHomingTime() { return max(homing1.getDuration(),homing2.getDuration()); };
+		// acceleration (counts/s^2) and jerk (counts/s^3) limits for both wheels; acceleration 0 uses the slowdown thresholds instead
+		void setProfile(float accel, float jerk) { profile1.setLimits(accel,jerk); profile2.setLimits(accel,jerk); };
 		// balance motor speeds
 		void moveSpeedToward1(float speedDiff);
 		void moveSpeedToward2(float speedDiff);
@@ -310,7 +461,8 @@ class ScrapDualController: public ScrapControllerInterface {
 		void attachSwitch1(ScrapSwitch& swi) { switch1 = &swi; };
 		void attachSwitch2(ScrapSwitch& swi) { switch2 = &swi; };
 		// set values
-		virtual void setDiffTolerance(long tolerance) { diffTolerance = tolerance; };
+		virtual void setSyncGain(float gain) { syncGain = gain; };
+		virtual void setMaxSync(float speed) { maxSync = speed; };
 		virtual void setEncTolerance1(long tolerance) { encTolerance1 = tolerance; };
 		virtual void setEncTolerance2(long tolerance) { encTolerance2 = tolerance; };
 		virtual void setEncTolerance(long tolerance) { setEncTolerance1(tolerance); setEncTolerance2(tolerance); };
@@ -323,6 +475,21 @@ class ScrapDualController: public ScrapControllerInterface {
 };
 
 
+// one straight move of the ScrapFullController motion queue, in encoder counts
+struct ScrapSegment {
+	long startX;
+	long startY;
+	long endX;
+	long endY;
+	float length;
+	float dirX; // unit direction
+	float dirY;
+	float speed; // requested path speed (counts/s)
+	float entrySpeed; // planned path speed at the start
+	float maxEntrySpeed; // fastest the corner with the previous segment can be taken
+};
+
+
 class ScrapFullController {
 	private:
 		ScrapController* xControl;
@@ -330,10 +497,31 @@ class ScrapFullController {
 		float diffDecim = 0.01; // percentage diff from desired proportion
 		float desiredProportion; // x_goal/y_goal proportion
 		int encSpeedBalance = 30;
+		// motion queue: ring of segments, the oldest one is being driven
+		ScrapSegment queue[SCRAPFULLCONTROLLER_QUEUESIZE];
+		uint8_t queueHead = 0;
+		uint8_t queueLength = 0;
+		float accel = SCRAPFULLCONTROLLER_ACCEL;
+		float junctionDeviation = SCRAPFULLCONTROLLER_JUNCTIONDEV;
+		float pathGain = SCRAPFULLCONTROLLER_PATHGAIN;
+		ScrapSegment& getSegment(uint8_t i) { return queue[(queueHead + i) % SCRAPFULLCONTROLLER_QUEUESIZE]; };
+		float calcJunctionSpeed(ScrapSegment& prev, ScrapSegment& next);
+		void planQueue();
+		void setAxisSpeeds(float vx, float vy, long goalY);
 	public:
 		ScrapFullController();
 		ScrapFullController(ScrapController& xCont, ScrapDualController& yCont);
 		bool set(int gx, int gy);
+		// motion queue: moves run back to back, slowing only as much as each corner needs
+		bool queueMove(long gx, long gy, float speed = SCRAPFULLCONTROLLER_SPEED); // false if the queue is full
+		bool performQueue(); // call every control step; true once the queue is empty and the gantry stopped
+		void clearQueue();
+		uint8_t getQueueLength() { return queueLength; };
+		bool getIfQueueFull() { return queueLength == SCRAPFULLCONTROLLER_QUEUESIZE; };
+		float getPlannedSpeed(uint8_t i) { return getSegment(i).entrySpeed; }; // planned entry speed of queued segment i
+		void setAccel(float newAccel) { accel = newAccel; };
+		void setJunctionDeviation(float deviation) { junctionDeviation = deviation; };
+		void setPathGain(float gain) { pathGain = gain; };
 		int getGoalX() { return xControl->getGoal(); };
 		int getGoalY() { return yControl->getGoal(); };
 		int getCountX() { return xControl->getCount(); };
@@ -353,4 +541,61 @@ class ScrapFullController {
 };
 
 
+// timing of the scheduled control updates, all times in microseconds
+struct ScrapSchedulerStats {
+	unsigned long ticks; // updates run
+	unsigned long overruns; // updates that took longer than one period
+	unsigned long skipped; // timer ticks dropped because the previous update was still running
+	unsigned long held; // timer ticks dropped while held
+	unsigned long period; // nominal period
+	unsigned long minPeriod; // shortest time between the starts of two updates
+	unsigned long maxPeriod; // longest time between the starts of two updates
+	unsigned long meanPeriod;
+	unsigned long maxJitter; // largest difference between a period and the nominal period
+	unsigned long maxBusy; // longest update
+};
+
+
+/*
+Runs performMovement of every registered controller from a hardware timer at a fixed rate.
+AVR boards use timer 2 in CTC mode (analogWrite on the two timer 2 pins and tone() stop working);
+Teensy boards use an IntervalTimer. Other builds have no timer and call tick() themselves.
+Register a ScrapDualController or its two ScrapMotorControls, not both.
+Encoder interrupts still run during an update. Code that changes goals of scheduled controllers
+should do so between hold() and release(), so an update never sees half of a change.
+*/
+class ScrapScheduler {
+	private:
+		static ScrapMotorControl* motorControls[SCRAPSCHEDULER_MAXCONTROLS];
+		static ScrapDualController* dualControls[SCRAPSCHEDULER_MAXCONTROLS];
+		static uint8_t motorControlCount;
+		static uint8_t dualControlCount;
+		static volatile bool running;
+		static volatile bool busy;
+		static volatile bool holding;
+		// only written by tick(); read with interrupts off
+		static ScrapSchedulerStats stats;
+		static unsigned long firstStart;
+		static unsigned long lastStart;
+	public:
+		// start/stop the timer; the rate is rounded to what the timer can do, returns false if out of range
+		static bool begin(unsigned long rate = SCRAPSCHEDULER_RATE);
+		static void end();
+		static bool getIfRunning() { return running; };
+		// register controllers; false if full
+		static bool add(ScrapMotorControl& control);
+		static bool add(ScrapDualController& control);
+		static void clear();
+		// skip updates while the main code changes goals
+		static void hold() { holding = true; };
+		static void release() { holding = false; };
+		// one update of every controller; the timer interrupt calls this
+		static void tick();
+		// statistics
+		static ScrapSchedulerStats getStats();
+		static void resetStats();
+		static void printStats();
+};
+
+
 #endif
@@ -0,0 +1,185 @@
+#include "ScrapController.h"
+
+//ScrapScheduler::
+
+ScrapMotorControl* ScrapScheduler::motorControls[SCRAPSCHEDULER_MAXCONTROLS];
+ScrapDualController* ScrapScheduler::dualControls[SCRAPSCHEDULER_MAXCONTROLS];
+uint8_t ScrapScheduler::motorControlCount = 0;
+uint8_t ScrapScheduler::dualControlCount = 0;
+volatile bool ScrapScheduler::running = false;
+volatile bool ScrapScheduler::busy = false;
+volatile bool ScrapScheduler::holding = false;
+ScrapSchedulerStats ScrapScheduler::stats;
+unsigned long ScrapScheduler::firstStart = 0;
+unsigned long ScrapScheduler::lastStart = 0;
+
+#if defined(__AVR__)
+// interrupts stay enabled during the update so encoder edges are not lost; tick() guards against re-entry
+ISR(TIMER2_COMPA_vect, ISR_NOBLOCK) {
+	ScrapScheduler::tick();
+}
+#elif defined(TEENSYDUINO)
+static IntervalTimer schedulerTimer;
+#endif
+
+bool ScrapScheduler::begin(unsigned long rate) {
+	if (rate == 0) {
+		return false;
+	}
+	end();
+	resetStats();
+#if defined(__AVR__)
+	// CTC mode on timer 2: pick the smallest prescaler that fits the period in 8 bits
+	const unsigned int prescalers[] = { 1, 8, 32, 64, 128, 256, 1024 };
+	uint8_t select = 0;
+	unsigned long counts = 0;
+	while (select < 7) {
+		counts = F_CPU / (prescalers[select] * rate);
+		if (counts <= 256) {
+			break;
+		}
+		select++;
+	}
+	if (select == 7 || counts == 0) {
+		return false;
+	}
+	stats.period = counts * prescalers[select] / (F_CPU / 1000000L);
+	noInterrupts();
+	TCCR2A = _BV(WGM21);
+	TCCR2B = select + 1;
+	OCR2A = counts - 1;
+	TCNT2 = 0;
+	TIFR2 = _BV(OCF2A);
+	TIMSK2 |= _BV(OCIE2A);
+	interrupts();
+#elif defined(TEENSYDUINO)
+	stats.period = 1000000L / rate;
+	// below the default pin interrupt priority, so encoders preempt an update
+	schedulerTimer.priority(192);
+	if (!schedulerTimer.begin(tick, stats.period)) {
+		return false;
+	}
+#else
+	stats.period = 1000000L / rate;
+#endif
+	running = true;
+	return true;
+}
+
+void ScrapScheduler::end() {
+#if defined(__AVR__)
+	TIMSK2 &= ~_BV(OCIE2A);
+#elif defined(TEENSYDUINO)
+	schedulerTimer.end();
+#endif
+	running = false;
+}
+
+bool ScrapScheduler::add(ScrapMotorControl& control) {
+	if (motorControlCount >= SCRAPSCHEDULER_MAXCONTROLS) {
+		return false;
+	}
+	noInterrupts();
+	motorControls[motorControlCount++] = &control;
+	interrupts();
+	return true;
+}
+
+bool ScrapScheduler::add(ScrapDualController& control) {
+	if (dualControlCount >= SCRAPSCHEDULER_MAXCONTROLS) {
+		return false;
+	}
+	noInterrupts();
+	dualControls[dualControlCount++] = &control;
+	interrupts();
+	return true;
+}
+
+void ScrapScheduler::clear() {
+	noInterrupts();
+	motorControlCount = 0;
+	dualControlCount = 0;
+	interrupts();
+}
+
+void ScrapScheduler::tick() {
+	unsigned long start = micros();
+	if (holding) {
+		stats.held++;
+		return;
+	}
+	if (busy) {
+		stats.skipped++;
+		return;
+	}
+	busy = true;
+	// period statistics, from the start of one update to the next
+	if (stats.ticks == 0) {
+		firstStart = start;
+	}
+	else {
+		unsigned long period = start - lastStart;
+		unsigned long jitter = (period > stats.period) ? period - stats.period : stats.period - period;
+		stats.minPeriod = min(stats.minPeriod, period);
+		stats.maxPeriod = max(stats.maxPeriod, period);
+		stats.maxJitter = max(stats.maxJitter, jitter);
+	}
+	lastStart = start;
+	stats.ticks++;
+	// run the controllers
+	for (uint8_t i = 0; i < dualControlCount; i++) {
+		dualControls[i]->performMovement();
+	}
+	for (uint8_t i = 0; i < motorControlCount; i++) {
+		motorControls[i]->performMovement();
+	}
+	unsigned long duration = micros() - start;
+	stats.maxBusy = max(stats.maxBusy, duration);
+	if (duration > stats.period) {
+		stats.overruns++;
+	}
+	busy = false;
+}
+
+ScrapSchedulerStats ScrapScheduler::getStats() {
+	noInterrupts();
+	ScrapSchedulerStats copy = stats;
+	unsigned long elapsed = lastStart - firstStart;
+	interrupts();
+	copy.meanPeriod = (copy.ticks > 1) ? elapsed / (copy.ticks - 1) : 0;
+	return copy;
+}
+
+void ScrapScheduler::resetStats() {
+	noInterrupts();
+	unsigned long period = stats.period;
+	stats = ScrapSchedulerStats();
+	stats.period = period;
+	stats.minPeriod = 0xFFFFFFFF;
+	interrupts();
+}
+
+void ScrapScheduler::printStats() {
+	ScrapSchedulerStats copy = getStats();
+	Serial.print("scheduler: ");
+	Serial.print(copy.ticks);
+	Serial.print(" updates, period ");
+	Serial.print(copy.period);
+	Serial.print(" us (min ");
+	Serial.print(copy.ticks > 1 ? copy.minPeriod : 0);
+	Serial.print(", mean ");
+	Serial.print(copy.meanPeriod);
+	Serial.print(", max ");
+	Serial.print(copy.maxPeriod);
+	Serial.print("), jitter ");
+	Serial.print(copy.maxJitter);
+	Serial.print(" us, longest update ");
+	Serial.print(copy.maxBusy);
+	Serial.print(" us, ");
+	Serial.print(copy.overruns);
+	Serial.print(" overruns, ");
+	Serial.print(copy.skipped);
+	Serial.print(" skipped, ");
+	Serial.print(copy.held);
+	Serial.println(" held");
+}
@@ -13,7 +13,8 @@
 
 
 
-ScrapEncoder encoderL = ScrapEncoder(ENCODER_LEFT_INT,ENCODER_LEFT_DIG);
+// left encoder is mounted mirrored, so it counts the other way
+ScrapEncoder encoderL = ScrapEncoder(ENCODER_LEFT_INT,ENCODER_LEFT_DIG,true);
 ScrapEncoder encoderR = ScrapEncoder(ENCODER_RIGHT_INT,ENCODER_RIGHT_DIG);
 
 
@@ -40,18 +41,26 @@ void setup() {
 	lineSensor->begin();
 	motorControlL.setMinPower(35);
 	motorControlR.setMinPower(45);
-	motorControlL.setMinSpeed(160);
-	motorControlL.setMaxSpeed(1800);
-	motorControlR.setMinSpeed(160);
-	motorControlR.setMaxSpeed(1800);
+	// speeds are in 4x counts (every edge of both channels), twice the 2x numbers;
+	// the default gains are tuned for 2x counts, so halve them
+	motorControlL.setGains(SCRAPMOTORCONTROL_KP/2,SCRAPMOTORCONTROL_KI/2);
+	motorControlR.setGains(SCRAPMOTORCONTROL_KP/2,SCRAPMOTORCONTROL_KI/2);
+	motorControlL.setMinSpeed(320);
+	motorControlL.setMaxSpeed(3600);
+	motorControlR.setMinSpeed(320);
+	motorControlR.setMaxSpeed(3600);
 	initEncoders();
 	pinMode(LINESENSOR, INPUT);
 	//motorControlL.stop();
 	//motorControlR.stop();
-	motorControlL.setControl(1800);
-	motorControlR.setControl(1800);
+	motorControlL.setControl(3600);
+	motorControlR.setControl(3600);
 	motorControlL.stop();
 	motorControlR.stop();
+	// speed control runs from a timer interrupt from here on
+	ScrapScheduler::add(motorControlL);
+	ScrapScheduler::add(motorControlR);
+	ScrapScheduler::begin();
 	Serial.begin(9600);
 	unsigned long previousTime = millis();
 }
@@ -72,12 +81,15 @@ void loop() {
 }
 
 void followLineUntilPerpendicular() {
-	int normalSpeed = 1200;
+	int normalSpeed = 2400;
 	int offset = 0;
 	int last_nonzero_position = 0;
 	bool is_left = false;
+	ScrapScheduler::hold();
 	motorControlL.setControl(normalSpeed);
 	motorControlR.setControl(normalSpeed);
+	ScrapScheduler::release();
+	ScrapScheduler::resetStats();
 	while (lineSensor->getDensity() < 3) {
 		int position = lineSensor->getPosition();
 		if (position != 0) {
@@ -86,14 +98,14 @@ void followLineUntilPerpendicular() {
 		
 		//Serial.println(position);
 		if (!getIfMiddleLine()) {
-			offset = map(pow(last_nonzero_position/6,2), -127, 127, -600,600);
+			offset = map(pow(last_nonzero_position/6,2), -127, 127, -1200,1200);
 			if (last_nonzero_position < 0) {
 				offset = -offset;
 			}
 		}
 		else {
 			if (position) {
-				offset = map(pow(log(abs(last_nonzero_position))/log(2),3)/128, -1, 1, -600,600);
+				offset = map(pow(log(abs(last_nonzero_position))/log(2),3)/128, -1, 1, -1200,1200);
 				if (last_nonzero_position < 0) {
 					offset = -offset;
 				}
@@ -103,30 +115,34 @@ void followLineUntilPerpendicular() {
 			} 
 		}
 		Serial.println(offset);
+		ScrapScheduler::hold();
 		motorControlL.setControl(normalSpeed+offset);
 		motorControlR.setControl(normalSpeed-offset);
+		ScrapScheduler::release();
 		Serial.println(motorControlL.getSpeedGoal());
 		Serial.println(motorControlR.getSpeedGoal());
 		Serial.println("========");
-		motorControlL.performMovement();
-		motorControlR.performMovement();
-
 	}
-	Serial.println("DONE");
+	ScrapScheduler::hold();
 	motorControlL.stop();
 	motorControlR.stop();
+	ScrapScheduler::release();
+	Serial.println("DONE");
+	ScrapScheduler::printStats();
 }
 
 
 void initEncoders() {
 	attachInterrupt(digitalPinToInterrupt(ENCODER_LEFT_INT),checkEncoderL,CHANGE);
+	attachInterrupt(digitalPinToInterrupt(ENCODER_LEFT_DIG),checkEncoderL,CHANGE);
 	attachInterrupt(digitalPinToInterrupt(ENCODER_RIGHT_INT),checkEncoderR,CHANGE);
+	attachInterrupt(digitalPinToInterrupt(ENCODER_RIGHT_DIG),checkEncoderR,CHANGE);
 }
 
 void checkEncoderL() {
-	encoderL.checkEncoderFlipped();
+	encoderL.update();
 }
 
 void checkEncoderR() {
-	encoderR.checkEncoder();
+	encoderR.update();
 }
@@ -0,0 +1,116 @@
+// generates BoardTableData.h from the Gameboard pointer graph
+// usage: BoardTable_Generator > libraries/Navigation/BoardTableData.h
+// (copy the result to competition-code/libraries/Navigation as well)
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Gameboard.h"
+#include "BoardTable.h"
+
+const int ROUNDS = 4;
+
+int stateId(IntersectionState* state) {
+    return state ? state->getId() : BOARD_NO_STATE;
+}
+
+/** state id as table text, unreachable states are written as BOARD_NO_STATE **/
+std::string stateText(int id) {
+    return id == BOARD_NO_STATE ? "BOARD_NO_STATE" : std::to_string(id);
+}
+
+int main() {
+    Movement m;
+    Gameboard* boards[ROUNDS];
+    for (int r = 0; r < ROUNDS; ++r) {
+        boards[r] = new Gameboard(r + 1, &m);
+    }
+    Gameboard* board = boards[0];
+    if (board->getIntersectionCount() != BOARD_INTERSECTION_COUNT ||
+        INTERSECTION_STATE_COUNT != BOARD_STATES_PER_INTERSECTION) {
+        std::fprintf(stderr, "BoardTable.h sizes do not match Gameboard\n");
+        return 1;
+    }
+
+    std::printf("// generated by BoardTable_Generator (navigation-test/board_table_gen.cpp) - do not edit\n");
+    std::printf("#ifndef BOARDTABLEDATA_H\n#define BOARDTABLEDATA_H\n\n#include \"BoardTable.h\"\n\n");
+    std::printf("#define BOARD_START_STATE %d\n\n", board->getStartState()->getId());
+
+    // state transitions
+    std::printf("// { { left, right, forward, backward }, { left Turn, right Turn, Approach, BackwardApproach } }\n");
+    std::printf("static const BoardStateEntry BOARD_STATES[BOARD_STATE_COUNT] PROGMEM = {\n");
+    for (int id = 0; id < board->getStateCount(); ++id) {
+        IntersectionState* s = board->getState(id);
+        int left = stateId(s->getLeftState());
+        int right = stateId(s->getRightState());
+        std::printf("\t{ { %s, %s, %s, %s }, { %d, %d, %d, %d } }, // %d %s %s\n",
+                    stateText(left).c_str(), stateText(right).c_str(),
+                    stateText(stateId(s->peekForward())).c_str(), stateText(stateId(s->peekBackward())).c_str(),
+                    left == BOARD_NO_STATE ? 0 : int(s->getLeftTurn()),
+                    right == BOARD_NO_STATE ? 0 : int(s->getRightTurn()),
+                    int(s->getForwardApproach()), int(s->getBackwardApproach()),
+                    id, s->getContainer()->getName().c_str(), s->getName().c_str());
+    }
+    std::printf("};\n\n");
+
+    // predecessors, for searches that run backward from a target: every (state, command) leading into a state
+    std::vector<std::vector<int> > predecessors(board->getStateCount());
+    for (int id = 0; id < board->getStateCount(); ++id) {
+        IntersectionState* s = board->getState(id);
+        IntersectionState* next[ROUTE_COMMAND_COUNT] = { s->getLeftState(), s->getRightState(), s->peekForward(), s->peekBackward() };
+        for (int c = 0; c < ROUTE_COMMAND_COUNT; ++c) {
+            if (next[c]) {
+                predecessors[next[c]->getId()].push_back(id * ROUTE_COMMAND_COUNT + c);
+            }
+        }
+    }
+    int edges = 0;
+    std::printf("// index of the first BOARD_PREDECESSORS entry of each state\n");
+    std::printf("static const uint16_t BOARD_PREDECESSOR_START[BOARD_STATE_COUNT + 1] PROGMEM = {\n");
+    for (int id = 0; id <= board->getStateCount(); ++id) {
+        std::printf("%s%4d,%s", (id % 16 == 0) ? "\t" : "", edges, (id % 16 == 15) ? "\n" : " ");
+        if (id < board->getStateCount()) {
+            edges += int(predecessors[id].size());
+        }
+    }
+    std::printf("\n};\n\n");
+    std::printf("#define BOARD_EDGE_COUNT %d\n\n", edges);
+    std::printf("// state * ROUTE_COMMAND_COUNT + command for every move into the state\n");
+    std::printf("static const uint16_t BOARD_PREDECESSORS[BOARD_EDGE_COUNT] PROGMEM = {\n");
+    int written = 0;
+    for (int id = 0; id < board->getStateCount(); ++id) {
+        for (int entry : predecessors[id]) {
+            std::printf("%s%4d,%s", (written % 16 == 0) ? "\t" : "", entry, (written % 16 == 15) ? "\n" : " ");
+            ++written;
+        }
+    }
+    std::printf("%s};\n\n", (written % 16) ? "\n" : "");
+
+    // token rounds, bit (round - 1) set if the intersection has a token that round
+    std::printf("static const uint8_t BOARD_TOKEN_ROUNDS[BOARD_INTERSECTION_COUNT] PROGMEM = {\n");
+    for (int i = 0; i < board->getIntersectionCount(); ++i) {
+        int mask = 0;
+        for (int r = 0; r < ROUNDS; ++r) {
+            if (boards[r]->getIntersection(i)->getIfToken()) {
+                mask |= 1 << r;
+            }
+        }
+        std::printf("%s0x%02X,%s", (i % 8 == 0) ? "\t" : "", mask, (i % 8 == 7) ? "\n" : " ");
+    }
+    std::printf("%s};\n\n", (board->getIntersectionCount() % 8) ? "\n" : "");
+
+    // names
+    for (int i = 0; i < board->getIntersectionCount(); ++i) {
+        if (board->getIntersection(i)->getName().length() >= BOARD_NAME_LENGTH) {
+            std::fprintf(stderr, "name too long for BOARD_NAME_LENGTH: %s\n", board->getIntersection(i)->getName().c_str());
+            return 1;
+        }
+    }
+    std::printf("static const char BOARD_INTERSECTION_NAMES[BOARD_INTERSECTION_COUNT][BOARD_NAME_LENGTH] PROGMEM = {\n");
+    for (int i = 0; i < board->getIntersectionCount(); ++i) {
+        std::printf("\t\"%s\",\n", board->getIntersection(i)->getName().c_str());
+    }
+    std::printf("};\n\n#endif\n");
+    return 0;
+}
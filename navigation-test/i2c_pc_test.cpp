@@ -0,0 +1,416 @@
+// host tests for I2CScheduler, with the line bar, two color sensors and their multiplexer emulated on the fake bus
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "ColorSensor.h"
+#include "I2CScheduler.h"
+#include "LineIntersection.h"
+#include "FakeSX1509.h"
+#include "FakeTCS34725.h"
+
+const uint8_t BAR_ADDRESS = 0x3E;
+const uint8_t COLOR_ADDRESS = 0x29;
+const int INTERRUPT_PIN = 2;
+const int MIDDLE_PIN = A0;
+
+static FakeSX1509 sx1509(INTERRUPT_PIN);
+static FakeMultiplexer mux;
+static FakeMultiplexedDevice colorBus(mux);
+static FakeTCS34725 tcs[2];
+static LineIntersection* line = nullptr;
+
+void lineChanged() {
+    line->markChange();
+}
+
+void setUp() {
+    fakeI2CAttach(BAR_ADDRESS, &sx1509);
+    fakeI2CAttach(I2C_MUX_ADDRESS, &mux);
+    fakeI2CAttach(COLOR_ADDRESS, &colorBus);
+    colorBus.attach(0, &tcs[0]);
+    colorBus.attach(1, &tcs[1]);
+    sx1509.isr = nullptr;
+    useSimulatedTime() = true;
+    simulatedMicros() = 0;
+}
+
+/** ColorSensor prints every color it finds **/
+void quiet(bool on) {
+    static std::streambuf* out = nullptr;
+    if (on) {
+        out = std::cout.rdbuf(nullptr);
+    }
+    else {
+        std::cout.rdbuf(out);
+        std::cout.clear();
+    }
+}
+
+/** done callback that notes which job finished, in order **/
+static std::vector<int> finished;
+void noteFinished(I2CJob& job) {
+    finished.push_back(*(int*)job.context);
+}
+
+int testPriority() {
+    int failures = 0;
+    setUp();
+    I2CScheduler bus;
+    bus.begin();
+    uint8_t data[5];
+    int tags[5] = {0, 1, 2, 3, 4};
+    I2CJob jobs[5];
+    // an other job, three color jobs, then the line bar
+    jobs[0].priority = I2C_PRIORITY_OTHER;
+    for (int i = 1; i <= 3; ++i) {
+        jobs[i].setRead(COLOR_ADDRESS, 0x80 | FAKE_TCS34725_ID, &data[i], 1);
+        jobs[i].channel = 0;
+        jobs[i].priority = I2C_PRIORITY_COLOR;
+    }
+    jobs[0].setRead(COLOR_ADDRESS, 0x80 | FAKE_TCS34725_ID, &data[0], 1);
+    jobs[0].channel = 1;
+    jobs[4].setRead(BAR_ADDRESS, FAKE_SX1509_DIR_A, &data[4], 1);
+    jobs[4].priority = I2C_PRIORITY_LINE;
+    finished.clear();
+    for (int i = 0; i < 5; ++i) {
+        jobs[i].done = noteFinished;
+        jobs[i].context = &tags[i];
+        bus.submit(jobs[i]);
+    }
+    if (bus.submit(jobs[2])) {
+        std::printf("FAIL priority: a queued job was queued again\n");
+        failures++;
+    }
+    // the line bar first, then by priority in the order queued
+    int runs = 0;
+    while (bus.run()) {
+        runs++;
+    }
+    std::vector<int> expected = {4, 1, 2, 3, 0};
+    if (runs != 5 || finished != expected) {
+        std::printf("FAIL priority: %d jobs ran, order", runs);
+        for (int tag : finished) {
+            std::printf(" %d", tag);
+        }
+        std::printf("\n");
+        failures++;
+    }
+    for (int i = 0; i < 5; ++i) {
+        if (jobs[i].state != I2C_JOB_DONE || data[i] != (i == 4 ? 0xFF : 0x44)) {
+            std::printf("FAIL priority: job %d state %d data %02X\n", i, jobs[i].state, data[i]);
+            failures++;
+        }
+    }
+
+    // a cancelled job does not run
+    bus.submit(jobs[1]);
+    bus.submit(jobs[2]);
+    finished.clear();
+    if (!bus.cancel(jobs[1]) || bus.cancel(jobs[1]) || jobs[1].state != I2C_JOB_IDLE) {
+        std::printf("FAIL priority: cancel\n");
+        failures++;
+    }
+    while (bus.run()) {}
+    if (finished != std::vector<int>{2} || !bus.getIfIdle()) {
+        std::printf("FAIL priority: %d jobs ran after a cancel\n", (int)finished.size());
+        failures++;
+    }
+    return failures;
+}
+
+int testMultiplexerCache() {
+    int failures = 0;
+    setUp();
+    I2CScheduler bus;
+    bus.begin();
+    uint8_t data[6];
+    uint8_t channels[6] = {0, 0, 0, 1, 1, 0};
+    I2CJob jobs[6];
+    unsigned long writes = mux.writes;
+    for (int i = 0; i < 6; ++i) {
+        jobs[i].setRead(COLOR_ADDRESS, 0x80 | FAKE_TCS34725_ID, &data[i], 1);
+        jobs[i].channel = channels[i];
+        bus.submit(jobs[i]);
+    }
+    while (bus.run()) {}
+    I2CStats stats;
+    bus.getStats(stats);
+    // the multiplexer is only written when the channel changes
+    if (mux.writes - writes != 3 || stats.muxWrites != 3 || stats.muxSkipped != 3 || bus.getChannel() != 0) {
+        std::printf("FAIL multiplexer: %lu writes, %lu skipped\n", mux.writes - writes, stats.muxSkipped);
+        failures++;
+    }
+    // written around the scheduler, the channel is selected again
+    bus.invalidateChannel();
+    bus.submit(jobs[0]);
+    bus.run();
+    if (mux.writes - writes != 4 || jobs[0].state != I2C_JOB_DONE) {
+        std::printf("FAIL multiplexer: not selected again after invalidateChannel\n");
+        failures++;
+    }
+    // nothing on the channel: the job fails and the scheduler moves on
+    jobs[1].channel = 5;
+    bus.submit(jobs[1]);
+    bus.submit(jobs[2]);
+    while (bus.run()) {}
+    bus.getStats(stats);
+    if (jobs[1].state != I2C_JOB_FAILED || jobs[2].state != I2C_JOB_DONE || stats.failed != 1) {
+        std::printf("FAIL multiplexer: job on an empty channel %d, next %d\n", jobs[1].state, jobs[2].state);
+        failures++;
+    }
+    return failures;
+}
+
+int testColorSensor() {
+    int failures = 0;
+    setUp();
+    I2CScheduler bus;
+    bus.begin();
+    tcs[0].setColor(1000, 703, 182, 210);
+    ColorSensor sensor;
+    sensor.initSensor(0);
+    // 43 integration cycles of 2.4 ms for ATIME 0xD5
+    simulatedMicros() += 103200;
+    if (!sensor.requestColor(bus) || sensor.requestColor(bus) || sensor.getIfColorReady()) {
+        std::printf("FAIL color: request while queued\n");
+        failures++;
+    }
+    int runs = 0;
+    while (bus.run()) {
+        runs++;
+    }
+    ColorSensor::COLOR_NAME requested = sensor.getRequestedColor();
+    // the blocking read writes the multiplexer itself
+    ColorSensor::COLOR_NAME blocking = sensor.getColor();
+    if (runs != 1 || !sensor.getIfColorReady() || requested != blocking || requested == ColorSensor::Unknown) {
+        std::printf("FAIL color: %d jobs, color %d, blocking read %d\n", runs, requested, blocking);
+        failures++;
+    }
+    if (bus.getChannel() != I2C_NO_CHANNEL) {
+        std::printf("FAIL color: blocking read did not invalidate the channel\n");
+        failures++;
+    }
+    // the next reading is only ready after the integration time
+    simulatedMicros() = 0;
+    sensor.requestColor(bus);
+    while (bus.run()) {}
+    simulatedMicros() += 50000;
+    if (sensor.requestColor(bus)) {
+        std::printf("FAIL color: request before the sensor integrated a new reading\n");
+        failures++;
+    }
+    simulatedMicros() += 51000;
+    if (!sensor.requestColor(bus)) {
+        std::printf("FAIL color: no request after the integration time\n");
+        failures++;
+    }
+    while (bus.run()) {}
+    return failures;
+}
+
+/** the channels in one burst against read16 per channel, as getRawData read them **/
+int testBurstRead() {
+    int failures = 0;
+    setUp();
+    tcs[0].setColor(0x1234, 0x0567, 0x089A, 0x0BCD);
+    Wire.beginTransmission(I2C_MUX_ADDRESS);
+    Wire.write(1 << 0);
+    Wire.endTransmission();
+    Adafruit_TCS34725 sensor(TCS34725_INTEGRATIONTIME_24MS, TCS34725_GAIN_1X);
+    sensor.begin();
+
+    // the status is read in the same burst; no integration has completed right after enabling
+    tcs34725RawData_t data;
+    if (sensor.getRawDataBurst(&data, true) || (data.status & TCS34725_STATUS_AVALID)) {
+        std::printf("FAIL burst: AVALID before the first integration\n");
+        failures++;
+    }
+    simulatedMicros() += 24000;
+
+    FakeI2CStats before = fakeI2CStats();
+    uint16_t c = sensor.read16(TCS34725_CDATAL);
+    uint16_t r = sensor.read16(TCS34725_RDATAL);
+    uint16_t g = sensor.read16(TCS34725_GDATAL);
+    uint16_t b = sensor.read16(TCS34725_BDATAL);
+    FakeI2CStats separate = fakeI2CStats();
+    bool read = sensor.getRawDataBurst(&data);
+    FakeI2CStats burst = fakeI2CStats();
+    tcs34725RawData_t checked;
+    bool valid = sensor.getRawDataBurst(&checked, true);
+    FakeI2CStats withStatus = fakeI2CStats();
+
+    if (!read || data.c != c || data.r != r || data.g != g || data.b != b || c != 0x1234 || b != 0x0BCD) {
+        std::printf("FAIL burst: %04X %04X %04X %04X, read16 %04X %04X %04X %04X\n",
+                    data.c, data.r, data.g, data.b, c, r, g, b);
+        failures++;
+    }
+    if (!valid || !(checked.status & TCS34725_STATUS_AVALID) || checked.c != c || checked.b != b) {
+        std::printf("FAIL burst: with the status %02X, %04X %04X\n", checked.status, checked.c, checked.b);
+        failures++;
+    }
+    unsigned long separateTransactions = separate.transactions - before.transactions;
+    unsigned long burstTransactions = burst.transactions - separate.transactions;
+    unsigned long separateTime = separate.busMicros - before.busMicros;
+    unsigned long burstTime = burst.busMicros - separate.busMicros;
+    unsigned long statusTime = withStatus.busMicros - burst.busMicros;
+    std::printf("channels at 100 kHz: read16 per channel %lu transactions, %lu us; burst %lu transactions, %lu us; "
+                "burst with status %lu us\n", separateTransactions, separateTime, burstTransactions, burstTime, statusTime);
+    if (burstTransactions != 2 || separateTransactions != 8 || burstTime * 3 > separateTime * 2) {
+        std::printf("FAIL burst: not cheaper than read16 per channel\n");
+        failures++;
+    }
+
+    // getRawData goes through the burst, and gives 0 on every channel when the sensor does not answer
+    sensor.getRawData(&r, &g, &b, &c);
+    if (c != 0x1234 || r != 0x0567 || g != 0x089A || b != 0x0BCD) {
+        std::printf("FAIL burst: getRawData %04X %04X %04X %04X\n", c, r, g, b);
+        failures++;
+    }
+    Wire.beginTransmission(I2C_MUX_ADDRESS);
+    Wire.write(0);
+    Wire.endTransmission();
+    sensor.getRawData(&r, &g, &b, &c);
+    if (c != 0 || r != 0 || g != 0 || b != 0) {
+        std::printf("FAIL burst: getRawData %04X %04X %04X %04X without the sensor\n", c, r, g, b);
+        failures++;
+    }
+    return failures;
+}
+
+/**
+the line moves under the bar every LINE_PERIOD us, while both color sensors are read as often as
+they integrate; the loop does LOOP_WORK us of its own work. Latency is from a line change to the
+sample of it being in.
+**/
+const unsigned long LOOP_WORK = 1000;
+const unsigned long LINE_PERIOD = 3000;
+const unsigned long RUN_TIME = 2000000;
+
+struct LineRun {
+    unsigned long maxLatency = 0;
+    unsigned long totalLatency = 0;
+    unsigned long samples = 0;
+    unsigned long colors = 0;
+};
+
+/** applies the line changes up to now; returns true if there was one **/
+bool moveLine(unsigned long& nextChange, unsigned long& oldestUnread, int& step) {
+    bool moved = false;
+    while (simulatedMicros() >= nextChange) {
+        sx1509.setPort(0x18 << (step++ % 4));
+        if (oldestUnread == 0) {
+            oldestUnread = nextChange;
+        }
+        nextChange += LINE_PERIOD;
+        moved = true;
+    }
+    return moved;
+}
+
+void noteSample(LineRun& run, unsigned long& lastSampleTime, unsigned long& oldestUnread) {
+    SensorBarSample sample;
+    if (line->getSample(0, sample) && sample.time != lastSampleTime && oldestUnread != 0) {
+        unsigned long latency = simulatedMicros() - oldestUnread;
+        run.maxLatency = max(run.maxLatency, latency);
+        run.totalLatency += latency;
+        run.samples++;
+        lastSampleTime = sample.time;
+        oldestUnread = 0;
+    }
+}
+
+LineRun runLine(bool scheduled, I2CStats& stats) {
+    setUp();
+    LineRun run;
+    LineIntersection bar(MIDDLE_PIN, INTERRUPT_PIN);
+    line = &bar;
+    sx1509.isr = lineChanged;
+    bar.beginSampling();
+    ColorSensor sensors[2];
+    for (int i = 0; i < 2; ++i) {
+        tcs[i].setColor(1000, 703, 182, 210);
+        sensors[i].initSensor(i);
+    }
+    I2CScheduler bus;
+    bus.begin();
+    unsigned long nextChange = simulatedMicros() + LINE_PERIOD;
+    unsigned long oldestUnread = 0;
+    unsigned long lastSampleTime = 0;
+    unsigned long lastColor = 0;
+    unsigned long end = simulatedMicros() + RUN_TIME;
+    int step = 0;
+    while (simulatedMicros() < end) {
+        moveLine(nextChange, oldestUnread, step);
+        if (scheduled) {
+            bar.scheduleSample(bus);
+            for (int i = 0; i < 2; ++i) {
+                // a reading counts when the next request replaces it
+                bool ready = sensors[i].getIfColorReady();
+                bool known = ready && sensors[i].getRequestedColor() != ColorSensor::Unknown;
+                if (sensors[i].requestColor(bus) && known) {
+                    run.colors++;
+                }
+            }
+            bus.run();
+            noteSample(run, lastSampleTime, oldestUnread);
+            bar.readLine();
+        }
+        else {
+            bar.readLine();
+            noteSample(run, lastSampleTime, oldestUnread);
+            if (simulatedMicros() - lastColor >= 101000) {
+                lastColor = simulatedMicros();
+                for (int i = 0; i < 2; ++i) {
+                    run.colors += sensors[i].getColor() != ColorSensor::Unknown;
+                }
+            }
+        }
+        simulatedMicros() += LOOP_WORK;
+    }
+    bus.getStats(stats);
+    line = nullptr;
+    return run;
+}
+
+int testLineDuringColorReads() {
+    int failures = 0;
+    I2CStats stats;
+    quiet(true);
+    LineRun blocking = runLine(false, stats);
+    LineRun scheduled = runLine(true, stats);
+    quiet(false);
+    std::printf("line sample latency with blocking color reads: mean %lu us, max %lu us, %lu samples, %lu colors\n",
+                blocking.totalLatency / max(blocking.samples, 1UL), blocking.maxLatency, blocking.samples, blocking.colors);
+    std::printf("line sample latency with the scheduler: mean %lu us, max %lu us, %lu samples, %lu colors\n",
+                scheduled.totalLatency / max(scheduled.samples, 1UL), scheduled.maxLatency, scheduled.samples, scheduled.colors);
+    std::printf("scheduler: bus %u%% busy, %lu jobs, %lu multiplexer writes, %lu skipped; queued line jobs waited "
+                "%lu us at most, color jobs %lu us on average and %lu us at most\n", stats.utilization(), stats.jobs,
+                stats.muxWrites, stats.muxSkipped, stats.latencyMax[I2C_PRIORITY_LINE],
+                stats.latencyTotal[I2C_PRIORITY_COLOR] / max(stats.latencyCount[I2C_PRIORITY_COLOR], 1UL),
+                stats.latencyMax[I2C_PRIORITY_COLOR]);
+    // the change waits for the loop to come round, and the loop for one job on the bus; the
+    // blocking reads hold the line for both integrations
+    if (scheduled.maxLatency > 3 * LOOP_WORK || blocking.maxLatency < 2 * 101000) {
+        std::printf("FAIL line latency: %lu us scheduled, %lu us blocking\n", scheduled.maxLatency, blocking.maxLatency);
+        failures++;
+    }
+    if (scheduled.colors < blocking.colors || stats.latencyMax[I2C_PRIORITY_LINE] != 0) {
+        std::printf("FAIL line latency: %lu colors scheduled, %lu blocking\n", scheduled.colors, blocking.colors);
+        failures++;
+    }
+    return failures;
+}
+
+int main() {
+    int failures = testPriority();
+    failures += testMultiplexerCache();
+    quiet(true);
+    int colorFailures = testColorSensor();
+    quiet(false);
+    failures += colorFailures;
+    failures += testBurstRead();
+    failures += testLineDuringColorReads();
+
+    return failures ? 1 : 0;
+}
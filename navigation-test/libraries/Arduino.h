@@ -3,10 +3,18 @@
 #ifndef INC_2017_2018_TOKENSORTER_ARDUINO_H
 #define INC_2017_2018_TOKENSORTER_ARDUINO_H
 
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <math.h> // the real Arduino.h brings in sqrt, pow and the rest
 #include <string>
+#include <type_traits>
 #include <iostream>
 
 typedef std::string String;
+typedef uint8_t byte;
+typedef bool boolean;
 
 #define String(x) std::to_string(x)
 
@@ -24,8 +32,110 @@ public:
     static void print(const int& s) {
         std::cout << s;
     }
+    static void print(const unsigned long& s) {
+        std::cout << s;
+    }
 };
 
 static SerialClass Serial;
 
+// program memory is ordinary memory on the pc
+#define PROGMEM
+#define PSTR(s) (s)
+typedef const char* PGM_P;
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define memcpy_P memcpy
+#define strcmp_P strcmp
+#define strncpy_P strncpy
+
+// simulated clock for controller tests: while useSimulatedTime() is set, micros() returns simulatedMicros()
+inline bool& useSimulatedTime() {
+    static bool simulated = false;
+    return simulated;
+}
+inline unsigned long& simulatedMicros() {
+    static unsigned long now = 0;
+    return now;
+}
+
+// time since the first call, like time since reset on the board
+inline unsigned long micros() {
+    if (useSimulatedTime()) {
+        return simulatedMicros();
+    }
+    static const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+inline unsigned long millis() {
+    return micros() / 1000;
+}
+inline void delay(unsigned long ms) {
+    if (useSimulatedTime()) {
+        simulatedMicros() += ms * 1000;
+        return;
+    }
+    unsigned long start = micros();
+    while (micros() - start < ms * 1000) {}
+}
+
+// interrupts are not simulated
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+// tests can run an "interrupt" at the points library code marks with SCRAP_PREEMPTION_POINT()
+typedef void (*PreemptionHook)();
+inline PreemptionHook& preemptionHook() {
+    static PreemptionHook hook = nullptr;
+    return hook;
+}
+#define SCRAP_PREEMPTION_POINT() do { if (preemptionHook()) preemptionHook()(); } while (0)
+
+// pins: outputs are stored and inputs are read back from fakePins(), so tests can drive and inspect them
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+#define FAKE_PIN_COUNT 64
+
+inline volatile uint8_t* fakePins() {
+    static volatile uint8_t pins[FAKE_PIN_COUNT];
+    return pins;
+}
+inline void pinMode(int pin, int mode) {}
+inline void digitalWrite(int pin, int value) { fakePins()[pin] = value; }
+inline int digitalRead(int pin) { return fakePins()[pin]; }
+inline void analogWrite(int pin, int value) { fakePins()[pin] = value; }
+// analog inputs read what the test stored in fakeAnalog()
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+inline int* fakeAnalog() {
+    static int levels[FAKE_PIN_COUNT];
+    return levels;
+}
+inline int analogRead(int pin) { return fakeAnalog()[pin]; }
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+// every pin is a port of its own, with the level in bit 0
+inline uint8_t digitalPinToPort(int pin) { return pin; }
+inline uint8_t digitalPinToBitMask(int pin) { return 1; }
+inline volatile uint8_t* portInputRegister(uint8_t port) { return fakePins() + port; }
+
+// arduino's min/max/constrain are macros that take mixed types; the result is returned by value,
+// since decltype(a < b ? a : b) of two parameters of one type is a reference to a parameter
+template <class A, class B>
+inline typename std::common_type<A, B>::type min(A a, B b) { return b < a ? b : a; }
+template <class A, class B>
+inline typename std::common_type<A, B>::type max(A a, B b) { return a < b ? b : a; }
+template <class T, class L, class H>
+inline T constrain(T x, L low, H high) { return x < low ? low : (high < x ? high : x); }
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
 #endif //INC_2017_2018_TOKENSORTER_ARDUINO_H
@@ -0,0 +1,104 @@
+// emulated SX1509 for pc testing, as the SparkFun line follower array uses it: registers with
+// auto-increment, the bar on the bank A inputs and the interrupt output on a fake pin
+
+#ifndef FAKESX1509_H
+#define FAKESX1509_H
+
+#include "Wire.h"
+
+// from sx1509_registers.h, which defines arrays and so can only be included by sensorbar.cpp
+#define FAKE_SX1509_DIR_B 0x0E
+#define FAKE_SX1509_DIR_A 0x0F
+#define FAKE_SX1509_DATA_B 0x10
+#define FAKE_SX1509_DATA_A 0x11
+#define FAKE_SX1509_INTERRUPT_MASK_B 0x12
+#define FAKE_SX1509_INTERRUPT_MASK_A 0x13
+#define FAKE_SX1509_SENSE_HIGH_A 0x16
+#define FAKE_SX1509_SENSE_LOW_A 0x17
+#define FAKE_SX1509_INTERRUPT_SOURCE_B 0x18
+#define FAKE_SX1509_INTERRUPT_SOURCE_A 0x19
+#define FAKE_SX1509_MISC 0x1F
+#define FAKE_SX1509_RESET 0x7D
+
+class FakeSX1509 : public FakeI2CDevice {
+private:
+    int interruptPin;
+    uint8_t registers[128];
+    uint8_t pointer = 0;
+    uint8_t resetKey = 0;
+    uint8_t port = 0; // levels on the bank A inputs
+    void updateInterrupt() {
+        bool low = registers[FAKE_SX1509_INTERRUPT_SOURCE_A] || registers[FAKE_SX1509_INTERRUPT_SOURCE_B];
+        bool wasLow = fakePins()[interruptPin] == LOW;
+        fakePins()[interruptPin] = low ? LOW : HIGH;
+        if (low && !wasLow && isr) {
+            isr();
+        }
+    }
+    void writeRegister(uint8_t reg, uint8_t value) {
+        reg &= 0x7F;
+        if (reg == FAKE_SX1509_RESET) {
+            if (resetKey == 0x12 && value == 0x34) {
+                reset();
+            }
+            resetKey = value;
+        }
+        else if (reg == FAKE_SX1509_INTERRUPT_SOURCE_A || reg == FAKE_SX1509_INTERRUPT_SOURCE_B) {
+            registers[reg] &= ~value; // writing 1 clears
+            updateInterrupt();
+        }
+        else {
+            registers[reg] = value;
+        }
+    }
+public:
+    void (*isr)() = nullptr; // attached to the interrupt pin, FALLING
+    unsigned long portReads = 0;
+    explicit FakeSX1509(int pin) : interruptPin(pin) { reset(); }
+    void reset() {
+        std::memset(registers, 0, sizeof(registers));
+        registers[FAKE_SX1509_DIR_B] = registers[FAKE_SX1509_DIR_A] = 0xFF;
+        registers[FAKE_SX1509_DATA_B] = registers[FAKE_SX1509_DATA_A] = 0xFF;
+        registers[FAKE_SX1509_INTERRUPT_MASK_B] = registers[FAKE_SX1509_INTERRUPT_MASK_A] = 0xFF;
+        updateInterrupt();
+    }
+    void receive(const uint8_t* data, uint8_t count) override {
+        if (count == 0) {
+            return;
+        }
+        pointer = data[0];
+        for (uint8_t i = 1; i < count; ++i) {
+            writeRegister(pointer++, data[i]);
+        }
+    }
+    uint8_t transmit() override {
+        uint8_t reg = pointer++ & 0x7F;
+        if (reg != FAKE_SX1509_DATA_A) {
+            return registers[reg];
+        }
+        ++portReads;
+        if (!(registers[FAKE_SX1509_MISC] & 0x01)) {
+            // autoclear on data read
+            registers[FAKE_SX1509_INTERRUPT_SOURCE_A] = 0;
+            updateInterrupt();
+        }
+        return port;
+    }
+    // the line moves under the bar: unmasked bits that change the sensed way raise the interrupt
+    void setPort(uint8_t newPort) {
+        for (int bit = 0; bit < 8; ++bit) {
+            bool was = (port >> bit) & 1;
+            bool is = (newPort >> bit) & 1;
+            uint8_t senseRegister = bit >= 4 ? FAKE_SX1509_SENSE_HIGH_A : FAKE_SX1509_SENSE_LOW_A;
+            uint8_t sense = registers[senseRegister] >> ((bit & 0x03) * 2) & 0x03;
+            bool sensed = (is && !was && (sense & 0x01)) || (!is && was && (sense & 0x02));
+            if (sensed && !((registers[FAKE_SX1509_INTERRUPT_MASK_A] >> bit) & 1)) {
+                registers[FAKE_SX1509_INTERRUPT_SOURCE_A] |= 1 << bit;
+            }
+        }
+        port = newPort;
+        updateInterrupt();
+    }
+};
+
+#endif //FAKESX1509_H
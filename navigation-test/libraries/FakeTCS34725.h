@@ -0,0 +1,110 @@
+// emulated TCS34725 color sensors behind a TCA9548A style multiplexer, for pc testing
+
+#ifndef FAKETCS34725_H
+#define FAKETCS34725_H
+
+#include "Wire.h"
+
+// registers, from Adafruit_TCS34725.h
+#define FAKE_TCS34725_ENABLE 0x00
+#define FAKE_TCS34725_ATIME 0x01
+#define FAKE_TCS34725_ID 0x12
+#define FAKE_TCS34725_STATUS 0x13
+#define FAKE_TCS34725_CDATAL 0x14
+#define FAKE_TCS34725_ENABLE_PON 0x01
+#define FAKE_TCS34725_ENABLE_AEN 0x02
+#define FAKE_TCS34725_STATUS_AVALID 0x01
+
+// the multiplexer: one byte, a bit for every channel connected to the main bus
+class FakeMultiplexer : public FakeI2CDevice {
+public:
+    uint8_t channels = 0;
+    unsigned long writes = 0;
+    void receive(const uint8_t* data, uint8_t count) override {
+        if (count > 0) {
+            channels = data[count - 1];
+            ++writes;
+        }
+    }
+    uint8_t transmit() override { return channels; }
+};
+
+// devices with one address on different channels; the one on the selected channel answers
+class FakeMultiplexedDevice : public FakeI2CDevice {
+private:
+    FakeMultiplexer& mux;
+    FakeI2CDevice* devices[8] = {};
+    FakeI2CDevice* selected() {
+        FakeI2CDevice* found = nullptr;
+        for (int channel = 0; channel < 8; ++channel) {
+            if (((mux.channels >> channel) & 1) && devices[channel]) {
+                if (found) {
+                    return nullptr; // two answering at once garble the bus
+                }
+                found = devices[channel];
+            }
+        }
+        return found;
+    }
+public:
+    explicit FakeMultiplexedDevice(FakeMultiplexer& multiplexer) : mux(multiplexer) {}
+    void attach(uint8_t channel, FakeI2CDevice* device) { devices[channel & 0x07] = device; }
+    bool present() override { return selected() != nullptr; }
+    void receive(const uint8_t* data, uint8_t count) override { selected()->receive(data, count); }
+    uint8_t transmit() override { return selected()->transmit(); }
+};
+
+// the sensor integrates continuously once enabled; AVALID is set after the first integration.
+// The register address moves on after every byte read; the library's two byte reads with the
+// plain command bit rely on that just as burst reads with the auto-increment type do
+class FakeTCS34725 : public FakeI2CDevice {
+private:
+    uint8_t registers[32];
+    uint8_t pointer = 0;
+    unsigned long enableTime = 0;
+    bool getIfValid() {
+        uint8_t on = FAKE_TCS34725_ENABLE_PON | FAKE_TCS34725_ENABLE_AEN;
+        unsigned long integration = (256UL - registers[FAKE_TCS34725_ATIME]) * 2400UL;
+        return (registers[FAKE_TCS34725_ENABLE] & on) == on && micros() - enableTime >= integration;
+    }
+public:
+    unsigned long commands = 0; // register addresses written
+    FakeTCS34725() {
+        std::memset(registers, 0, sizeof(registers));
+        registers[FAKE_TCS34725_ATIME] = 0xFF;
+        registers[FAKE_TCS34725_ID] = 0x44;
+    }
+    void setColor(uint16_t clear, uint16_t red, uint16_t green, uint16_t blue) {
+        uint16_t channels[4] = {clear, red, green, blue};
+        for (int i = 0; i < 4; ++i) {
+            registers[FAKE_TCS34725_CDATAL + 2 * i] = channels[i] & 0xFF;
+            registers[FAKE_TCS34725_CDATAL + 2 * i + 1] = channels[i] >> 8;
+        }
+    }
+    void receive(const uint8_t* data, uint8_t count) override {
+        if (count == 0 || !(data[0] & 0x80)) {
+            return;
+        }
+        ++commands;
+        if ((data[0] & 0x60) == 0x60) {
+            return; // special function: clear interrupt
+        }
+        pointer = data[0] & 0x1F;
+        for (uint8_t i = 1; i < count; ++i, ++pointer) {
+            if (pointer == FAKE_TCS34725_ENABLE && (data[i] & FAKE_TCS34725_ENABLE_AEN) &&
+                !(registers[pointer] & FAKE_TCS34725_ENABLE_AEN)) {
+                enableTime = micros();
+            }
+            registers[pointer & 0x1F] = data[i];
+        }
+    }
+    uint8_t transmit() override {
+        uint8_t reg = pointer++ & 0x1F;
+        if (reg == FAKE_TCS34725_STATUS) {
+            return getIfValid() ? FAKE_TCS34725_STATUS_AVALID : 0;
+        }
+        return registers[reg];
+    }
+};
+
+#endif //FAKETCS34725_H
@@ -0,0 +1,116 @@
+#include "LineIntersection.h"
+#include "LineTableData.h"
+
+LineIntersection::LineIntersection()
+{
+
+
+}
+
+
+LineIntersection::LineIntersection(int pin, uint8_t interruptPin) {
+	mySensorBar = new SensorBar(SX1509_ADDRESS,255,interruptPin);
+	mySensorBar->clearBarStrobe();
+	mySensorBar->clearInvertBits();
+	mySensorBar->begin();
+	//setLineByte();
+
+	// set middlePin
+	middlePin = pin;
+
+	sampleJob.setRead(SX1509_ADDRESS,SENSORBAR_DATA_REGISTER,&sampleData,1);
+	sampleJob.priority = I2C_PRIORITY_LINE;
+	sampleJob.done = sampleRead;
+	sampleJob.context = this;
+}
+
+
+void LineIntersection::scheduleSample(I2CScheduler& bus) {
+	sampledOnBus = true;
+	if (sampleJob.state != I2C_JOB_QUEUED && mySensorBar->takeChange()) {
+		bus.submit(sampleJob);
+	}
+}
+
+void LineIntersection::sampleRead(I2CJob& job) {
+	SensorBar* bar = ((LineIntersection*)job.context)->mySensorBar;
+	if (job.state == I2C_JOB_DONE) {
+		bar->addSample(*job.rx);
+	}
+	else {
+		bar->dropChange();
+	}
+}
+
+
+String LineIntersection::getArrayDataInString() {
+	String lineData = "";
+	int bit_value;
+	// get data
+	line_byte = mySensorBar->getRaw();
+
+	for (int8_t i = BYTE_SIZE-1; i >= 0; i--) {
+		bit_value = bitRead(line_byte,i);
+		lineData += (bit_value ? ON_LINE : OFF_LINE);
+	}
+	return lineData;
+}
+
+
+bool LineIntersection::getMiddleState() {
+	return analogRead(middlePin) >= middleThreshold;
+}
+
+
+int8_t LineIntersection::getArrayDataSum() {
+	line_byte = mySensorBar->getRaw();
+	// right half counts up, left half counts down
+	return getDensity(packReading(line_byte & 0x0F,false)) - getDensity(packReading(line_byte & 0xF0,false));
+}
+
+
+uint8_t LineIntersection::getDensity(uint16_t reading) {
+	return pgm_read_byte(&LINE_DENSITY[reading & (LINE_READING_COUNT-1)]);
+}
+
+
+int8_t LineIntersection::getPosition(uint16_t reading) {
+	return (int8_t)pgm_read_byte(&LINE_POSITION[reading & (LINE_READING_COUNT-1)]);
+}
+
+
+uint8_t LineIntersection::getClass(uint16_t reading) {
+	return pgm_read_byte(&LINE_CLASS[reading & (LINE_READING_COUNT-1)]);
+}
+
+
+uint16_t LineIntersection::readLine() {
+	line_byte = sampledOnBus ? mySensorBar->getLastRaw() : mySensorBar->getRaw();
+	lastReading = packReading(line_byte,getMiddleState());
+	return lastReading;
+}
+
+
+String LineIntersection::getFullArrayInString() {
+	String lineData = "";
+	readLine();
+	// all 9 bits, leftmost sensor first
+	for (int8_t i = BYTE_SIZE; i >= 0; i--) {
+		lineData += (bitRead(lastReading,i) ? ON_LINE : OFF_LINE);
+	}
+	return lineData;
+}
+
+
+int LineIntersection::getLinePosition(bool getNewData) {
+	// get new data if requested
+	if (getNewData) {
+		readLine();
+	}
+	int8_t position = getPosition(lastReading);
+	// remember last position if no IRs are on_line
+	if (position != LINE_NO_POSITION) {
+		lastPosition = position;
+	}
+	return lastPosition;
+}
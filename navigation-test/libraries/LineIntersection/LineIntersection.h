@@ -0,0 +1,114 @@
+#ifndef LINEINTERSECTION_H
+#define LINEINTERSECTION_H
+
+#include "Wire.h"
+#include "sensorbar.h"
+#include "Arduino.h"
+#include "I2CScheduler.h"
+
+#define BYTE_SIZE 8
+
+/*
+A reading is the 8 sensor bar bits and the middle IR packed into 9 bits, in the order the string
+version prints them: bit 8 is the leftmost sensor (bar bit 7), bit 4 is the middle IR and bit 0 is
+the rightmost sensor (bar bit 0). Density, position and intersection class of every reading are looked
+up in LineTableData.h, which is generated by LineTable_Generator (navigation-test/line_table_gen.cpp).
+*/
+#define LINE_READING_COUNT 512
+#define LINE_MIDDLE_BIT 4
+#define LINE_NO_POSITION -128 // off the middle, nothing or a balanced pair sees the line; keep the last position
+
+// intersection classes, or'd together in LINE_CLASS
+#define LINE_PERPENDICULAR 0x01
+#define LINE_CROSSING_Y 0x02
+#define LINE_SEPARATING_Y 0x04
+#define LINE_LEFT_Y 0x08
+#define LINE_RIGHT_Y 0x10
+
+// #define INTERSECTION_I 10
+// #define INTERSECTION_II 20
+// #define INTERSECTION_III 30
+// #define INTERSECTION_IV 40
+// #define INTERSECTION_V 50
+//
+// #define NO_LINE -1
+// #define VERTICAL_LINE 0
+// #define DIAGONAL_LINE 1
+// #define VERT_AND_DIAG_LINE 2
+// #define HORIZONTAL_LINE 3
+// #define SENSOR_ERROR 99
+
+//#define SX1509_ADDRESS 0x3E
+
+class LineIntersection{
+	private:
+		//Class type pulled from example code.
+		uint8_t SX1509_ADDRESS = 0x3E;
+		SensorBar* mySensorBar;
+		uint8_t line_byte;
+
+		uint16_t lastReading = 0;
+		int lastPosition = 0;
+		int middlePin;
+		int middleThreshold = 850;
+		const char ON_LINE = '1';
+		const char OFF_LINE = '0';
+		// read of a bar change through a shared bus
+		I2CJob sampleJob;
+		uint8_t sampleData;
+		bool sampledOnBus = false; // readLine() takes the last sample instead of reading the bar
+		static void sampleRead(I2CJob& job);
+		// int8_t line_byte_array[8];
+		// int8_t line_density;
+		//int8_t intersection_counter;
+
+
+	public:
+		LineIntersection();
+		// interruptPin: where the bar's SX1509 interrupt output is wired, for beginSampling()
+		LineIntersection(int pin, uint8_t interruptPin = 255);
+		// int8_t checkIntersection();
+		// int8_t determineHalf(String left_or_right);
+		// int8_t countOnes(int8_t start, int8_t end);
+		// void setLineDensity();
+		// void setLineByte();
+		// void convertLineByteIntoArray();
+
+		// packs the bar byte and the middle IR into a reading
+		static uint16_t packReading(uint8_t bar, bool middle) {
+			return (bar & 0x0F) | (middle << LINE_MIDDLE_BIT) | ((uint16_t)(bar & 0xF0) << 1);
+		};
+		// table lookups, no state
+		static uint8_t getDensity(uint16_t reading);
+		static int8_t getPosition(uint16_t reading); // LINE_NO_POSITION if the line is lost
+		static uint8_t getClass(uint16_t reading);
+
+		// read the bar only after its interrupt pin signals a change; see SensorBar::beginSampling()
+		bool beginSampling(SensorBarCountSource countSource = 0) { return mySensorBar->beginSampling(countSource); };
+		void markChange() { mySensorBar->markChange(); }; // from the interrupt pin's ISR
+		bool getSample(uint8_t back, SensorBarSample& sample) { return mySensorBar->getSample(back,sample); };
+		// with sampling on a bus shared with other devices: queues the read of a change ahead of them,
+		// instead of reading it in readLine(); call every loop, before bus.run()
+		void scheduleSample(I2CScheduler& bus);
+
+		// reads the bar and the middle IR; the getters below work on the last reading
+		uint16_t readLine();
+		uint16_t getReading() { return lastReading; };
+		int getDensity() { return getDensity(lastReading); };
+		uint8_t getIntersectionClass() { return getClass(lastReading); };
+
+		bool getMiddleState();
+		int8_t getArrayDataSum();
+		String getArrayDataInString();
+		// reads like readLine, returned as text for printing
+		String getFullArrayInString();
+		int getLinePosition(bool getNewData = false);
+		// Line Intersection Detection functions; one reading cannot tell the Ys apart, LineTracker can
+		bool getIfAtPerpendicular() { return getIntersectionClass() & LINE_PERPENDICULAR; };
+		bool getIfAtSeparatingY() { return getIntersectionClass() & LINE_SEPARATING_Y; };
+		bool getIfAtCrossingY() { return getIntersectionClass() & LINE_CROSSING_Y; };
+		bool getIfAtRightY() { return getIntersectionClass() & LINE_RIGHT_Y; };
+		bool getIfAtLeftY() { return getIntersectionClass() & LINE_LEFT_Y; };
+};
+
+#endif
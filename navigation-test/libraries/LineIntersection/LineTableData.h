@@ -0,0 +1,115 @@
+// generated by LineTable_Generator (navigation-test/line_table_gen.cpp) - do not edit
+#ifndef LINETABLEDATA_H
+#define LINETABLEDATA_H
+
+#include "LineIntersection.h"
+
+// sensors on the line
+static const uint8_t LINE_DENSITY[LINE_READING_COUNT] PROGMEM = {
+	   0,    1,    1,    2,    1,    2,    2,    3,    1,    2,    2,    3,    2,    3,    3,    4,
+	   1,    2,    2,    3,    2,    3,    3,    4,    2,    3,    3,    4,    3,    4,    4,    5,
+	   1,    2,    2,    3,    2,    3,    3,    4,    2,    3,    3,    4,    3,    4,    4,    5,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   1,    2,    2,    3,    2,    3,    3,    4,    2,    3,    3,    4,    3,    4,    4,    5,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   1,    2,    2,    3,    2,    3,    3,    4,    2,    3,    3,    4,    3,    4,    4,    5,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   4,    5,    5,    6,    5,    6,    6,    7,    5,    6,    6,    7,    6,    7,    7,    8,
+	   1,    2,    2,    3,    2,    3,    3,    4,    2,    3,    3,    4,    3,    4,    4,    5,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   4,    5,    5,    6,    5,    6,    6,    7,    5,    6,    6,    7,    6,    7,    7,    8,
+	   2,    3,    3,    4,    3,    4,    4,    5,    3,    4,    4,    5,    4,    5,    5,    6,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   4,    5,    5,    6,    5,    6,    6,    7,    5,    6,    6,    7,    6,    7,    7,    8,
+	   3,    4,    4,    5,    4,    5,    5,    6,    4,    5,    5,    6,    5,    6,    6,    7,
+	   4,    5,    5,    6,    5,    6,    6,    7,    5,    6,    6,    7,    6,    7,    7,    8,
+	   4,    5,    5,    6,    5,    6,    6,    7,    5,    6,    6,    7,    6,    7,    7,    8,
+	   5,    6,    6,    7,    6,    7,    7,    8,    6,    7,    7,    8,    7,    8,    8,    9,
+};
+
+// line position, negative to the left; LINE_NO_POSITION off the middle if nothing or a balanced pair sees the line
+static const int8_t LINE_POSITION[LINE_READING_COUNT] PROGMEM = {
+	-128,   16,   12,   12,    8,    8,    8,    8,    4,    4,    4,    4,    4,    4,    4,    4,
+	   0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+	  -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4, -128, -128, -128, -128, -128, -128, -128, -128,
+	  -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,
+	  -8,   -8,   -8,   -8, -128, -128, -128, -128,    4,    4,    4,    4,    4,    4,    4,    4,
+	   0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+	  -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4, -128, -128, -128, -128, -128, -128, -128, -128,
+	  -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,
+	 -12,  -12, -128, -128,    8,    8,    8,    8,    4,    4,    4,    4,    4,    4,    4,    4,
+	   0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+	  -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4, -128, -128, -128, -128, -128, -128, -128, -128,
+	  -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,
+	  -8,   -8,   -8,   -8, -128, -128, -128, -128,    4,    4,    4,    4,    4,    4,    4,    4,
+	   0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+	  -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4, -128, -128, -128, -128, -128, -128, -128, -128,
+	  -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,
+	 -16, -128,   12,   12,    8,    8,    8,    8,    4,    4,    4,    4,    4,    4,    4,    4,
+	   0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+	  -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4, -128, -128, -128, -128, -128, -128, -128, -128,
+	  -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,
+	  -8,   -8,   -8,   -8, -128, -128, -128, -128,    4,    4,    4,    4,    4,    4,    4,    4,
+	   0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+	  -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4, -128, -128, -128, -128, -128, -128, -128, -128,
+	  -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,
+	 -12,  -12, -128, -128,    8,    8,    8,    8,    4,    4,    4,    4,    4,    4,    4,    4,
+	   0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+	  -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4, -128, -128, -128, -128, -128, -128, -128, -128,
+	  -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,
+	  -8,   -8,   -8,   -8, -128, -128, -128, -128,    4,    4,    4,    4,    4,    4,    4,    4,
+	   0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+	  -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4, -128, -128, -128, -128, -128, -128, -128, -128,
+	  -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,
+};
+
+// LINE_PERPENDICULAR, LINE_CROSSING_Y, ... flags
+static const uint8_t LINE_CLASS[LINE_READING_COUNT] PROGMEM = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x19, 0x19,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x1F, 0x00, 0x00, 0x00, 0x19, 0x06, 0x1F, 0x1F, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x1F, 0x00, 0x00, 0x00, 0x19, 0x06, 0x1F, 0x1F, 0x1F,
+	0x00, 0x00, 0x00, 0x19, 0x06, 0x1F, 0x1F, 0x1F, 0x00, 0x19, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x06, 0x1F,
+	0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x19, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x19, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x1F, 0x00, 0x19, 0x1F, 0x1F, 0x00, 0x19, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1F, 0x00, 0x00, 0x06, 0x1F, 0x06, 0x1F, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x1F, 0x06, 0x1F, 0x1F, 0x1F, 0x00, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x1F, 0x06, 0x1F, 0x1F, 0x1F, 0x00, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x00, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x19, 0x19,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x19, 0x19,
+	0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x1F, 0x00, 0x00, 0x00, 0x19, 0x06, 0x1F, 0x1F, 0x1F,
+	0x00, 0x00, 0x00, 0x19, 0x06, 0x1F, 0x1F, 0x1F, 0x00, 0x19, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x00, 0x00, 0x00, 0x19, 0x06, 0x1F, 0x1F, 0x1F, 0x00, 0x19, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x00, 0x19, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x19, 0x19, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x06, 0x1F, 0x00, 0x19, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x1F, 0x00, 0x19, 0x1F, 0x1F, 0x00, 0x19, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x1F, 0x00, 0x19, 0x1F, 0x1F, 0x00, 0x19, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F,
+	0x00, 0x19, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F,
+	0x00, 0x00, 0x06, 0x1F, 0x06, 0x1F, 0x1F, 0x1F, 0x00, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x00, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x00, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x19, 0x19, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+};
+
+#endif
@@ -86,6 +86,15 @@ void Movement::performApproach(Approach approachType) {
 }
 
 
+void Movement::performApproaches(const Approach* approachTypes, uint8_t count) {
+	for (uint8_t i = 0; i < count; i++) {
+		// the line an approach ends at is only passed over when another approach follows
+		cruiseThrough = i + 1 < count;
+		performApproach(approachTypes[i]);
+	}
+	cruiseThrough = false;
+}
+
 void Movement::performBackwardApproach(BackwardApproach approachType) {
 	switch (approachType) {
 	case BackwardLeaveDropPosition:
@@ -21,6 +21,7 @@ namespace moveOptions {
         MoveIntoDropPosition
 	};
 	enum BackwardApproach {
+		NoBackwardApproach=0,
 		BackwardLeaveDropPosition=1,
 		BackwardFollowUntilCrossingY, BackwardFollowUntilSeparatingY,
 		BackwardFollowUntilPerpendicularLine
@@ -29,13 +30,20 @@ namespace moveOptions {
 
 using namespace moveOptions;
 
+#define MOVEMENT_MAX_CHAIN 16 // most approaches followed without stopping in between
+
 class Movement
 {
+protected:
+	bool cruiseThrough = false; // approaches keep their speed instead of stopping at the line when set
 public:
 	Movement();
 	~Movement();
 	void performTurn(Turn turnType);
 	void performApproach(Approach approachType);
+	// follows the approaches one after another at cruise speed; only the last one stops at its line
+	void performApproaches(const Approach* approachTypes, uint8_t count);
+	bool getIfCruising() { return cruiseThrough; }; // true while the current approach is followed by another one
 	void performBackwardApproach(BackwardApproach approachType);
 	// Turn methods
     // TODO: stop using these, make them private if we really need them (I doubt we need them), use the parameter one
@@ -58,22 +66,22 @@ public:
             Serial.println(" deg to the left");
     }
 	// Approach functions
-	void approachNoFollowUntilPerpendicularLine() { Serial.println("Not following line until perpendicular line is hit"); };
-	void approachFollowUntilPerpendicularLine() { Serial.println("Following line until perpendicular line is hit"); };
-	void approachFollowUntilTokenSlot() { Serial.println("Following line until token slot is hit"); };
-	void approachFollowOnLeftUntilPerpendicularLine() { Serial.println("Following line on its left until perpendicular line is hit on the left"); };
-	void approachFollowOnRightUntilPerpendicularLine() { Serial.println("Following line on its right until perpendicular line is hit on the right"); };
-	void approachFollowOnLeftUntilCrossesLine() { Serial.println("Following line on its left until some line is hit on the left"); };
-	void approachFollowOnRightUntilCrossesLine() { Serial.println("Following line on its right until some line is hit on the left"); };
-	void approachFollowUntilCrossingY() { Serial.println("Following line until two lines of Y start to cross"); };
-	void approachFollowUntilSeparatingY() { Serial.println("Following line until two liens of Y start to separate"); };
-	void approachMoveIntoStart() { Serial.println("Go forward some amount to be in center of start square"); };
-	void approachMoveIntoDropPosition() { Serial.println("Go forward some amount to be in center of start square"); };
+	virtual void approachNoFollowUntilPerpendicularLine() { Serial.println("Not following line until perpendicular line is hit"); };
+	virtual void approachFollowUntilPerpendicularLine() { Serial.println("Following line until perpendicular line is hit"); };
+	virtual void approachFollowUntilTokenSlot() { Serial.println("Following line until token slot is hit"); };
+	virtual void approachFollowOnLeftUntilPerpendicularLine() { Serial.println("Following line on its left until perpendicular line is hit on the left"); };
+	virtual void approachFollowOnRightUntilPerpendicularLine() { Serial.println("Following line on its right until perpendicular line is hit on the right"); };
+	virtual void approachFollowOnLeftUntilCrossesLine() { Serial.println("Following line on its left until some line is hit on the left"); };
+	virtual void approachFollowOnRightUntilCrossesLine() { Serial.println("Following line on its right until some line is hit on the left"); };
+	virtual void approachFollowUntilCrossingY() { Serial.println("Following line until two lines of Y start to cross"); };
+	virtual void approachFollowUntilSeparatingY() { Serial.println("Following line until two liens of Y start to separate"); };
+	virtual void approachMoveIntoStart() { Serial.println("Go forward some amount to be in center of start square"); };
+	virtual void approachMoveIntoDropPosition() { Serial.println("Go forward some amount to be in center of start square"); };
 	// Backward Approach functions
-	void approachBackwardLeaveDropPosition() { Serial.println("Go backward some amount to leave drop position"); };
-	void approachBackwardFollowUntilCrossingY() { Serial.println("Go backward until two lines of Y start to cross"); };
-	void approachBackwardFollowUntilSeparatingY() { Serial.println("Go backward until two lines of Y start to separate"); };
-	void approachBackwardFollowUntilPerpendicularLine() { Serial.println("Go backward until perpendicular line is hit"); };
+	virtual void approachBackwardLeaveDropPosition() { Serial.println("Go backward some amount to leave drop position"); };
+	virtual void approachBackwardFollowUntilCrossingY() { Serial.println("Go backward until two lines of Y start to cross"); };
+	virtual void approachBackwardFollowUntilSeparatingY() { Serial.println("Go backward until two lines of Y start to separate"); };
+	virtual void approachBackwardFollowUntilPerpendicularLine() { Serial.println("Go backward until perpendicular line is hit"); };
 };
 
 
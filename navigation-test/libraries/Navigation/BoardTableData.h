@@ -0,0 +1,608 @@
+// generated by BoardTable_Generator (navigation-test/board_table_gen.cpp) - do not edit
+#ifndef BOARDTABLEDATA_H
+#define BOARDTABLEDATA_H
+
+#include "BoardTable.h"
+
+#define BOARD_START_STATE 432
+
+// { { left, right, forward, backward }, { left Turn, right Turn, Approach, BackwardApproach } }
+static const BoardStateEntry BOARD_STATES[BOARD_STATE_COUNT] PROGMEM = {
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 0 Middle drop and  0deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 1 Middle drop and  0deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 52 }, { 0, 0, 0, 1 } }, // 2 Middle drop and  0deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 3 Middle drop and  0deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 4 Middle drop and  0deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 5 Middle drop and  0deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 6 Middle drop and  0deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 7 Middle drop and  0deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 8 Middle drop and  45deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 9 Middle drop and  45deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 60 }, { 0, 0, 0, 1 } }, // 10 Middle drop and  45deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 11 Middle drop and  45deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 12 Middle drop and  45deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 13 Middle drop and  45deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 14 Middle drop and  45deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 15 Middle drop and  45deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 16 Middle drop and  135deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 17 Middle drop and  135deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 68 }, { 0, 0, 0, 1 } }, // 18 Middle drop and  135deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 19 Middle drop and  135deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 20 Middle drop and  135deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 21 Middle drop and  135deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 22 Middle drop and  135deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 23 Middle drop and  135deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 24 Middle drop and  180deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 25 Middle drop and  180deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 76 }, { 0, 0, 0, 1 } }, // 26 Middle drop and  180deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 27 Middle drop and  180deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 28 Middle drop and  180deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 29 Middle drop and  180deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 30 Middle drop and  180deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 31 Middle drop and  180deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 32 Middle drop and  225deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 33 Middle drop and  225deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 84 }, { 0, 0, 0, 1 } }, // 34 Middle drop and  225deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 35 Middle drop and  225deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 36 Middle drop and  225deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 37 Middle drop and  225deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 38 Middle drop and  225deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 39 Middle drop and  225deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 40 Middle drop and  315deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 41 Middle drop and  315deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 92 }, { 0, 0, 0, 1 } }, // 42 Middle drop and  315deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 43 Middle drop and  315deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 44 Middle drop and  315deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 45 Middle drop and  315deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 46 Middle drop and  315deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 47 Middle drop and  315deg D[F]
+	{ { 50, 54, 96, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 48 1ft and 0deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 49 1ft and 0deg A[F]
+	{ { 52, 48, 63, BOARD_NO_STATE }, { 3, 4, 7, 0 } }, // 50 1ft and 0deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 51 1ft and 0deg B[F]
+	{ { 54, 50, 2, 100 }, { 3, 4, 11, 4 } }, // 52 1ft and 0deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 53 1ft and 0deg C[F]
+	{ { 48, 52, 91, BOARD_NO_STATE }, { 3, 4, 6, 0 } }, // 54 1ft and 0deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 55 1ft and 0deg D[F]
+	{ { 58, 62, 104, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 56 1ft and 45deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 57 1ft and 45deg A[F]
+	{ { 60, 56, 71, BOARD_NO_STATE }, { 1, 6, 7, 0 } }, // 58 1ft and 45deg B[T]
+	{ { 56, 62, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 59 1ft and 45deg B[F]
+	{ { 62, 58, 10, 108 }, { 1, 2, 11, 2 } }, // 60 1ft and 45deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 61 1ft and 45deg C[F]
+	{ { 56, 60, 54, BOARD_NO_STATE }, { 5, 2, 4, 0 } }, // 62 1ft and 45deg D[T]
+	{ { 58, 56, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 63 1ft and 45deg D[F]
+	{ { 66, 70, 112, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 64 1ft and 135deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 65 1ft and 135deg A[F]
+	{ { 68, 64, 74, BOARD_NO_STATE }, { 1, 6, 5, 0 } }, // 66 1ft and 135deg B[T]
+	{ { 64, 70, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 67 1ft and 135deg B[F]
+	{ { 70, 66, 18, 116 }, { 1, 2, 11, 2 } }, // 68 1ft and 135deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 69 1ft and 135deg C[F]
+	{ { 64, 68, 59, BOARD_NO_STATE }, { 5, 2, 6, 0 } }, // 70 1ft and 135deg D[T]
+	{ { 66, 64, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 71 1ft and 135deg D[F]
+	{ { 74, 78, 120, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 72 1ft and 180deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 73 1ft and 180deg A[F]
+	{ { 76, 72, 87, BOARD_NO_STATE }, { 3, 4, 7, 0 } }, // 74 1ft and 180deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 75 1ft and 180deg B[F]
+	{ { 78, 74, 26, 124 }, { 3, 4, 11, 4 } }, // 76 1ft and 180deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 77 1ft and 180deg C[F]
+	{ { 72, 76, 67, BOARD_NO_STATE }, { 3, 4, 6, 0 } }, // 78 1ft and 180deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 79 1ft and 180deg D[F]
+	{ { 82, 86, 128, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 80 1ft and 225deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 81 1ft and 225deg A[F]
+	{ { 84, 80, 95, BOARD_NO_STATE }, { 1, 6, 7, 0 } }, // 82 1ft and 225deg B[T]
+	{ { 80, 86, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 83 1ft and 225deg B[F]
+	{ { 86, 82, 34, 132 }, { 1, 2, 11, 2 } }, // 84 1ft and 225deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 85 1ft and 225deg C[F]
+	{ { 80, 84, 78, BOARD_NO_STATE }, { 5, 2, 4, 0 } }, // 86 1ft and 225deg D[T]
+	{ { 82, 80, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 87 1ft and 225deg D[F]
+	{ { 90, 94, 136, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 88 1ft and 315deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 89 1ft and 315deg A[F]
+	{ { 92, 88, 50, BOARD_NO_STATE }, { 1, 6, 5, 0 } }, // 90 1ft and 315deg B[T]
+	{ { 88, 94, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 91 1ft and 315deg B[F]
+	{ { 94, 90, 42, 140 }, { 1, 2, 11, 2 } }, // 92 1ft and 315deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 93 1ft and 315deg C[F]
+	{ { 88, 92, 83, BOARD_NO_STATE }, { 5, 2, 6, 0 } }, // 94 1ft and 315deg D[T]
+	{ { 90, 88, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 95 1ft and 315deg D[F]
+	{ { 98, 102, 144, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 96 2ft and 0deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 97 2ft and 0deg A[F]
+	{ { 100, 96, 111, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 98 2ft and 0deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 99 2ft and 0deg B[F]
+	{ { 102, 98, 52, BOARD_NO_STATE }, { 3, 4, 2, 0 } }, // 100 2ft and 0deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 101 2ft and 0deg C[F]
+	{ { 96, 100, 139, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 102 2ft and 0deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 103 2ft and 0deg D[F]
+	{ { 106, 110, 152, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 104 2ft and 45deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 105 2ft and 45deg A[F]
+	{ { 108, 104, 119, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 106 2ft and 45deg B[T]
+	{ { 104, 110, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 107 2ft and 45deg B[F]
+	{ { 110, 106, 60, BOARD_NO_STATE }, { 1, 2, 9, 0 } }, // 108 2ft and 45deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 109 2ft and 45deg C[F]
+	{ { 104, 108, 102, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 110 2ft and 45deg D[T]
+	{ { 106, 104, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 111 2ft and 45deg D[F]
+	{ { 114, 118, 160, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 112 2ft and 135deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 113 2ft and 135deg A[F]
+	{ { 116, 112, 122, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 114 2ft and 135deg B[T]
+	{ { 112, 118, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 115 2ft and 135deg B[F]
+	{ { 118, 114, 68, BOARD_NO_STATE }, { 1, 2, 9, 0 } }, // 116 2ft and 135deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 117 2ft and 135deg C[F]
+	{ { 112, 116, 107, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 118 2ft and 135deg D[T]
+	{ { 114, 112, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 119 2ft and 135deg D[F]
+	{ { 122, 126, 168, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 120 2ft and 180deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 121 2ft and 180deg A[F]
+	{ { 124, 120, 135, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 122 2ft and 180deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 123 2ft and 180deg B[F]
+	{ { 126, 122, 76, BOARD_NO_STATE }, { 3, 4, 2, 0 } }, // 124 2ft and 180deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 125 2ft and 180deg C[F]
+	{ { 120, 124, 115, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 126 2ft and 180deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 127 2ft and 180deg D[F]
+	{ { 130, 134, 176, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 128 2ft and 225deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 129 2ft and 225deg A[F]
+	{ { 132, 128, 143, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 130 2ft and 225deg B[T]
+	{ { 128, 134, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 131 2ft and 225deg B[F]
+	{ { 134, 130, 84, BOARD_NO_STATE }, { 1, 2, 9, 0 } }, // 132 2ft and 225deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 133 2ft and 225deg C[F]
+	{ { 128, 132, 126, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 134 2ft and 225deg D[T]
+	{ { 130, 128, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 135 2ft and 225deg D[F]
+	{ { 138, 142, 184, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 136 2ft and 315deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 137 2ft and 315deg A[F]
+	{ { 140, 136, 98, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 138 2ft and 315deg B[T]
+	{ { 136, 142, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 139 2ft and 315deg B[F]
+	{ { 142, 138, 92, BOARD_NO_STATE }, { 1, 2, 9, 0 } }, // 140 2ft and 315deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 141 2ft and 315deg C[F]
+	{ { 136, 140, 131, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 142 2ft and 315deg D[T]
+	{ { 138, 136, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 143 2ft and 315deg D[F]
+	{ { 146, 150, 192, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 144 3ft and 0deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 145 3ft and 0deg A[F]
+	{ { 148, 144, 159, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 146 3ft and 0deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 147 3ft and 0deg B[F]
+	{ { 150, 146, 100, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 148 3ft and 0deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 149 3ft and 0deg C[F]
+	{ { 144, 148, 187, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 150 3ft and 0deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 151 3ft and 0deg D[F]
+	{ { 154, 158, 200, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 152 3ft and 45deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 153 3ft and 45deg A[F]
+	{ { 156, 152, 167, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 154 3ft and 45deg B[T]
+	{ { 152, 158, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 155 3ft and 45deg B[F]
+	{ { 158, 154, 108, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 156 3ft and 45deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 157 3ft and 45deg C[F]
+	{ { 152, 156, 150, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 158 3ft and 45deg D[T]
+	{ { 154, 152, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 159 3ft and 45deg D[F]
+	{ { 162, 166, 216, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 160 3ft and 135deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 161 3ft and 135deg A[F]
+	{ { 164, 160, 170, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 162 3ft and 135deg B[T]
+	{ { 160, 166, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 163 3ft and 135deg B[F]
+	{ { 166, 162, 116, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 164 3ft and 135deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 165 3ft and 135deg C[F]
+	{ { 160, 164, 155, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 166 3ft and 135deg D[T]
+	{ { 162, 160, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 167 3ft and 135deg D[F]
+	{ { 170, 174, 224, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 168 3ft and 180deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 169 3ft and 180deg A[F]
+	{ { 172, 168, 183, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 170 3ft and 180deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 171 3ft and 180deg B[F]
+	{ { 174, 170, 124, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 172 3ft and 180deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 173 3ft and 180deg C[F]
+	{ { 168, 172, 163, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 174 3ft and 180deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 175 3ft and 180deg D[F]
+	{ { 178, 182, 232, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 176 3ft and 225deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 177 3ft and 225deg A[F]
+	{ { 180, 176, 191, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 178 3ft and 225deg B[T]
+	{ { 176, 182, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 179 3ft and 225deg B[F]
+	{ { 182, 178, 132, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 180 3ft and 225deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 181 3ft and 225deg C[F]
+	{ { 176, 180, 174, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 182 3ft and 225deg D[T]
+	{ { 178, 176, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 183 3ft and 225deg D[F]
+	{ { 186, 190, 248, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 184 3ft and 315deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 185 3ft and 315deg A[F]
+	{ { 188, 184, 146, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 186 3ft and 315deg B[T]
+	{ { 184, 190, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 187 3ft and 315deg B[F]
+	{ { 190, 186, 140, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 188 3ft and 315deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 189 3ft and 315deg C[F]
+	{ { 184, 188, 179, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 190 3ft and 315deg D[T]
+	{ { 186, 184, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 191 3ft and 315deg D[F]
+	{ { 194, 198, 256, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 192 4ft and 0deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 193 4ft and 0deg A[F]
+	{ { 196, 192, 207, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 194 4ft and 0deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 195 4ft and 0deg B[F]
+	{ { 198, 194, 148, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 196 4ft and 0deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 197 4ft and 0deg C[F]
+	{ { 192, 196, 251, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 198 4ft and 0deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 199 4ft and 0deg D[F]
+	{ { 202, 206, 264, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 200 4ft and 45deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 201 4ft and 45deg A[F]
+	{ { 204, 200, 210, BOARD_NO_STATE }, { 1, 6, 2, 0 } }, // 202 4ft and 45deg B[T]
+	{ { 200, 206, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 203 4ft and 45deg B[F]
+	{ { 206, 202, 156, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 204 4ft and 45deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 205 4ft and 45deg C[F]
+	{ { 200, 204, 198, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 206 4ft and 45deg D[T]
+	{ { 202, 200, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 207 4ft and 45deg D[F]
+	{ { 210, 214, 272, BOARD_NO_STATE }, { 3, 4, 1, 0 } }, // 208 4ft and 90deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 209 4ft and 90deg A[F]
+	{ { 212, 208, 223, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 210 4ft and 90deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 211 4ft and 90deg B[F]
+	{ { 214, 210, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 212 4ft and 90deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 213 4ft and 90deg C[F]
+	{ { 208, 212, 203, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 214 4ft and 90deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 215 4ft and 90deg D[F]
+	{ { 218, 222, 280, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 216 4ft and 135deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 217 4ft and 135deg A[F]
+	{ { 220, 216, 226, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 218 4ft and 135deg B[T]
+	{ { 216, 222, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 219 4ft and 135deg B[F]
+	{ { 222, 218, 164, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 220 4ft and 135deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 221 4ft and 135deg C[F]
+	{ { 216, 220, 214, BOARD_NO_STATE }, { 5, 2, 2, 0 } }, // 222 4ft and 135deg D[T]
+	{ { 218, 216, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 223 4ft and 135deg D[F]
+	{ { 226, 230, 288, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 224 4ft and 180deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 225 4ft and 180deg A[F]
+	{ { 228, 224, 239, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 226 4ft and 180deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 227 4ft and 180deg B[F]
+	{ { 230, 226, 172, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 228 4ft and 180deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 229 4ft and 180deg C[F]
+	{ { 224, 228, 219, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 230 4ft and 180deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 231 4ft and 180deg D[F]
+	{ { 234, 238, 296, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 232 4ft and 225deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 233 4ft and 225deg A[F]
+	{ { 236, 232, 242, BOARD_NO_STATE }, { 1, 6, 2, 0 } }, // 234 4ft and 225deg B[T]
+	{ { 232, 238, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 235 4ft and 225deg B[F]
+	{ { 238, 234, 180, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 236 4ft and 225deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 237 4ft and 225deg C[F]
+	{ { 232, 236, 230, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 238 4ft and 225deg D[T]
+	{ { 234, 232, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 239 4ft and 225deg D[F]
+	{ { 242, 246, 304, BOARD_NO_STATE }, { 3, 4, 1, 0 } }, // 240 4ft and 270deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 241 4ft and 270deg A[F]
+	{ { 244, 240, 255, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 242 4ft and 270deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 243 4ft and 270deg B[F]
+	{ { 246, 242, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 244 4ft and 270deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 245 4ft and 270deg C[F]
+	{ { 240, 244, 235, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 246 4ft and 270deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 247 4ft and 270deg D[F]
+	{ { 250, 254, 312, BOARD_NO_STATE }, { 5, 6, 3, 0 } }, // 248 4ft and 315deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 249 4ft and 315deg A[F]
+	{ { 252, 248, 194, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 250 4ft and 315deg B[T]
+	{ { 248, 254, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 251 4ft and 315deg B[F]
+	{ { 254, 250, 188, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 252 4ft and 315deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 253 4ft and 315deg C[F]
+	{ { 248, 252, 246, BOARD_NO_STATE }, { 5, 2, 2, 0 } }, // 254 4ft and 315deg D[T]
+	{ { 250, 248, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 255 4ft and 315deg D[F]
+	{ { 258, 262, 324, BOARD_NO_STATE }, { 3, 4, 2, 0 } }, // 256 5ft and 0deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 257 5ft and 0deg A[F]
+	{ { 260, 256, 271, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 258 5ft and 0deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 259 5ft and 0deg B[F]
+	{ { 262, 258, 196, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 260 5ft and 0deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 261 5ft and 0deg C[F]
+	{ { 256, 260, 315, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 262 5ft and 0deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 263 5ft and 0deg D[F]
+	{ { 266, 270, 332, BOARD_NO_STATE }, { 5, 6, 9, 0 } }, // 264 5ft and 45deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 265 5ft and 45deg A[F]
+	{ { 268, 264, 274, BOARD_NO_STATE }, { 1, 6, 2, 0 } }, // 266 5ft and 45deg B[T]
+	{ { 264, 270, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 267 5ft and 45deg B[F]
+	{ { 270, 266, 204, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 268 5ft and 45deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 269 5ft and 45deg C[F]
+	{ { 264, 268, 262, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 270 5ft and 45deg D[T]
+	{ { 266, 264, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 271 5ft and 45deg D[F]
+	{ { 274, 278, 336, BOARD_NO_STATE }, { 3, 4, 1, 0 } }, // 272 5ft and 90deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 273 5ft and 90deg A[F]
+	{ { 276, 272, 287, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 274 5ft and 90deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 275 5ft and 90deg B[F]
+	{ { 278, 274, 212, BOARD_NO_STATE }, { 3, 4, 1, 0 } }, // 276 5ft and 90deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 277 5ft and 90deg C[F]
+	{ { 272, 276, 267, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 278 5ft and 90deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 279 5ft and 90deg D[F]
+	{ { 282, 286, 348, BOARD_NO_STATE }, { 5, 6, 9, 0 } }, // 280 5ft and 135deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 281 5ft and 135deg A[F]
+	{ { 284, 280, 290, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 282 5ft and 135deg B[T]
+	{ { 280, 286, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 283 5ft and 135deg B[F]
+	{ { 286, 282, 220, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 284 5ft and 135deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 285 5ft and 135deg C[F]
+	{ { 280, 284, 278, BOARD_NO_STATE }, { 5, 2, 2, 0 } }, // 286 5ft and 135deg D[T]
+	{ { 282, 280, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 287 5ft and 135deg D[F]
+	{ { 290, 294, 356, BOARD_NO_STATE }, { 3, 4, 2, 0 } }, // 288 5ft and 180deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 289 5ft and 180deg A[F]
+	{ { 292, 288, 303, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 290 5ft and 180deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 291 5ft and 180deg B[F]
+	{ { 294, 290, 228, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 292 5ft and 180deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 293 5ft and 180deg C[F]
+	{ { 288, 292, 283, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 294 5ft and 180deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 295 5ft and 180deg D[F]
+	{ { 298, 302, 364, BOARD_NO_STATE }, { 5, 6, 9, 0 } }, // 296 5ft and 225deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 297 5ft and 225deg A[F]
+	{ { 300, 296, 306, BOARD_NO_STATE }, { 1, 6, 2, 0 } }, // 298 5ft and 225deg B[T]
+	{ { 296, 302, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 299 5ft and 225deg B[F]
+	{ { 302, 298, 236, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 300 5ft and 225deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 301 5ft and 225deg C[F]
+	{ { 296, 300, 294, BOARD_NO_STATE }, { 5, 2, 3, 0 } }, // 302 5ft and 225deg D[T]
+	{ { 298, 296, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 303 5ft and 225deg D[F]
+	{ { 306, 310, 368, BOARD_NO_STATE }, { 3, 4, 1, 0 } }, // 304 5ft and 270deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 305 5ft and 270deg A[F]
+	{ { 308, 304, 319, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 306 5ft and 270deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 307 5ft and 270deg B[F]
+	{ { 310, 306, 244, BOARD_NO_STATE }, { 3, 4, 1, 0 } }, // 308 5ft and 270deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 309 5ft and 270deg C[F]
+	{ { 304, 308, 299, BOARD_NO_STATE }, { 3, 4, 3, 0 } }, // 310 5ft and 270deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 311 5ft and 270deg D[F]
+	{ { 314, 318, 380, BOARD_NO_STATE }, { 5, 6, 9, 0 } }, // 312 5ft and 315deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 313 5ft and 315deg A[F]
+	{ { 316, 312, 258, BOARD_NO_STATE }, { 1, 6, 3, 0 } }, // 314 5ft and 315deg B[T]
+	{ { 312, 318, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 315 5ft and 315deg B[F]
+	{ { 318, 314, 252, BOARD_NO_STATE }, { 1, 2, 3, 0 } }, // 316 5ft and 315deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 317 5ft and 315deg C[F]
+	{ { 312, 316, 310, BOARD_NO_STATE }, { 5, 2, 2, 0 } }, // 318 5ft and 315deg D[T]
+	{ { 314, 312, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 319 5ft and 315deg D[F]
+	{ { 322, 326, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 320 Outer and 0deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 321 Outer and 0deg A[F]
+	{ { 324, 320, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 322 Outer and 0deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 323 Outer and 0deg B[F]
+	{ { 326, 322, 386, 256 }, { 3, 4, 11, 4 } }, // 324 Outer and 0deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 325 Outer and 0deg C[F]
+	{ { 320, 324, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 326 Outer and 0deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 327 Outer and 0deg D[F]
+	{ { 330, 334, BOARD_NO_STATE, BOARD_NO_STATE }, { 5, 6, 0, 0 } }, // 328 Outer and 45deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 329 Outer and 45deg A[F]
+	{ { 332, 328, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 6, 0, 0 } }, // 330 Outer and 45deg B[T]
+	{ { 328, 334, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 331 Outer and 45deg B[F]
+	{ { 334, 330, 394, 264 }, { 1, 2, 11, 3 } }, // 332 Outer and 45deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 333 Outer and 45deg C[F]
+	{ { 328, 332, BOARD_NO_STATE, BOARD_NO_STATE }, { 5, 2, 0, 0 } }, // 334 Outer and 45deg D[T]
+	{ { 330, 328, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 335 Outer and 45deg D[F]
+	{ { 338, 342, 402, BOARD_NO_STATE }, { 3, 4, 10, 0 } }, // 336 Outer and 90deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 337 Outer and 90deg A[F]
+	{ { 340, 336, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 338 Outer and 90deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 339 Outer and 90deg B[F]
+	{ { 342, 338, 276, BOARD_NO_STATE }, { 3, 4, 1, 0 } }, // 340 Outer and 90deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 341 Outer and 90deg C[F]
+	{ { 336, 340, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 342 Outer and 90deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 343 Outer and 90deg D[F]
+	{ { 346, 350, BOARD_NO_STATE, BOARD_NO_STATE }, { 5, 6, 0, 0 } }, // 344 Outer and 135deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 345 Outer and 135deg A[F]
+	{ { 348, 344, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 6, 0, 0 } }, // 346 Outer and 135deg B[T]
+	{ { 344, 350, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 347 Outer and 135deg B[F]
+	{ { 350, 346, 410, 280 }, { 1, 2, 11, 3 } }, // 348 Outer and 135deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 349 Outer and 135deg C[F]
+	{ { 344, 348, BOARD_NO_STATE, BOARD_NO_STATE }, { 5, 2, 0, 0 } }, // 350 Outer and 135deg D[T]
+	{ { 346, 344, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 351 Outer and 135deg D[F]
+	{ { 354, 358, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 352 Outer and 180deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 353 Outer and 180deg A[F]
+	{ { 356, 352, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 354 Outer and 180deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 355 Outer and 180deg B[F]
+	{ { 358, 354, 418, 288 }, { 3, 4, 11, 4 } }, // 356 Outer and 180deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 357 Outer and 180deg C[F]
+	{ { 352, 356, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 358 Outer and 180deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 359 Outer and 180deg D[F]
+	{ { 362, 366, BOARD_NO_STATE, BOARD_NO_STATE }, { 5, 6, 0, 0 } }, // 360 Outer and 225deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 361 Outer and 225deg A[F]
+	{ { 364, 360, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 6, 0, 0 } }, // 362 Outer and 225deg B[T]
+	{ { 360, 366, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 363 Outer and 225deg B[F]
+	{ { 366, 362, 426, 296 }, { 1, 2, 11, 3 } }, // 364 Outer and 225deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 365 Outer and 225deg C[F]
+	{ { 360, 364, BOARD_NO_STATE, BOARD_NO_STATE }, { 5, 2, 0, 0 } }, // 366 Outer and 225deg D[T]
+	{ { 362, 360, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 367 Outer and 225deg D[F]
+	{ { 370, 374, 434, BOARD_NO_STATE }, { 3, 4, 10, 0 } }, // 368 Outer and 270deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 369 Outer and 270deg A[F]
+	{ { 372, 368, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 370 Outer and 270deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 371 Outer and 270deg B[F]
+	{ { 374, 370, 308, BOARD_NO_STATE }, { 3, 4, 1, 0 } }, // 372 Outer and 270deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 373 Outer and 270deg C[F]
+	{ { 368, 372, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 4, 0, 0 } }, // 374 Outer and 270deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 375 Outer and 270deg D[F]
+	{ { 378, 382, BOARD_NO_STATE, BOARD_NO_STATE }, { 5, 6, 0, 0 } }, // 376 Outer and 315deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 377 Outer and 315deg A[F]
+	{ { 380, 376, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 6, 0, 0 } }, // 378 Outer and 315deg B[T]
+	{ { 376, 382, BOARD_NO_STATE, BOARD_NO_STATE }, { 1, 4, 0, 0 } }, // 379 Outer and 315deg B[F]
+	{ { 382, 378, 442, 312 }, { 1, 2, 11, 3 } }, // 380 Outer and 315deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 381 Outer and 315deg C[F]
+	{ { 376, 380, BOARD_NO_STATE, BOARD_NO_STATE }, { 5, 2, 0, 0 } }, // 382 Outer and 315deg D[T]
+	{ { 378, 376, BOARD_NO_STATE, BOARD_NO_STATE }, { 3, 2, 0, 0 } }, // 383 Outer and 315deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 384 Outer drop and 0deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 385 Outer drop and 0deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 324 }, { 0, 0, 0, 1 } }, // 386 Outer drop and 0deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 387 Outer drop and 0deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 388 Outer drop and 0deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 389 Outer drop and 0deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 390 Outer drop and 0deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 391 Outer drop and 0deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 392 Outer drop and 45deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 393 Outer drop and 45deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 332 }, { 0, 0, 0, 1 } }, // 394 Outer drop and 45deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 395 Outer drop and 45deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 396 Outer drop and 45deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 397 Outer drop and 45deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 398 Outer drop and 45deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 399 Outer drop and 45deg D[F]
+	{ { 402, 402, 340, BOARD_NO_STATE }, { 7, 8, 1, 0 } }, // 400 Start and 90deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 401 Start and 90deg A[F]
+	{ { 400, 400, BOARD_NO_STATE, BOARD_NO_STATE }, { 7, 8, 0, 0 } }, // 402 Start and 90deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 403 Start and 90deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 404 Start and 90deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 405 Start and 90deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 406 Start and 90deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 407 Start and 90deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 408 Outer drop and 135deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 409 Outer drop and 135deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 348 }, { 0, 0, 0, 1 } }, // 410 Outer drop and 135deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 411 Outer drop and 135deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 412 Outer drop and 135deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 413 Outer drop and 135deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 414 Outer drop and 135deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 415 Outer drop and 135deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 416 Outer drop and 180deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 417 Outer drop and 180deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 356 }, { 0, 0, 0, 1 } }, // 418 Outer drop and 180deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 419 Outer drop and 180deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 420 Outer drop and 180deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 421 Outer drop and 180deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 422 Outer drop and 180deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 423 Outer drop and 180deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 424 Outer drop and 225deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 425 Outer drop and 225deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 364 }, { 0, 0, 0, 1 } }, // 426 Outer drop and 225deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 427 Outer drop and 225deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 428 Outer drop and 225deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 429 Outer drop and 225deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 430 Outer drop and 225deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 431 Outer drop and 225deg D[F]
+	{ { 434, 434, 372, BOARD_NO_STATE }, { 7, 8, 1, 0 } }, // 432 Start and 270deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 433 Start and 270deg A[F]
+	{ { 432, 432, BOARD_NO_STATE, BOARD_NO_STATE }, { 7, 8, 0, 0 } }, // 434 Start and 270deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 435 Start and 270deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 436 Start and 270deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 437 Start and 270deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 438 Start and 270deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 439 Start and 270deg D[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 440 Outer drop and 315deg A[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 441 Outer drop and 315deg A[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, 380 }, { 0, 0, 0, 1 } }, // 442 Outer drop and 315deg B[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 443 Outer drop and 315deg B[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 444 Outer drop and 315deg C[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 445 Outer drop and 315deg C[F]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 446 Outer drop and 315deg D[T]
+	{ { BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE, BOARD_NO_STATE }, { 0, 0, 0, 0 } }, // 447 Outer drop and 315deg D[F]
+};
+
+// index of the first BOARD_PREDECESSORS entry of each state
+static const uint16_t BOARD_PREDECESSOR_START[BOARD_STATE_COUNT + 1] PROGMEM = {
+	   0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,    2,    2,    2,    2,    2,
+	   2,    2,    2,    3,    3,    3,    3,    3,    3,    3,    3,    4,    4,    4,    4,    4,
+	   4,    4,    4,    5,    5,    5,    5,    5,    5,    5,    5,    6,    6,    6,    6,    6,
+	   6,    8,    8,   11,   11,   15,   15,   18,   18,   22,   22,   25,   26,   30,   30,   33,
+	  34,   38,   38,   41,   42,   46,   46,   49,   50,   52,   52,   55,   55,   59,   59,   62,
+	  62,   66,   66,   69,   70,   74,   74,   77,   78,   82,   82,   85,   86,   90,   90,   93,
+	  94,   97,   97,  100,  100,  104,  104,  107,  107,  112,  112,  115,  116,  120,  120,  123,
+	 124,  129,  129,  132,  133,  137,  137,  140,  141,  144,  144,  147,  147,  151,  151,  154,
+	 154,  159,  159,  162,  163,  167,  167,  170,  171,  176,  176,  179,  180,  184,  184,  187,
+	 188,  191,  191,  194,  194,  197,  197,  200,  200,  205,  205,  208,  209,  212,  212,  215,
+	 216,  221,  221,  224,  225,  228,  228,  231,  232,  235,  235,  238,  238,  241,  241,  244,
+	 244,  249,  249,  252,  253,  256,  256,  259,  260,  265,  265,  268,  269,  272,  272,  275,
+	 276,  279,  279,  282,  282,  285,  285,  288,  288,  293,  293,  296,  297,  300,  300,  303,
+	 304,  306,  306,  309,  309,  312,  312,  315,  315,  320,  320,  323,  324,  327,  327,  330,
+	 331,  334,  334,  337,  337,  340,  340,  343,  343,  348,  348,  351,  352,  355,  355,  358,
+	 359,  361,  361,  364,  364,  367,  367,  370,  370,  375,  375,  378,  379,  382,  382,  385,
+	 386,  390,  390,  393,  393,  395,  395,  398,  398,  404,  404,  407,  408,  410,  410,  413,
+	 414,  417,  417,  420,  420,  423,  423,  426,  426,  432,  432,  435,  436,  438,  438,  441,
+	 442,  446,  446,  449,  449,  451,  451,  454,  454,  460,  460,  463,  464,  466,  466,  469,
+	 470,  473,  473,  476,  476,  479,  479,  482,  482,  488,  488,  491,  492,  494,  494,  497,
+	 498,  500,  500,  502,  502,  506,  506,  508,  508,  512,  512,  515,  515,  519,  519,  522,
+	 522,  525,  525,  527,  527,  530,  530,  532,  532,  536,  536,  539,  539,  543,  543,  546,
+	 546,  548,  548,  550,  550,  554,  554,  556,  556,  560,  560,  563,  563,  567,  567,  570,
+	 570,  573,  573,  575,  575,  578,  578,  580,  580,  584,  584,  587,  587,  591,  591,  594,
+	 594,  594,  594,  595,  595,  595,  595,  595,  595,  595,  595,  596,  596,  596,  596,  596,
+	 596,  598,  598,  601,  601,  601,  601,  601,  601,  601,  601,  602,  602,  602,  602,  602,
+	 602,  602,  602,  603,  603,  603,  603,  603,  603,  603,  603,  604,  604,  604,  604,  604,
+	 604,  606,  606,  609,  609,  609,  609,  609,  609,  609,  609,  610,  610,  610,  610,  610,
+	 610, 
+};
+
+#define BOARD_EDGE_COUNT 610
+
+// state * ROUTE_COMMAND_COUNT + command for every move into the state
+static const uint16_t BOARD_PREDECESSORS[BOARD_EDGE_COUNT] PROGMEM = {
+	 210,  242,  274,  306,  338,  370,  201,  216,  192,  209,  362,   11,  200,  217,  402,  193,
+	 208,  250,  233,  236,  248,  253,  224,  241,  252,  282,   43,  232,  249,  434,  225,  237,
+	 240,  202,  265,  268,  280,  285,  256,  273,  284,  314,   75,  264,  281,  466,  257,  269,
+	 272,  234,  297,  312,  266,  288,  305,  107,  296,  313,  498,  289,  304,  346,  329,  332,
+	 344,  349,  320,  337,  348,  378,  139,  328,  345,  530,  321,  333,  336,  298,  361,  364,
+	 376,  381,  352,  369,  380,  218,  171,  360,  377,  562,  353,  365,  368,  330,  194,  393,
+	 408,  384,  401,  554,  211,  392,  409,  594,  385,  400,  442,  226,  425,  428,  440,  445,
+	 416,  433,  444,  474,  243,  424,  441,  626,  417,  429,  432,  394,  258,  457,  460,  472,
+	 477,  448,  465,  476,  506,  275,  456,  473,  658,  449,  461,  464,  426,  290,  489,  504,
+	 458,  480,  497,  307,  488,  505,  690,  481,  496,  538,  322,  521,  524,  536,  541,  512,
+	 529,  540,  570,  339,  520,  537,  722,  513,  525,  528,  490,  354,  553,  556,  568,  573,
+	 544,  561,  572,  410,  371,  552,  569,  754,  545,  557,  560,  522,  386,  585,  600,  576,
+	 593,  746,  584,  601,  786,  577,  592,  634,  418,  617,  620,  632,  637,  608,  625,  636,
+	 666,  616,  633,  818,  609,  621,  624,  586,  450,  649,  652,  664,  669,  640,  657,  668,
+	 698,  648,  665,  882,  641,  653,  656,  618,  482,  681,  696,  650,  672,  689,  680,  697,
+	 914,  673,  688,  730,  514,  713,  716,  728,  733,  704,  721,  732,  762,  712,  729,  946,
+	 705,  717,  720,  682,  546,  745,  748,  760,  765,  736,  753,  764,  602,  744,  761, 1010,
+	 737,  749,  752,  714,  578,  777,  792,  768,  785, 1002,  776,  793, 1042,  769,  784,  826,
+	 610,  809,  812,  824,  829,  800,  817,  828,  858,  808,  825, 1074,  801,  813,  816,  778,
+	 841,  856,  810,  832,  849,  840,  857, 1106,  833,  848,  890,  642,  873,  876,  888,  893,
+	 864,  881,  892,  922,  872,  889, 1138,  865,  877,  880,  842,  674,  905,  920,  874,  896,
+	 913,  904,  921, 1170,  897,  912,  954,  706,  937,  940,  952,  957,  928,  945,  956,  986,
+	 936,  953, 1202,  929,  941,  944,  906,  969,  984,  938,  960,  977,  968,  985, 1234,  961,
+	 976, 1018,  738, 1001, 1004, 1016, 1021,  992, 1009, 1020,  794, 1000, 1017, 1266,  993, 1005,
+	1008,  970,  770, 1033, 1048, 1299, 1024, 1041, 1258, 1032, 1049, 1025, 1040, 1082,  802, 1065,
+	1068, 1080, 1085, 1331, 1056, 1073, 1084, 1114, 1064, 1081, 1057, 1069, 1072, 1034,  834, 1097,
+	1112, 1066, 1088, 1105, 1096, 1113, 1362, 1089, 1104, 1146,  866, 1129, 1132, 1144, 1149, 1395,
+	1120, 1137, 1148, 1178, 1128, 1145, 1121, 1133, 1136, 1098,  898, 1161, 1176, 1427, 1130, 1152,
+	1169, 1160, 1177, 1153, 1168, 1210,  930, 1193, 1196, 1208, 1213, 1459, 1184, 1201, 1212, 1242,
+	1192, 1209, 1185, 1197, 1200, 1162,  962, 1225, 1240, 1194, 1216, 1233, 1224, 1241, 1490, 1217,
+	1232, 1274,  994, 1257, 1260, 1272, 1277, 1523, 1248, 1265, 1276, 1050, 1256, 1273, 1249, 1261,
+	1264, 1226, 1289, 1304, 1280, 1297, 1026, 1288, 1305, 1547, 1281, 1296, 1321, 1324, 1336, 1341,
+	1312, 1329, 1340, 1058, 1320, 1337, 1579, 1313, 1325, 1328, 1090, 1353, 1368, 1344, 1361, 1352,
+	1369, 1602, 1345, 1360, 1385, 1388, 1400, 1405, 1376, 1393, 1404, 1122, 1384, 1401, 1643, 1377,
+	1389, 1392, 1417, 1432, 1408, 1425, 1154, 1416, 1433, 1675, 1409, 1424, 1449, 1452, 1464, 1469,
+	1440, 1457, 1468, 1186, 1448, 1465, 1707, 1441, 1453, 1456, 1218, 1481, 1496, 1472, 1489, 1480,
+	1497, 1730, 1473, 1488, 1513, 1516, 1528, 1533, 1504, 1521, 1532, 1250, 1512, 1529, 1771, 1505,
+	1517, 1520, 1298, 1330, 1608, 1609, 1346, 1600, 1601, 1394, 1426, 1458, 1736, 1737, 1474, 1728,
+	1729, 1522, 
+};
+
+static const uint8_t BOARD_TOKEN_ROUNDS[BOARD_INTERSECTION_COUNT] PROGMEM = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+	0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const char BOARD_INTERSECTION_NAMES[BOARD_INTERSECTION_COUNT][BOARD_NAME_LENGTH] PROGMEM = {
+	"Middle drop and  0deg",
+	"Middle drop and  45deg",
+	"Middle drop and  135deg",
+	"Middle drop and  180deg",
+	"Middle drop and  225deg",
+	"Middle drop and  315deg",
+	"1ft and 0deg",
+	"1ft and 45deg",
+	"1ft and 135deg",
+	"1ft and 180deg",
+	"1ft and 225deg",
+	"1ft and 315deg",
+	"2ft and 0deg",
+	"2ft and 45deg",
+	"2ft and 135deg",
+	"2ft and 180deg",
+	"2ft and 225deg",
+	"2ft and 315deg",
+	"3ft and 0deg",
+	"3ft and 45deg",
+	"3ft and 135deg",
+	"3ft and 180deg",
+	"3ft and 225deg",
+	"3ft and 315deg",
+	"4ft and 0deg",
+	"4ft and 45deg",
+	"4ft and 90deg",
+	"4ft and 135deg",
+	"4ft and 180deg",
+	"4ft and 225deg",
+	"4ft and 270deg",
+	"4ft and 315deg",
+	"5ft and 0deg",
+	"5ft and 45deg",
+	"5ft and 90deg",
+	"5ft and 135deg",
+	"5ft and 180deg",
+	"5ft and 225deg",
+	"5ft and 270deg",
+	"5ft and 315deg",
+	"Outer and 0deg",
+	"Outer and 45deg",
+	"Outer and 90deg",
+	"Outer and 135deg",
+	"Outer and 180deg",
+	"Outer and 225deg",
+	"Outer and 270deg",
+	"Outer and 315deg",
+	"Outer drop and 0deg",
+	"Outer drop and 45deg",
+	"Start and 90deg",
+	"Outer drop and 135deg",
+	"Outer drop and 180deg",
+	"Outer drop and 225deg",
+	"Start and 270deg",
+	"Outer drop and 315deg",
+};
+
+#endif
@@ -0,0 +1,252 @@
+#include "IncrementalPlanner.h"
+
+
+IncrementalPlanner::IncrementalPlanner()
+{
+	// about 3.5 KB; on the Arduino new gives 0 when it does not fit, and the planner then plans nothing
+	g = new uint16_t[BOARD_STATE_COUNT];
+	rhs = new uint16_t[BOARD_STATE_COUNT];
+	heap = new uint16_t[BOARD_STATE_COUNT];
+	heapPos = new uint16_t[BOARD_STATE_COUNT];
+	memset(blocked, 0, sizeof(blocked));
+	if (!g || !rhs || !heap || !heapPos) {
+		release();
+		return;
+	}
+	for (uint16_t i = 0; i < BOARD_STATE_COUNT; i++) {
+		g[i] = ROUTE_UNREACHED;
+		rhs[i] = ROUTE_UNREACHED;
+		heapPos[i] = ROUTE_UNREACHED;
+	}
+}
+
+
+IncrementalPlanner::~IncrementalPlanner()
+{
+	release();
+}
+
+
+void IncrementalPlanner::release() {
+	delete[] g;
+	delete[] rhs;
+	delete[] heap;
+	delete[] heapPos;
+	g = rhs = heap = heapPos = nullptr;
+}
+
+
+void IncrementalPlanner::setTarget(uint8_t newTarget) {
+	target = newTarget;
+	heapSize = 0;
+	if (!getIfAllocated()) {
+		return;
+	}
+	for (uint16_t i = 0; i < BOARD_STATE_COUNT; i++) {
+		g[i] = ROUTE_UNREACHED;
+		rhs[i] = ROUTE_UNREACHED;
+		heapPos[i] = ROUTE_UNREACHED;
+	}
+	if (target >= BOARD_INTERSECTION_COUNT) {
+		return;
+	}
+	// every state of the target intersection is a goal
+	for (uint8_t slot = 0; slot < BOARD_STATES_PER_INTERSECTION; slot++) {
+		uint16_t id = target * BOARD_STATES_PER_INTERSECTION + slot;
+		rhs[id] = 0;
+		heapPush(id);
+	}
+}
+
+
+bool IncrementalPlanner::getIfBlocked(uint16_t state, RouteCommand command) {
+	uint16_t edge = state * ROUTE_COMMAND_COUNT + command;
+	return (blocked[edge / 8] >> (edge % 8)) & 1;
+}
+
+void IncrementalPlanner::blockEdge(uint16_t state, RouteCommand command) {
+	if (state >= BOARD_STATE_COUNT || getIfBlocked(state, command)) {
+		return;
+	}
+	uint16_t edge = state * ROUTE_COMMAND_COUNT + command;
+	blocked[edge / 8] |= 1 << (edge % 8);
+	blockedCount++;
+	// only the state the edge leaves from sees a different cost
+	if (target < BOARD_INTERSECTION_COUNT && getIfAllocated()) {
+		updateState(state);
+	}
+}
+
+void IncrementalPlanner::unblockEdge(uint16_t state, RouteCommand command) {
+	if (state >= BOARD_STATE_COUNT || !getIfBlocked(state, command)) {
+		return;
+	}
+	uint16_t edge = state * ROUTE_COMMAND_COUNT + command;
+	blocked[edge / 8] &= ~(1 << (edge % 8));
+	blockedCount--;
+	if (target < BOARD_INTERSECTION_COUNT && getIfAllocated()) {
+		updateState(state);
+	}
+}
+
+void IncrementalPlanner::clearBlocked() {
+	memset(blocked, 0, sizeof(blocked));
+	blockedCount = 0;
+	target = BOARD_NO_INTERSECTION;
+	heapSize = 0;
+}
+
+
+uint16_t IncrementalPlanner::getEdgeCost(uint16_t state, RouteCommand command, uint16_t& next) {
+	next = BoardTable::getNextState(state, command);
+	if (next == BOARD_NO_STATE || getIfBlocked(state, command)) {
+		return ROUTE_UNREACHED;
+	}
+	return RoutePlanner::getMoveCost(state, command);
+}
+
+
+void IncrementalPlanner::updateState(uint16_t id) {
+	// rhs is the best one-step lookahead; goal states stay at 0
+	if (BoardTable::getIntersection(id) != target) {
+		uint16_t best = ROUTE_UNREACHED;
+		for (uint8_t c = 0; c < ROUTE_COMMAND_COUNT; c++) {
+			uint16_t next;
+			uint16_t cost = getEdgeCost(id, RouteCommand(c), next);
+			if (cost != ROUTE_UNREACHED && g[next] != ROUTE_UNREACHED && cost + g[next] < best) {
+				best = cost + g[next];
+			}
+		}
+		rhs[id] = best;
+	}
+	// only inconsistent states stay in the heap
+	bool queued = heapPos[id] < heapSize;
+	if (g[id] != rhs[id]) {
+		if (queued) {
+			heapFix(id);
+		}
+		else {
+			heapPush(id);
+		}
+	}
+	else if (queued) {
+		heapRemove(id);
+	}
+}
+
+
+void IncrementalPlanner::computeCosts() {
+	while (heapSize > 0 &&
+		(getKey(heap[0]) < getKey(start) || g[start] != rhs[start])) {
+		uint16_t id = heapPop();
+		expanded++;
+		if (g[id] > rhs[id]) {
+			// cost went down: settle it and tell the predecessors
+			g[id] = rhs[id];
+		}
+		else {
+			// cost went up: invalidate and recompute this state too
+			g[id] = ROUTE_UNREACHED;
+			updateState(id);
+		}
+		uint8_t count = BoardTable::getPredecessorCount(id);
+		for (uint8_t i = 0; i < count; i++) {
+			RouteCommand command;
+			updateState(BoardTable::getPredecessor(id, i, command));
+		}
+	}
+}
+
+
+bool IncrementalPlanner::planRoute(Route& route) {
+	route.clear();
+	expanded = 0;
+	if (!getIfAllocated() || start >= BOARD_STATE_COUNT || target >= BOARD_INTERSECTION_COUNT) {
+		return false;
+	}
+	computeCosts();
+	if (g[start] == ROUTE_UNREACHED) {
+		return false;
+	}
+	// walk down the costs: from each state take the move with the cheapest cost plus remaining cost
+	uint16_t state = start;
+	while (BoardTable::getIntersection(state) != target) {
+		uint8_t bestCommand = 0;
+		uint16_t best = ROUTE_UNREACHED;
+		uint16_t bestNext = BOARD_NO_STATE;
+		for (uint8_t c = 0; c < ROUTE_COMMAND_COUNT; c++) {
+			uint16_t next;
+			uint16_t cost = getEdgeCost(state, RouteCommand(c), next);
+			if (cost != ROUTE_UNREACHED && g[next] != ROUTE_UNREACHED && cost + g[next] < best) {
+				best = cost + g[next];
+				bestCommand = c;
+				bestNext = next;
+			}
+		}
+		if (bestNext == BOARD_NO_STATE || !route.addCommand(RouteCommand(bestCommand))) {
+			route.clear();
+			return false;
+		}
+		state = bestNext;
+	}
+	route.setCost(g[start]);
+	return true;
+}
+
+
+// heap helpers
+
+void IncrementalPlanner::heapSwap(uint16_t a, uint16_t b) {
+	uint16_t tmp = heap[a];
+	heap[a] = heap[b];
+	heap[b] = tmp;
+	heapPos[heap[a]] = a;
+	heapPos[heap[b]] = b;
+}
+
+void IncrementalPlanner::heapPush(uint16_t id) {
+	heap[heapSize] = id;
+	heapPos[id] = heapSize;
+	heapSize++;
+	heapFix(id);
+}
+
+void IncrementalPlanner::heapFix(uint16_t id) {
+	// sift up
+	uint16_t i = heapPos[id];
+	while (i > 0) {
+		uint16_t parent = (i - 1) / 2;
+		if (getKey(heap[parent]) <= getKey(heap[i])) {
+			break;
+		}
+		heapSwap(i, parent);
+		i = parent;
+	}
+	// sift down
+	while (true) {
+		uint16_t left = 2 * i + 1;
+		uint16_t right = left + 1;
+		uint16_t smallest = i;
+		if (left < heapSize && getKey(heap[left]) < getKey(heap[smallest])) smallest = left;
+		if (right < heapSize && getKey(heap[right]) < getKey(heap[smallest])) smallest = right;
+		if (smallest == i) break;
+		heapSwap(i, smallest);
+		i = smallest;
+	}
+}
+
+void IncrementalPlanner::heapRemove(uint16_t id) {
+	uint16_t i = heapPos[id];
+	heapSize--;
+	if (i != heapSize) {
+		heapSwap(i, heapSize);
+		heapFix(heap[i]);
+	}
+	heapPos[id] = ROUTE_UNREACHED;
+}
+
+uint16_t IncrementalPlanner::heapPop() {
+	uint16_t top = heap[0];
+	heapRemove(top);
+	return top;
+}
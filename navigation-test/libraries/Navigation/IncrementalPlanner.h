@@ -0,0 +1,66 @@
+#ifndef INCREMENTALPLANNER_H
+#define INCREMENTALPLANNER_H
+
+#include "Arduino.h"
+#include "BoardTable.h"
+#include "RoutePlanner.h"
+
+// one bit per (state, command) edge
+#define INCREMENTAL_BLOCKED_BYTES ((BOARD_STATE_COUNT * ROUTE_COMMAND_COUNT + 7) / 8)
+
+
+/*
+D* Lite over the BoardTable state graph with blockable edges.
+The search runs backward from the target intersection, so the robot's state can change between plans
+without losing any work. Blocking (or unblocking) an edge only re-expands the states whose cost to the
+target changes, which repairs a route in a few expansions instead of a new search.
+No heuristic is used (h = 0): keys are min(g, rhs) and the km offset of D* Lite is always 0.
+The search data takes about 3.5 KB, so Navigation only uses it on the pc (see NAVIGATION_PLANNERS).
+*/
+class IncrementalPlanner
+{
+private:
+	uint8_t target = BOARD_NO_INTERSECTION;
+	uint16_t start = BOARD_NO_STATE;
+	// per-state search data, indexed by state id
+	uint16_t* g;   // cost to the target as of the last expansion
+	uint16_t* rhs; // one-step lookahead cost to the target
+	// indexed binary min-heap of inconsistent states keyed by min(g, rhs)
+	uint16_t* heap;
+	uint16_t* heapPos;
+	uint16_t heapSize = 0;
+	uint8_t blocked[INCREMENTAL_BLOCKED_BYTES];
+	uint16_t blockedCount = 0;
+	uint16_t expanded = 0; // states expanded by the last planRoute call
+	uint16_t getKey(uint16_t id) { return g[id] < rhs[id] ? g[id] : rhs[id]; };
+	uint16_t getEdgeCost(uint16_t state, RouteCommand command, uint16_t& next);
+	void updateState(uint16_t id);
+	void computeCosts();
+	void heapPush(uint16_t id);
+	uint16_t heapPop();
+	void heapRemove(uint16_t id);
+	void heapFix(uint16_t id);
+	void heapSwap(uint16_t a, uint16_t b);
+	void release();
+public:
+	IncrementalPlanner();
+	~IncrementalPlanner();
+	bool getIfAllocated() { return g != nullptr; }; // false if the search data did not fit in memory
+	// starts over for a new target intersection; blocked edges are kept
+	void setTarget(uint8_t newTarget);
+	// the robot's state; moving does not invalidate anything
+	void setStart(uint16_t state) { start = state; };
+	// blocked edges are never used; takes effect on the next planRoute
+	void blockEdge(uint16_t state, RouteCommand command);
+	void unblockEdge(uint16_t state, RouteCommand command);
+	void clearBlocked(); // also resets the search, call setTarget again
+	bool getIfBlocked(uint16_t state, RouteCommand command);
+	uint16_t getBlockedCount() { return blockedCount; };
+	// repairs the costs as needed and fills route with the cheapest commands from start to target
+	bool planRoute(Route& route);
+	uint8_t getTarget() { return target; };
+	uint16_t getExpandedCount() { return expanded; };
+};
+
+
+#endif
@@ -3,21 +3,21 @@
 using namespace moveOptions;
 
 
-Intersection::Intersection(Movement* move, String name = "def inter name") { 
+Intersection::Intersection(Movement* move, PGM_P name) {
 	// initialize state pairs
 	stateA = new IntersectionStatePair;
 	stateB = new IntersectionStatePair;
 	stateC = new IntersectionStatePair;
 	stateD = new IntersectionStatePair;
-	// assign states to state pairs
-	stateA->To = new IntersectionState(move, this, "A[To]");
-	stateA->From = new IntersectionState(move, this, "A[From]");
-	stateB->To = new IntersectionState(move, this, "B[To]");
-	stateB->From = new IntersectionState(move, this, "B[From]");
-	stateC->To = new IntersectionState(move, this, "C[To]");
-	stateC->From = new IntersectionState(move, this, "C[From]");
-	stateD->To = new IntersectionState(move, this, "D[To]");
-	stateD->From = new IntersectionState(move, this, "D[From]");
+	// assign states to state pairs, numbered by slot (see getState)
+	stateA->To = new IntersectionState(move, this, 0);
+	stateA->From = new IntersectionState(move, this, 1);
+	stateB->To = new IntersectionState(move, this, 2);
+	stateB->From = new IntersectionState(move, this, 3);
+	stateC->To = new IntersectionState(move, this, 4);
+	stateC->From = new IntersectionState(move, this, 5);
+	stateD->To = new IntersectionState(move, this, 6);
+	stateD->From = new IntersectionState(move, this, 7);
 	movement = move;
 	intersectName = name;
 }
@@ -35,11 +35,41 @@ void Intersection::createBackwardConnection(IntersectionStatePair* localStateArr
 }
 
 
+IntersectionState* Intersection::getState(int slot) {
+	IntersectionStatePair* pairs[] = { stateA, stateB, stateC, stateD };
+	if (slot < 0 || slot >= INTERSECTION_STATE_COUNT) {
+		return nullptr;
+	}
+	IntersectionStatePair* pair = pairs[slot / 2];
+	return (slot % 2 == To) ? pair->To : pair->From;
+}
+
+
+String Intersection::getName() {
+	char buffer[INTERSECTION_NAME_LENGTH];
+	formatName(buffer, sizeof(buffer));
+	return buffer;
+}
+
+size_t Intersection::formatName(char* buffer, size_t length) {
+	if (length == 0) {
+		return 0;
+	}
+	strncpy_P(buffer, intersectName, length);
+	buffer[length - 1] = '\0';
+	return strlen(buffer);
+}
+
+bool Intersection::hasName(const char* name) {
+	return strcmp_P(name, intersectName) == 0;
+}
+
+
 Intersection::~Intersection()
 {
 }
 
-IntersectionStart::IntersectionStart(Movement* move, String name) : Intersection(move, name) {
+IntersectionStart::IntersectionStart(Movement* move, PGM_P name) : Intersection(move, name) {
 	/*
 	+---------------------------------+
 	|                                 |
@@ -70,7 +100,7 @@ IntersectionStart::IntersectionStart(Movement* move, String name) : Intersection
 }
 
 
-IntersectionI::IntersectionI(Movement* move, String name) : Intersection(move, name) {
+IntersectionI::IntersectionI(Movement* move, PGM_P name) : Intersection(move, name) {
     /*
 
                             A
@@ -113,7 +143,7 @@ IntersectionI::IntersectionI(Movement* move, String name) : Intersection(move, n
 }
 
 
-IntersectionII::IntersectionII(Movement* move, String name) : Intersection(move, name) {
+IntersectionII::IntersectionII(Movement* move, PGM_P name) : Intersection(move, name) {
     /*
 
                             A
@@ -154,7 +184,7 @@ IntersectionII::IntersectionII(Movement* move, String name) : Intersection(move,
 }
 
 
-IntersectionIII::IntersectionIII(Movement* move, String name) : Intersection(move, name) {
+IntersectionIII::IntersectionIII(Movement* move, PGM_P name) : Intersection(move, name) {
     /*
 
                                 A
@@ -194,7 +224,7 @@ IntersectionIII::IntersectionIII(Movement* move, String name) : Intersection(mov
 }
 
 
-IntersectionIV::IntersectionIV(Movement* move, String name) : Intersection(move, name) {
+IntersectionIV::IntersectionIV(Movement* move, PGM_P name) : Intersection(move, name) {
     /*
 
                             A
@@ -233,7 +263,7 @@ IntersectionIV::IntersectionIV(Movement* move, String name) : Intersection(move,
 }
 
 
-IntersectionV::IntersectionV(Movement* move, String name) : Intersection(move, name) {
+IntersectionV::IntersectionV(Movement* move, PGM_P name) : Intersection(move, name) {
     /*
 
                             A
@@ -270,7 +300,7 @@ IntersectionV::IntersectionV(Movement* move, String name) : Intersection(move, n
 }
 
 
-IntersectionDropToken::IntersectionDropToken(Movement* move, String name) : Intersection(move, name) {
+IntersectionDropToken::IntersectionDropToken(Movement* move, PGM_P name) : Intersection(move, name) {
     /*
                 A
 
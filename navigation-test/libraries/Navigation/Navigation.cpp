@@ -4,80 +4,209 @@
 Navigation::Navigation(int round_n, Movement& move)
 {
 	movement = &move; //save pointer
-	//IntersectionStart intersectionStart = IntersectionStart(movement, "Test Intersection");
-	//currentState = &intersectionStart.getStateA()[Intersection::To];
-	gameboard = new Gameboard(round_n, movement); //create gameboard
-	//IntersectionStart* start = new IntersectionStart(movement, "test intersection");
-	//currentState = start->getStateA()->To;//gameboard->getStartState(); //set current state as start state
-	currentState = gameboard->getStartState(); //set current state as start state
+	round = round_n;
+	currentState = BoardTable::getStartState(); //set current state as start state
+}
+
+
+Navigation::Navigation(const Navigation& other)
+{
+	copyFrom(other);
+}
+
+
+Navigation& Navigation::operator=(const Navigation& other)
+{
+	if (this != &other) {
+		copyFrom(other);
+		// the planners are not shared; new ones are made when needed
+		delete planner;
+		delete replanner;
+		planner = nullptr;
+		replanner = nullptr;
+	}
+	return *this;
+}
+
+
+void Navigation::copyFrom(const Navigation& other)
+{
+	movement = other.movement;
+	round = other.round;
+	currentState = other.currentState;
+	blockedCount = other.blockedCount;
+	memcpy(blockedMoves, other.blockedMoves, sizeof(blockedMoves));
 }
 
 
 Navigation::~Navigation()
 {
+	delete planner;
+	delete replanner;
 }
 
-bool Navigation::turnLeft()
+bool Navigation::move(RouteCommand command)
 {
-	// attempt to turn left and get new state
-	IntersectionState* newState = currentState->turnLeft();
-	// if new state is a null pointer, then we can't go left so return false
-	if (!newState) {
+	// look up where this move leads from the current state
+	uint16_t newState = BoardTable::getNextState(currentState, command);
+	// if there is no such state, or the move is blocked, then we can't make this move so return false
+	if (newState == BOARD_NO_STATE || getIfBlocked(currentState, command)) {
 		return false;
 	}
-	// otherwise, current state became the new state and return true
-	else {
-		currentState = newState;
-		return true;
+	// otherwise, perform the movement; current state becomes the new state
+	uint8_t moveType = BoardTable::getMove(currentState, command);
+	switch (command) {
+	case CommandLeft:
+	case CommandRight:
+		movement->performTurn(Turn(moveType));
+		break;
+	case CommandForward:
+		movement->performApproach(Approach(moveType));
+		break;
+	case CommandBackward:
+		movement->performBackwardApproach(BackwardApproach(moveType));
+		break;
 	}
+	currentState = newState;
+	return true;
 }
 
-bool Navigation::turnRight()
+String Navigation::getCurrentStateInfo()
 {
-	// attempt to turn right and get new state
-	IntersectionState* newState = currentState->turnRight();
-	// if new state is a null pointer, then we can't go right so return false
-	if (!newState) {
-		return false;
+	return "Currently at Intersection |" + BoardTable::getIntersectionName(BoardTable::getIntersection(currentState))
+		+ "| in state " + BoardTable::getStateName(currentState);
+}
+
+
+bool Navigation::planRoute(uint8_t target, Route& route)
+{
+#ifdef NAVIGATION_PLANNERS
+	if (!planner) {
+		planner = new RoutePlanner();
 	}
-	// otherwise, current state became the new state and return true
-	else {
-		currentState = newState;
-		return true;
+	if (planner && planner->getIfAllocated()) {
+		return planner->planRoute(currentState, target, route);
+	}
+#endif
+	route.clear();
+	return false;
+}
+
+bool Navigation::planRoute(String targetName, Route& route)
+{
+	return planRoute(BoardTable::findIntersection(targetName), route);
+}
+
+bool Navigation::lookupRoute(uint8_t target, Route& route)
+{
+	// the table does not know about blocked moves
+	if (blockedCount > 0) {
+		return replanRoute(target, route);
+	}
+	if (RouteTable::getIfRoutable(currentState)) {
+		return RouteTable::lookupRoute(currentState, target, route);
 	}
+	return planRoute(target, route);
 }
 
-bool Navigation::goForward()
+bool Navigation::lookupRoute(String targetName, Route& route)
 {
-	// attempt to go forward and get new state
-	IntersectionState* newState = currentState->goForward();
-	// if new state is a null pointer, then we can't go forward so return false
-	if (!newState) {
+	return lookupRoute(BoardTable::findIntersection(targetName), route);
+}
+
+bool Navigation::blockMove(RouteCommand command)
+{
+	if (BoardTable::getNextState(currentState, command) == BOARD_NO_STATE) {
 		return false;
 	}
-	// otherwise, current state became the new state and return true
-	else {
-		currentState = newState;
+	if (getIfBlocked(currentState, command)) {
 		return true;
 	}
+	if (blockedCount == NAVIGATION_MAX_BLOCKED) {
+		return false;
+	}
+	blockedMoves[blockedCount++] = currentState * ROUTE_COMMAND_COUNT + command;
+	if (replanner) {
+		replanner->blockEdge(currentState, command);
+	}
+	return true;
 }
 
-bool Navigation::goBackward()
+bool Navigation::getIfBlocked(uint16_t state, RouteCommand command)
 {
-	// attempt to go backward and get new state
-	IntersectionState* newState = currentState->goBackward();
-	// if new state is a null pointer, then we can't go backward so return false
-	if (!newState) {
+	uint16_t edge = state * ROUTE_COMMAND_COUNT + command;
+	for (uint8_t i = 0; i < blockedCount; i++) {
+		if (blockedMoves[i] == edge) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool Navigation::replanRoute(uint8_t target, Route& route)
+{
+#ifdef NAVIGATION_PLANNERS
+	if (!replanner) {
+		replanner = new IncrementalPlanner();
+		for (uint8_t i = 0; replanner && i < blockedCount; i++) {
+			replanner->blockEdge(blockedMoves[i] / ROUTE_COMMAND_COUNT,
+				RouteCommand(blockedMoves[i] % ROUTE_COMMAND_COUNT));
+		}
+	}
+	if (replanner && replanner->getIfAllocated()) {
+		if (replanner->getTarget() != target) {
+			replanner->setTarget(target);
+		}
+		replanner->setStart(currentState);
+		return replanner->planRoute(route);
+	}
+#endif
+	// no search: the table route, if it avoids every blocked move
+	if (!RouteTable::lookupRoute(currentState, target, route)) {
 		return false;
 	}
-	// otherwise, current state became the new state and return true
-	else {
-		currentState = newState;
-		return true;
+	uint16_t state = currentState;
+	for (uint8_t i = 0; i < route.getLength(); i++) {
+		if (getIfBlocked(state, route.getCommand(i))) {
+			route.clear();
+			return false;
+		}
+		state = BoardTable::getNextState(state, route.getCommand(i));
 	}
+	return true;
 }
 
-String Navigation::getCurrentStateInfo()
+bool Navigation::executePlan(Route& route)
 {
-	return "Currently at " + currentState->getFullName();
+	// check every move before starting
+	uint16_t state = currentState;
+	for (uint8_t i = 0; i < route.getLength(); i++) {
+		if (getIfBlocked(state, route.getCommand(i))) {
+			return false;
+		}
+		state = BoardTable::getNextState(state, route.getCommand(i));
+		if (state == BOARD_NO_STATE) {
+			return false;
+		}
+	}
+
+	Approach chain[MOVEMENT_MAX_CHAIN];
+	uint8_t chainLength = 0;
+	for (uint8_t i = 0; i < route.getLength(); i++) {
+		RouteCommand command = route.getCommand(i);
+		if (command != CommandForward) {
+			move(command);
+			continue;
+		}
+		chain[chainLength++] = Approach(BoardTable::getMove(currentState, command));
+		currentState = BoardTable::getNextState(currentState, command);
+		// hand the run over when the next move is not forward, at a drop position, or when the chain is full
+		bool runEnds = i + 1 == route.getLength() || route.getCommand(i + 1) != CommandForward ||
+			chain[chainLength - 1] == MoveIntoDropPosition;
+		if (runEnds || chainLength == MOVEMENT_MAX_CHAIN) {
+			movement->performApproaches(chain, chainLength);
+			chainLength = 0;
+		}
+	}
+	return true;
 }
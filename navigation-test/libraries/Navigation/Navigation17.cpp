@@ -2,132 +2,124 @@
 
 #include "Movement.h"
 
-void Navigation17::set_available_directions() {
-    // default
-    for (int i = 0; i < DIRECTION_COUNT; ++i) {
-        // all directions are not available
-        available_directions[i].t = 0;
-        available_directions[i].r = 0;
-        approaches[i] = NoApproach;
-    }
-
-    if (current_position.r > 0) {  // if not in the center
-        if (current_position.r < MAX_R) {
-            // not on outer edge of board
-            if (current_position.r < (MAX_R - 1) && current_position.r > 1) {
-                // can move around clockwise or counter clockwise
-                // TODO: any other restrictions for moving around?
-                Serial.println("in moving around areas - cw and ccw");
-
-
-                // move counter-clockwise
-                int counter_clockwise_direction = ((((current_position.t + 1) % DIRECTION_COUNT) / 2) + 1) * 2;
-                available_directions[counter_clockwise_direction].t = 1;
-                // don't stop on north or south
-                if (available_directions[counter_clockwise_direction].t == 1 &&
-                    ((current_position.t + 1) % DIRECTION_COUNT == NORTH ||
-                     (current_position.t + 1) % DIRECTION_COUNT == SOUTH)) {
-                    available_directions[counter_clockwise_direction].t = 2;
-                }
-                // approaches moving counter clockwise
-                if ((current_position.t + available_directions[counter_clockwise_direction].t) % 2) {
-                    // approaching odd direction counter clockwise
-                    approaches[counter_clockwise_direction] = FollowOnLeftUntilCrossesLine;  // TODO: verify
-                } else {
-                    // approaching even direction
-                    approaches[counter_clockwise_direction] = FollowUntilPerpendicularLine;  // TODO: verify
-                }
-
-
-                // move clockwise
-                int clockwise_direction = (((current_position.t / 2) * 2) - 2) % DIRECTION_COUNT;
-                Serial.print("clockwise direction: ");
-                Serial.println(clockwise_direction);
-                available_directions[clockwise_direction].t = -1;
-                // don't stop on north or south
-                if (available_directions[clockwise_direction].t == -1 &&
-                    ((current_position.t - 1) % DIRECTION_COUNT == NORTH ||
-                     (current_position.t - 1) % DIRECTION_COUNT == SOUTH)) {
-                    available_directions[counter_clockwise_direction].t = -2;
-                }
-                // approaches moving clockwise
-                if ((current_position.t + available_directions[clockwise_direction].t) % 2) {
-                    // approaching odd direction clockwise
-                    approaches[counter_clockwise_direction] = FollowOnRightUntilCrossesLine;  // TODO: verify
-                } else {
-                    // approaching even direction
-                    approaches[counter_clockwise_direction] = FollowUntilPerpendicularLine;  // TODO: verify
-                }
-
-            }
-            else {
-                // this is entrances to all the drop areas (r = 1 and r = MAX - 1)
-                // TODO: special approach code goes here maybe, actually probably not
-                // or it will be overwritten in the move out and move in sections
-            }
-
-            // move out
-            available_directions[current_position.t].r = 1;
-            // approaches moving out
-            if (current_position.t % 2) {
-                // moving out in odd direction
-                approaches[current_position.t] = FollowUntilCrossingY;  // TODO: verify
-            }
-            // moving out in even direction is below with moving in
-        }
-        // move in
-        int in_direction = opposite(Direction(current_position.t));
-        available_directions[in_direction].r = -1;
-        // approaches moving in
-        if (current_position.t % 2) {
-            // moving in in odd direction
-            approaches[in_direction] = FollowUntilSeparatingY;  // TODO: verify
-        }
-        else {
-            // in and out in even directions
-            if (current_position.t == NORTH || current_position.t == SOUTH) {
-                approaches[NORTH] = NoFollowUntilPerpendicularLine;  // TODO: verify
-                approaches[SOUTH] = NoFollowUntilPerpendicularLine;  // TODO: verify
-            } else {
-                // east and west
-                approaches[EAST] = FollowUntilPerpendicularLine;  // TODO: verify
-                approaches[WEST] = FollowUntilPerpendicularLine;  // TODO: verify
-            }
-        }
-        // except at extreme r when there are drop positions
-        if (current_position.r == MAX_R - 1) {
-            approaches[current_position.t] = MoveIntoDropPosition;  // TODO: could be start area, but why would that be different?
-        }
-        else if (current_position.r == 1) {
-            approaches[in_direction] = MoveIntoDropPosition;
-        }
+/* Move table
+ * The moves from a position only depend on (t, r), so every cell is worked out at compile time.
+ * Entry per direction: bits 0-3 Approach, bits 4-6 t step (mod DIRECTION_COUNT), bits 7-8 r step + 1.
+ * A direction is not available when both steps are 0.
+ * Later rules take priority, in the same order the moves used to be filled in after every move.
+ */
+namespace {
+    const int MAX_R = Navigation17::MAX_R;
+
+    constexpr int counter_clockwise_direction(int t) {
+        return (((((t + 1) % DIRECTION_COUNT) / 2) + 1) * 2) % DIRECTION_COUNT;
+    }
+    constexpr int clockwise_direction(int t) {
+        return (((t / 2) * 2) - 2 + DIRECTION_COUNT) % DIRECTION_COUNT;
+    }
+    constexpr int in_direction(int t) {
+        return (t + DIRECTION_COUNT / 2) % DIRECTION_COUNT;
+    }
+    /** can move around clockwise or counter clockwise - TODO: any other restrictions for moving around? **/
+    constexpr bool moves_around(int r) {
+        return r > 1 && r < MAX_R - 1;
+    }
+    /** don't stop on north or south **/
+    constexpr bool skips_north_south(int t) {
+        return t == NORTH || t == SOUTH;
     }
-    else {  // r == 0, center of the board
-        current_position.t = 0;
 
-        for (int i = 0; i < DIRECTION_COUNT; ++i) {
-            available_directions[i].t = i;
-            available_directions[i].r = 1;
-        }
+    constexpr int step_t(int t, int r, int d) {
+        return r == 0 ? d  // center: every direction leads out
+             : !moves_around(r) ? 0
+             // the clockwise north/south check lands on the counter clockwise entry - TODO: verify
+             : d == counter_clockwise_direction(t) ? (skips_north_south((t - 1) % DIRECTION_COUNT) ? -2
+                                                      : skips_north_south((t + 1) % DIRECTION_COUNT) ? 2 : 1)
+             : d == clockwise_direction(t) ? -1
+             : 0;
+    }
 
-        /* TODO: decide: if we don't want to allow turning in the middle
-         * delete that for loop and just use this
-        available_directions[facing].t = facing;
-        available_directions[facing].r = 1;
-         */
+    constexpr int step_r(int t, int r, int d) {
+        return r == 0 ? 1
+             : d == in_direction(t) ? -1
+             : (r < MAX_R && d == t) ? 1  // not on outer edge of board
+             : 0;
+    }
 
-        // TODO: approaches from center
+    /** approaches moving in, NoApproach for directions it does not set **/
+    constexpr Approach in_approach(int t, int d) {
+        return (t % 2) ? (d == in_direction(t) ? FollowUntilSeparatingY : NoApproach)  // TODO: verify
+             : skips_north_south(t) ? (skips_north_south(d) ? NoFollowUntilPerpendicularLine : NoApproach)  // TODO: verify
+             : (d == EAST || d == WEST) ? FollowUntilPerpendicularLine : NoApproach;  // TODO: verify
     }
 
-    // TODO: any other special cases for approaches?
+    constexpr Approach approach(int t, int r, int d) {
+        return r == 0 ? NoApproach  // TODO: approaches from center
+             // drop positions at extreme r
+             : (r == MAX_R - 1 && d == t) ? MoveIntoDropPosition
+             : (r == 1 && d == in_direction(t)) ? MoveIntoDropPosition
+             : in_approach(t, d) != NoApproach ? in_approach(t, d)
+             : (r < MAX_R && (t % 2) && d == t) ? FollowUntilCrossingY  // moving out in odd direction - TODO: verify
+             // the clockwise approach lands on the counter clockwise entry - TODO: verify
+             : (moves_around(r) && d == counter_clockwise_direction(t))
+               ? (((t - 1) % 2) ? FollowOnRightUntilCrossesLine : FollowUntilPerpendicularLine)
+             : NoApproach;
+    }
+
+    constexpr uint16_t pack(int t, int r, int d) {
+        return approach(t, r, d) |
+               (((step_t(t, r, d) + DIRECTION_COUNT) % DIRECTION_COUNT) << 4) |
+               ((step_r(t, r, d) + 1) << 7);
+    }
+}
+
+#define NAV17_CELL(t, r) { pack(t, r, 0), pack(t, r, 1), pack(t, r, 2), pack(t, r, 3), \
+                           pack(t, r, 4), pack(t, r, 5), pack(t, r, 6), pack(t, r, 7) }
+#define NAV17_RING(r) { NAV17_CELL(0, r), NAV17_CELL(1, r), NAV17_CELL(2, r), NAV17_CELL(3, r), \
+                        NAV17_CELL(4, r), NAV17_CELL(5, r), NAV17_CELL(6, r), NAV17_CELL(7, r) }
+
+static_assert(Navigation17::MAX_R == 7 && DIRECTION_COUNT == 8, "move table rows are written out for 8 rings of 8 octants");
+
+// [r][t][direction]
+static const uint16_t MOVE_TABLE[Navigation17::MAX_R + 1][DIRECTION_COUNT][DIRECTION_COUNT] PROGMEM = {
+        NAV17_RING(0), NAV17_RING(1), NAV17_RING(2), NAV17_RING(3),
+        NAV17_RING(4), NAV17_RING(5), NAV17_RING(6), NAV17_RING(7)
+};
+
+static Coordinate unpack_step(const uint16_t& move) {
+    return { (move >> 4) & 0x07, int((move >> 7) & 0x03) - 1 };
+}
+
+static bool is_available(const uint16_t& move) {
+    return (move & 0x01F0) != (1 << 7);  // both steps 0
+}
+
+Coordinate Navigation17::getStep(const Coordinate& position, const Direction& direction) {
+    return unpack_step(pgm_read_word(&MOVE_TABLE[position.r][position.t][direction]));
+}
+
+Approach Navigation17::getApproach(const Coordinate& position, const Direction& direction) {
+    return Approach(pgm_read_word(&MOVE_TABLE[position.r][position.t][direction]) & 0x0F);
+}
+
+uint16_t Navigation17::get_move(const int& direction) {
+    return pgm_read_word(&MOVE_TABLE[current_position.r][current_position.t][direction]);
+}
+
+void Navigation17::move_by(const uint16_t& move) {
+    current_position = current_position + unpack_step(move);
+    if (current_position.r == 0) {
+        // center of the board
+        current_position.t = 0;
+    }
 }
 
 bool Navigation17::turn(const int& direction) {
     // find the amount to turn
-    Direction checking_direction = Direction((facing + direction) % DIRECTION_COUNT);
+    Direction checking_direction = Direction((facing + direction + DIRECTION_COUNT) % DIRECTION_COUNT);
     int amount_turned = 1;  // in octants
-    while (available_directions[checking_direction].t == 0 && available_directions[checking_direction].r == 0) {
-        checking_direction = Direction((checking_direction + direction) % DIRECTION_COUNT);
+    while (!is_available(get_move(checking_direction))) {
+        checking_direction = Direction((checking_direction + direction + DIRECTION_COUNT) % DIRECTION_COUNT);
         ++amount_turned;
 
         if (amount_turned >= DIRECTION_COUNT) {
@@ -143,54 +135,57 @@ bool Navigation17::turn(const int& direction) {
 
     // make the turn
     facing = checking_direction;
-    movement->turn(degreesLeft);
+    if (movement) {
+        movement->turn(degreesLeft);
+    }
 
     return true;
 }
 
 
 bool Navigation17::turnLeft() {
-    turn(1);
+    return turn(1);
 }
 
 bool Navigation17::turnRight() {
-    turn(-1);
+    return turn(-1);
 }
 
 // TODO: use approaches
 bool Navigation17::goForward() {
-    if (available_directions[facing].t == 0 && available_directions[facing].r == 0) {
+    uint16_t move = get_move(facing);
+    if (!is_available(move)) {
         // this direction not available
         return false;
     }
 
     // make the movement
-    current_position = current_position + available_directions[facing];
+    move_by(move);
     // movement->something()
-    set_available_directions();
     return true;
 }
 
 bool Navigation17::goBackward() {
-    if (available_directions[opposite(facing)].t == 0 && available_directions[opposite(facing)].r == 0) {
+    uint16_t move = get_move(opposite(facing));
+    if (!is_available(move)) {
         // this direction is not available
         return false;
     }
 
     // make the movement
-    current_position = current_position + available_directions[opposite(facing)];
+    move_by(move);
     // movement->DO_IT!!()
-    set_available_directions();
     return true;
 }
 
 String Navigation17::getCurrentStateInfo() {
     String paths = "directions and approaches:\n";
     for (int i = 0; i < DIRECTION_COUNT; ++i) {
-        if (available_directions[i].t == 0 && available_directions[i].r == 0) {
+        uint16_t move = get_move(i);
+        if (!is_available(move)) {
             continue;
         }
-        paths = paths + DIRECTION_NAMES[i] + " " + String(approaches[i]) + "\n";
+        paths = paths + DIRECTION_NAMES[i] + " " + String(int(move & 0x0F)) + "\n";
     }
     return "at " + current_position.str() + " facing " + DIRECTION_NAMES[facing] + "\n" + paths;
 }
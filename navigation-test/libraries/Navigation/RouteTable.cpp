@@ -0,0 +1,55 @@
+#include "RouteTable.h"
+#include "RouteTableData.h"
+
+
+bool RouteTable::getIfRoutable(uint16_t state) {
+	if (state >= BOARD_STATE_COUNT) {
+		return false;
+	}
+	return pgm_read_byte(&ROUTE_TABLE_STATE_ROWS[state]) != ROUTE_TABLE_NO_ROW;
+}
+
+RouteCommand RouteTable::getNextCommand(uint16_t state, uint8_t target) {
+	uint8_t row = pgm_read_byte(&ROUTE_TABLE_STATE_ROWS[state]);
+	uint8_t packed = pgm_read_byte(&ROUTE_TABLE_COMMANDS[row][target / 4]);
+	return RouteCommand((packed >> ((target % 4) * 2)) & 0x03);
+}
+
+bool RouteTable::lookupRoute(uint16_t start, uint8_t target, Route& route) {
+	route.clear();
+	if (!getIfRoutable(start) || target >= BOARD_INTERSECTION_COUNT) {
+		return false;
+	}
+	uint16_t state = start;
+	uint16_t cost = 0;
+	while (BoardTable::getIntersection(state) != target) {
+		RouteCommand command = getNextCommand(state, target);
+		if (!route.addCommand(command)) {
+			return false;
+		}
+		cost += RoutePlanner::getMoveCost(state, command);
+		state = BoardTable::getNextState(state, command);
+		if (state == BOARD_NO_STATE) {
+			return false;
+		}
+	}
+	route.setCost(cost);
+	return true;
+}
+
+bool RouteTable::lookupCost(uint16_t start, uint8_t target, uint16_t& cost, uint16_t& end) {
+	cost = 0;
+	end = start;
+	if (!getIfRoutable(start) || target >= BOARD_INTERSECTION_COUNT) {
+		return false;
+	}
+	while (BoardTable::getIntersection(end) != target) {
+		RouteCommand command = getNextCommand(end, target);
+		cost += RoutePlanner::getMoveCost(end, command);
+		end = BoardTable::getNextState(end, command);
+		if (end == BOARD_NO_STATE) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,32 @@
+#ifndef ROUTETABLE_H
+#define ROUTETABLE_H
+
+#include "Arduino.h"
+#include "BoardTable.h"
+#include "RoutePlanner.h"
+
+/*
+Precomputed next-hop table: for every state and target intersection, the first command of a
+cheapest route. The data lives in RouteTableData.h, generated by RouteTable_Generator
+(navigation-test/route_table_gen.cpp) with Floyd-Warshall over the BoardTable graph.
+Identical rows are shared, so each state stores a one-byte row index.
+*/
+
+#define ROUTE_TABLE_ROW_BYTES ((BOARD_INTERSECTION_COUNT * 2 + 7) / 8)
+#define ROUTE_TABLE_NO_ROW 0xFF
+
+class RouteTable
+{
+public:
+	// true if routes from this state to every intersection are in the table
+	static bool getIfRoutable(uint16_t state);
+	// first command toward target; only meaningful if the state is routable and not already at target
+	static RouteCommand getNextCommand(uint16_t state, uint8_t target);
+	// follows the table from start to target, filling route (same result as RoutePlanner::planRoute)
+	static bool lookupRoute(uint16_t start, uint8_t target, Route& route);
+	// same walk as lookupRoute without storing commands; gives the cost and the state it ends in
+	static bool lookupCost(uint16_t start, uint8_t target, uint16_t& cost, uint16_t& end);
+};
+
+
+#endif
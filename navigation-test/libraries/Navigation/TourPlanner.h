@@ -0,0 +1,95 @@
+#ifndef TOURPLANNER_H
+#define TOURPLANNER_H
+
+#include "Arduino.h"
+#include "BoardTable.h"
+#include "RouteTable.h"
+
+/*
+Token collection tour for one round.
+A tour is an order of the round's token intersections. The robot drives to each token in that order;
+after every `capacity` tokens (and after the last one) it drives to the cheapest drop intersection
+before continuing. Leg costs come from RouteTable lookups, so the robot's state (facing) is tracked
+through the whole tour.
+planHeuristic() is cheap enough to run on the robot; navigation-test/tour_opt.cpp searches the same
+model exhaustively on the host.
+Deadline mode plans for a time budget instead (orienteering): it picks which tokens to collect, and in
+which order, to deliver as many as possible before the budget runs out. A token only counts once it is
+dropped, so every plan ends with a drop run. It works anytime-style: each improveDeadline() step keeps a
+plan that fits the budget, so the robot can stop planning whenever it has to start driving.
+Costs are the RoutePlanner duration estimates in tenths of a second (see RoutePlanner::setTurnCost etc.).
+*/
+
+#define TOUR_MAX_TOKENS 32
+#define TOUR_MAX_DROPS 16
+#define TOUR_DEFAULT_CAPACITY 1 // tokens carried before a drop is needed
+#define TOUR_NO_COST 0xFFFFFFFF
+#define TOUR_DROP_CACHE_SIZE 32 // remembered drop runs, looked up by start state
+
+class TourPlanner
+{
+private:
+	uint8_t tokens[TOUR_MAX_TOKENS]; // token intersections this round
+	uint8_t tokenCount = 0;
+	uint8_t drops[TOUR_MAX_DROPS]; // drop intersections
+	uint8_t dropCount = 0;
+	uint8_t capacity;
+	uint8_t order[TOUR_MAX_TOKENS]; // best order found, as indices into tokens
+	uint8_t orderCount = 0; // tokens in order; less than tokenCount in deadline mode
+	uint32_t bestCost = TOUR_NO_COST;
+	uint8_t pickupTime = 0; // time spent at a token and at a drop, on top of driving
+	uint8_t dropTime = 0;
+	// deadline mode
+	uint16_t deadlineStart = BOARD_NO_STATE;
+	uint32_t deadlineBudget = 0;
+	// drop runs start from few distinct states, so the cheapest one is cached
+	uint16_t dropCacheState[TOUR_DROP_CACHE_SIZE];
+	uint16_t dropCacheCost[TOUR_DROP_CACHE_SIZE];
+	uint16_t dropCacheEnd[TOUR_DROP_CACHE_SIZE];
+	void findDrops();
+	// cost of the first count tokens of a tour from position on, given the state and cost before it;
+	// gives up at limit
+	uint32_t evaluateFrom(uint8_t position, uint16_t state, uint32_t cost, const uint8_t* tokenOrder, uint8_t count,
+		uint32_t limit);
+	// state and cost before each position of order, up to and including position orderCount
+	void tracePrefix(uint16_t start, uint16_t* prefixState, uint32_t* prefixCost);
+	// order with the token at from moved to position to
+	void moveToken(uint8_t* candidate, uint8_t from, uint8_t to);
+	// deadline steps, true if the plan changed
+	bool insertToken();
+	bool shortenPlan();
+public:
+	TourPlanner(int round, uint8_t tokenCapacity = TOUR_DEFAULT_CAPACITY);
+	// single legs; both update state to where the robot ends up and return false if unreachable
+	bool costToToken(uint16_t& state, uint8_t tokenIndex, uint32_t& cost);
+	bool costToDrop(uint16_t& state, uint32_t& cost); // cheapest drop from state
+	// forgets the cached drop runs; call after RoutePlanner::setTurnCost etc. before using costToDrop or
+	// evaluate directly (planHeuristic and beginDeadline call it themselves)
+	void invalidateCosts();
+	void setHandlingTimes(uint8_t pickup, uint8_t drop) { pickupTime = pickup; dropTime = drop; };
+	// total cost of visiting the tokens in the given order (indices into tokens)
+	uint32_t evaluate(uint16_t start, const uint8_t* tokenOrder);
+	uint32_t evaluate(uint16_t start, const uint8_t* tokenOrder, uint8_t count); // only the first count tokens
+	// nearest-neighbour tour improved by moving single tokens (or-opt); stops after maxPasses passes
+	uint32_t planHeuristic(uint16_t start, uint8_t maxPasses = 4);
+	// store an externally found order (used by the host optimizer)
+	void setOrder(const uint8_t* tokenOrder, uint32_t cost);
+	// deadline mode: start with an empty plan, then improve it one step at a time
+	void beginDeadline(uint16_t start, uint32_t budget);
+	bool improveDeadline(); // false once no step helps
+	// runs improveDeadline until it stops helping or maxMillis have passed; returns the tokens planned
+	uint8_t planDeadline(uint16_t start, uint32_t budget, uint32_t maxMillis);
+	// getters
+	uint8_t getTokenCount() { return tokenCount; };
+	uint8_t getToken(uint8_t index) { return tokens[index]; };
+	uint8_t getDropCount() { return dropCount; };
+	uint8_t getDrop(uint8_t index) { return drops[index]; };
+	uint8_t getCapacity() { return capacity; };
+	uint8_t getOrderedToken(uint8_t position) { return tokens[order[position]]; }; // intersection to visit at position
+	const uint8_t* getOrder() { return order; };
+	uint8_t getOrderCount() { return orderCount; };
+	uint32_t getCost() { return bestCost; };
+};
+
+
+#endif
@@ -2,90 +2,234 @@
 #define SCRAPCONTROLLER_H
 #include "Arduino.h"
 #include "ScrapDefinitions.h"
+#include "ScrapFixed.h"
 
 
-// classes
-class ScrapMotor {
-	private:
+// abstract classes (interfaces)
+class ScrapMotorInterface {
+	protected:
+		int currPower; // stores current power
+		int currDir; // stores current direction (1, -1, 0)
+		int powerMultiplier; // stores multiplier (-1 flips direction, 1 keeps it the same)
+		virtual void initMotor() = 0; // use to initialize output/input pins
+	public:
+		virtual void setMotor(int pwm) = 0; // sets both direction + power of motor
+		virtual void setDirection(int pwm) = 0; // set direction only
+		virtual void setDirectionMultiplier(int multi) = 0; // set multiplier (1 or -1) to flip dirs
+		virtual void setPower(int pwm) = 0; // set power only
+		virtual void incrementPower(int val) = 0; // increase power -> DOES NOT flip directions
+		virtual void decrementPower(int val) = 0; // decrease power -> DOES NOT flip directions
+		virtual int getDirection() = 0; // return current direction (1, -1, 0)
+		virtual int getPower() = 0; // return power
+		virtual void stop() = 0; // stop the motor; should immediately send signal to stop moving
+};
+
+
+// encoder count and the time of its last edge, read together
+struct ScrapEncoderSnapshot {
+	long count;
+	unsigned long edgeTime; // micros() at the last counted edge
+	unsigned long time; // micros() when the snapshot was taken
+};
+
+// both encoders of a pair read at the same instant
+struct ScrapEncoderPairSnapshot {
+	long count1;
+	long count2;
+	unsigned long edgeTime1;
+	unsigned long edgeTime2;
+	unsigned long time;
+};
+
+
+class ScrapEncoderInterface {
+	protected:
+		volatile long encCount;
+		volatile unsigned long edgeTime = 0; // micros() at the last counted edge
+		// bumped after every change of the count, so snapshot readers can tell they were interrupted
+		volatile uint8_t edgeSequence = 0;
+		// ring of the last edges, written only by the encoder interrupt
+		volatile unsigned long edgeTimes[SCRAPENCODER_EDGES];
+		volatile long edgeCounts[SCRAPENCODER_EDGES];
+		volatile uint8_t edgeHead = 0; // slot of the next edge
+		volatile uint8_t edgeFilled = 0; // edges in the ring since the count was last set
+		virtual void initEncoder() = 0;
+		void markEdge() {
+			unsigned long now = micros();
+			uint8_t slot = edgeHead;
+			edgeTime = now;
+			edgeTimes[slot] = now;
+			edgeCounts[slot] = encCount;
+			edgeHead = (slot + 1) & (SCRAPENCODER_EDGES - 1);
+			if (edgeFilled < SCRAPENCODER_EDGES) {
+				edgeFilled++;
+			}
+			edgeSequence++;
+		};
+		// edges before a set count are not comparable; call with interrupts off, the encoder interrupt bumps the sequence too
+		void markCountSet() { edgeFilled = 0; edgeSequence++; };
+		long readCount(); // the count alone, with the same sequence check as getSnapshot
+	public:
+		// consistent count and edge time without turning interrupts off; the count is read
+		// one byte at a time on the AVR, so reading encCount directly from outside the encoder interrupt can tear
+		void getSnapshot(ScrapEncoderSnapshot& snapshot);
+		static void getSnapshot(ScrapEncoderInterface& enc1, ScrapEncoderInterface& enc2, ScrapEncoderPairSnapshot& snapshot);
+		// count and time of the edge back edges before the newest one;
+		// false if it was not recorded since the count was last set
+		bool getEdge(uint8_t back, long& count, unsigned long& time);
+		virtual long getCount() = 0;
+		virtual void resetCount() = 0;
+		virtual void setCount(long newCount) = 0;
+		virtual void incrementCount() = 0;
+		virtual void decrementCount() = 0;
+		virtual void checkEncoder() = 0;
+		virtual void checkEncoderFlipped() = 0;
+};
+
+
+
+// concrete classes
+
+// ScrapMotorSinglePin: for use with motor controllers that use 1 pin for direction, 1 PWM pin for speed
+class ScrapMotorSinglePin: public ScrapMotorInterface {
+	protected:
+		int PIN_D;
+		int PIN_PWM;
+		virtual void initMotor();
+	public:
+		ScrapMotorSinglePin(int PinD, int PinPWM, int dirMultip = 1);
+		virtual void setMotor(int pwm);
+		virtual void setDirection(int pwm);
+		virtual void setDirectionMultiplier(int multi);
+		virtual void setPower(int pwm);
+		virtual void incrementPower(int val = 1) { setPower(currDir+val); };
+		virtual void decrementPower(int val = 1) { setPower(currDir-val); };
+		virtual int getDirection();
+		virtual int getPower();
+		virtual void stop();
+};
+
+
+// ScrapMotor: for use with motor controllers that use 2 pins for direction, 1 PWM pin for speed
+class ScrapMotor: public ScrapMotorInterface {
+	protected:
 		int PIN_D1;
 		int PIN_D2;
 		int PIN_PWM;
-		int currPower;
-		int currDir;
-		int powerMultiplier = 1;
-		void initMotor();
+		virtual void initMotor();
 	public:
 		ScrapMotor(int PinD1, int PinD2, int PinPWM, int dirMultip = 1);
-		void setMotor(int pwm);
-		void setDirection(int pwm);
-		void setDirectionMultiplier(int multi);
-		void setPower(int pwm);
-		void incrementPower(int val = 1) { setPower(currDir+val); };
-		void decrementPower(int val = 1) { setPower(currDir-val); };
-		int getDirection();
-		int getPower();
-		void stop();
+		virtual void setMotor(int pwm);
+		virtual void setDirection(int pwm);
+		virtual void setDirectionMultiplier(int multi);
+		virtual void setPower(int pwm);
+		virtual void incrementPower(int val = 1) { setPower(currDir+val); };
+		virtual void decrementPower(int val = 1) { setPower(currDir-val); };
+		virtual int getDirection();
+		virtual int getPower();
+		virtual void stop();
 };
 
 
-class ScrapEncoder {
-	private:
-		volatile long encCount;
+class ScrapEncoder: public ScrapEncoderInterface {
+	protected:
 		int PINA_INTERRUPT;
 		int PINB_CHECKER;
-		void initEncoder();
+		bool flipped = false; // update() counts the other way
+		// cached input registers and bit masks, so interrupts do not go through digitalRead
+		volatile uint8_t* portA;
+		volatile uint8_t* portB;
+		uint8_t maskA;
+		uint8_t maskB;
+		uint8_t prevState = 0; // last reading, A in bit 1 and B in bit 0
+		volatile unsigned long errorCount = 0; // transitions where both channels changed at once
+		virtual void initEncoder();
+		uint8_t readState() { return ((*portA & maskA) ? 2 : 0) | ((*portB & maskB) ? 1 : 0); };
 	public:
-		ScrapEncoder(int pinA, int pinB);
-		long getCount();
-		void resetCount();
-		void setCount(long newCount);
-		void incrementCount();
-		void decrementCount();
-		void checkEncoder();
-		void checkEncoderFlipped();
+		ScrapEncoder(int pinA, int pinB, bool flip = false);
+		virtual long getCount();
+		virtual void resetCount();
+		virtual void setCount(long newCount);
+		virtual void incrementCount();
+		virtual void decrementCount();
+		// 2x decoding: attach to CHANGE on pin A only
+		virtual void checkEncoder();
+		virtual void checkEncoderFlipped();
+		// 4x decoding: attach to CHANGE on both pins
+		void update();
+		unsigned long getErrorCount() { return errorCount; };
 };
 
 
 class ScrapMotorControl {
-	private:
-		unsigned long prevTime = 0;
-		float prevSpeed = 0.0;
-		float speedGoal = 0.0;
-		long prevCount = 0;
-		int minPower = SCRAPMOTORCONTROL_MINPOWER;
+	/*
+	Speed is stored as Encoder Value Change PER Second
+	MicroSpeed is stored as Encoder Value Change PER Microsecond
+	Power is set by a PID loop in Q16.16 fixed point; see performMovement
+	*/
+	protected:
+		unsigned long prevTime = 0; // time of previous speed calculation
+		unsigned long prevInterval = 0; // time (us) between the last two speed calculations
+		long prevSpeed = 0; // previously-calculated speed
+		long speedGoal = 0; // speed to reach
+		long prevCount = 0; // previous encoder count
+		unsigned long prevEdgeTime = 0; // time of the edge the previous speed was measured to
+		long prevEdgeCount = 0; // count at that edge
+		int minPower = 0; // minimum power to get motor to move
 		float minSpeed;
 		float maxSpeed;
-		ScrapMotor* motor;
-		ScrapEncoder* encoder;
-		float calcSpeed(); // calculates speed and updates relevant vals
+		// PID state, all Q16.16
+		q16_t kp = Q16(SCRAPMOTORCONTROL_KP);
+		q16_t ki = Q16(SCRAPMOTORCONTROL_KI);
+		q16_t kd = Q16(SCRAPMOTORCONTROL_KD);
+		q16_t integral = 0; // integrated error times ki, in PWM
+		int goalDirection = 1; // direction given to the last setControl
+		ScrapMotorInterface* motor; // motor
+		ScrapEncoderInterface* encoder; // encoder
+		long calcSpeed(); // calculates speed and updates relevant time
+		static long scaleSpeed(unsigned long counts, unsigned long time); // counts over time (us) in counts/s
 	public:
 		ScrapMotorControl();
-		ScrapMotorControl(ScrapMotor& mot, ScrapEncoder& enc);
+		ScrapMotorControl(ScrapMotorInterface& mot, ScrapEncoderInterface& enc);
+		// set control
 		void setControl(float newSpeed); // set direction + speed
-		void setControlEnc(int encPerSec) { setControl(convertToSpeed(encPerSec)); };
-		void setSpeed(float newSpeed); // set direction only
-		void setSpeedEnc(int encPerSec) { setSpeed(convertToSpeed(encPerSec)); };
+		// set speed goal
+		void setSpeed(float newSpeed); // set speed only
+		// set min speed
 		void setMinSpeed(float newMin) { minSpeed = newMin; };
-		void setMinSpeedEnc(float newMinEnc) { setMinSpeed(convertToSpeed(newMinEnc)); };
+		// set max speed
 		void setMaxSpeed(float newMax) { maxSpeed = newMax; };
-		void setMaxSpeedEnc(float newMaxEnc) { setMaxSpeed(convertToSpeed(newMaxEnc)); };
-		void incrementSpeed(int speedEncDiff);
-		void decrementSpeed(int speedEncDiff);
+		// set min motor power
+		void setMinPower(int power) { minPower = power; };
+		// set PID gains; see SCRAPMOTORCONTROL_KP for units
+		void setGains(float newKp, float newKi, float newKd = 0);
+		// change speed
+		void incrementSpeed(float speedDiff);
+		void decrementSpeed(float speedDiff);
+		// helper functions
 		float mapFloat(float x, float in_min, float in_max, float out_min, float out_max);
 		float constrainFloat(float x, float min, float max);
-		float convertToSpeed(int encPerSec);
-		void setMinPower(int power) { minPower = power; };
+		float convertToSpeed(float microSpeed);
+		// reset and stop
 		void reset();
 		void stop();
+		// get/set encoder count
 		long getCount() { return encoder->getCount(); };
-		int getSpeedEnc() { return prevSpeed*1000000; };
-		float getSpeed(); // returns speed
+		ScrapEncoderInterface& getEncoder() { return *encoder; };
+		void setCount(long count) { encoder->setCount(count); };
+		void resetCount() { encoder->resetCount(); };
+		// get motor direction
+		int getDirection() { return motor->getDirection(); };
+		// get previous speed and speed goal
+		float getSpeed() { return prevSpeed; };
 		float getSpeedGoal() { return speedGoal; }; // return speed goal
-		int getSpeedEncGoal() { return getSpeedGoal()*1000000; };
+		// get time of previous reading
 		unsigned long getTime();
+		// perform movement, updating speed/power/time
 		void performMovement();
-		void attachMotor(ScrapMotor& mot) { motor = &mot; };
-		void attachEncoder(ScrapEncoder& enc) { encoder = &enc; };
+		// attach motor/encoder
+		void attachMotor(ScrapMotorInterface& mot) { motor = &mot; };
+		void attachEncoder(ScrapEncoderInterface& enc) { encoder = &enc; };
 };
 
 
@@ -106,102 +250,243 @@ class ScrapSwitch {
 };
 
 
-class ScrapController {
+// homing phases
+#define SCRAPHOMING_IDLE 0
+#define SCRAPHOMING_FAST 1 // driving toward the switch at the fast speed
+#define SCRAPHOMING_BACKOFF 2 // found it; backing away until it lets go
+#define SCRAPHOMING_SLOW 3 // creeping back onto it for the precise zero
+#define SCRAPHOMING_DONE 4
+
+// ScrapHoming: homes one axis onto its switch; call perform() every control step until it returns true
+class ScrapHoming {
 	private:
-		int goal1;
-		int encTolerance = SCRAPCONTROLLER_ENCTOLERANCE; // +/- range around goal
-		int slowdownThresh = SCRAPCONTROLLER_SLOWDOWNTHRESH; // slow down range
-		int minSlowPower = SCRAPCONTROLLER_MINSLOWPOWER; // minimum power
-		int minEncSpeed = SCRAPCONTROLLER_MINENCSPEED;
-		int maxEncSpeed = SCRAPCONTROLLER_MAXENCSPEED;
-		ScrapMotor* motor1;
-		ScrapEncoder* encoder1;
-		ScrapSwitch* switch1;
-		ScrapMotorControl speedControl1;
+		uint8_t phase = SCRAPHOMING_IDLE;
+		float fastSpeed = SCRAPHOMING_FASTSPEED;
+		float slowSpeed = SCRAPHOMING_SLOWSPEED;
+		float backoffSpeed = SCRAPHOMING_BACKOFFSPEED;
+		long backoffCount = SCRAPHOMING_BACKOFFCOUNT;
+		long releaseCount = 0; // last count the switch was still pressed at while backing off
+		unsigned long startTime = 0;
+		unsigned long duration = 0; // us the last homing took
 	public:
-		ScrapController();
-		ScrapController(ScrapMotor& mot1, ScrapEncoder& enc1);
-		ScrapController(ScrapMotor& mot1, ScrapEncoder& enc1, ScrapSwitch& swi1);
-		bool set(int g1);
-		int getGoal1() { return goal1; };
-		int getGoal() { return getGoal1(); };
-		int getDiff1();
-		bool checkIfDone1();
-		bool checkIfDone() { return checkIfDone1(); };
-		float calcSpeed1();
-		float calcSpeed() { return calcSpeed1(); };
-		bool performMovement();
-		bool performReset();
-		void incrementSpeed(int speedEncDiff);
-		void decrementSpeed(int speedEncDiff);
-		void stop();
-		int getCount1() { return encoder1->getCount(); };
-		int getCount() { return getCount1(); };
-		void attachMotor1(ScrapMotor& mot);
-		void attachEncoder1(ScrapEncoder& enc);
-		void attachSwitch1(ScrapSwitch& swi) { switch1 = &swi; };
+		bool perform(ScrapMotorControl& control, ScrapSwitch& swi); // true once homed; the count is then 0
+		uint8_t getPhase() { return phase; };
+		bool getIfDone() { return phase == SCRAPHOMING_DONE; };
+		unsigned long getDuration() { return duration; };
+		void setSpeeds(float fast, float slow) { fastSpeed = fast; slowSpeed = slow; };
+		void setBackoff(long counts, float speed) { backoffCount = counts; backoffSpeed = speed; };
 };
 
 
-class ScrapDualController {
+// ScrapProfile: limits how fast a speed command may change, in acceleration and in jerk (the change of
+// acceleration); jerk 0 gives a trapezoidal profile, acceleration 0 passes commands straight through
+class ScrapProfile {
 	private:
-		long goal1;
-		long goal2;
-		int diffTolerance = SCRAPDUALCONTROLLER_DIFFTOLERANCE; //max diff in encoder values
-		int encTolerance = SCRAPDUALCONTROLLER_ENCTOLERANCE; // max window of error from set goal
-		int slowdownThresh1 = SCRAPDUALCONTROLLER_SLOWDOWNTHRESH1; // slow down range
-		int slowdownThresh2 = SCRAPDUALCONTROLLER_SLOWDOWNTHRESH2; // slow down range
-		int minSlowPower1 = SCRAPDUALCONTROLLER_MINSLOWPOWER1; // minimum power of motor1
-		int minSlowPower2 = SCRAPDUALCONTROLLER_MINSLOWPOWER2; // minimum power of motor2
-		int minEncSpeed = SCRAPDUALCONTROLLER_MINENCSPEED;
-		int maxEncSpeed = SCRAPDUALCONTROLLER_MAXENCSPEED;
-		int encSpeedBalance = SCRAPDUALCONTROLLER_ENCSPEEDBALANCE;
-		ScrapMotor* motor1;
-		ScrapMotor* motor2;
-		ScrapEncoder* encoder1;
-		ScrapEncoder* encoder2;
+		float speed = 0; // counts/s, signed
+		float accel = 0; // counts/s^2, signed
+		float maxAccel = 0;
+		float jerk = 0; // counts/s^3
+		float lag = SCRAPPROFILE_LAG; // s the wheel trails the profile by
+		float overrun = SCRAPPROFILE_OVERRUN; // counts the wheel coasts on once the profile has stopped
+		// from the limits, worked out in setLimits so the control interrupt does not divide
+		float invAccel = 0; // 1/maxAccel
+		float invJerk = 0; // 1/jerk
+		float rampSpeed = 0; // speed change while ramping full acceleration in and out, maxAccel^2/jerk
+		unsigned long prevTime = 0;
+	public:
+		float step(float target); // moves the speed toward target by the time since the last step; returns it
+		float getStopDistance(); // counts the profile covers before it can come to rest
+		bool getIfBraking(long remaining); // true once stopping takes all of the remaining counts (signed) toward a goal
+		void reset() { speed = 0; accel = 0; prevTime = 0; };
+		void setLimits(float newAccel, float newJerk);
+		void setLag(float newLag) { lag = newLag; };
+		bool getIfEnabled() { return maxAccel > 0; };
+		float getSpeed() { return speed; };
+		float getAccel() { return accel; };
+};
+
+
+class ScrapControllerInterface {
+	protected:
+		long goal;
+		long encTolerance;
+		long slowdownThresh;
+		int minSlowPower;
+		float minEncSpeed;
+		float maxEncSpeed;
+		virtual float calcSpeed() = 0;
+	public:
+		// set/get encoder goal
+		virtual bool set(long g) = 0;
+		virtual long getGoal() = 0;
+		virtual long getDiff() = 0;
+		virtual bool checkIfDone() = 0;
+		// set/get speed goal; these are wrappers for motor control commands
+		virtual void setSpeed(float speed) = 0;
+		virtual void incrementSpeed(float speedDiff) = 0;
+		virtual void decrementSpeed(float speedDiff) = 0;
+		virtual float getSpeed() = 0;
+		// stop movement
+		virtual void stop() = 0;
+		// get encoder count
+		virtual long getCount() = 0;
+		// perform movement or reset
+		virtual bool performMovement() = 0;
+		virtual bool performReset() = 0;
+		// set values
+		virtual void setEncTolerance(long tolerance) { encTolerance = tolerance; };
+		virtual void setSlowdownThresh(long thresh) { slowdownThresh = thresh; };
+		virtual void setMinSlowPower(int power) { minSlowPower = power; };
+		virtual void setMinEncSpeed(float speed) { minEncSpeed = speed; };
+		virtual void setMaxSpeedEnc(float speed) { maxEncSpeed = speed; };
+};
+
+
+class ScrapController: public ScrapControllerInterface  {
+	protected:
+		ScrapSwitch* resetswitch;
+		ScrapMotorControl* speedControl;
+		ScrapHoming homing;
+		ScrapProfile profile;
+		virtual float calcSpeed();
+		void initValues();
+	public:
+		ScrapController();
+		ScrapController(ScrapMotorControl& motorControl);
+		ScrapController(ScrapMotor& mot, ScrapEncoder& enc);
+		ScrapController(ScrapMotor& mot, ScrapEncoder& enc, ScrapSwitch& swi);
+		// set/get encoder goal
+		virtual bool set(long g);
+		virtual long getGoal() { return goal; };
+		virtual long getDiff();
+		virtual bool checkIfDone();
+		// set/get speed goal; these are wrappers for motor control commands
+		virtual void setSpeed(float speed) { speedControl->setControl(speed); };
+		virtual void incrementSpeed(float speedDiff);
+		virtual void decrementSpeed(float speedDiff);
+		virtual float getSpeed() { return speedControl->getSpeed(); };
+		// stop movement
+		virtual void stop();
+		// get encoder count
+		virtual long getCount() { return speedControl->getCount(); };
+		// perform movement or reset
+		virtual bool performMovement();
+		virtual void performSpeedMovement() { speedControl->performMovement(); };
+		virtual bool performReset();
+		// homing speeds (counts/s) and time (us) the last reset took
+		void setHomingSpeeds(float fast, float slow) { homing.setSpeeds(fast,slow); };
+		void setHomingBackoff(long counts, float speed) { homing.setBackoff(counts,speed); };
+		unsigned long getHomingTime() { return homing.getDuration(); };
+		// acceleration (counts/s^2) and jerk (counts/s^3) limits; acceleration 0 uses the slowdown threshold instead
+		void setProfile(float accel, float jerk) { profile.setLimits(accel,jerk); };
+		// attach components
+		void attachSwitch(ScrapSwitch& swi) { resetswitch = &swi; };
+};
+
+
+class ScrapDualController: public ScrapControllerInterface {
+	protected:
+		long goal1 = 0;
+		long goal2 = 0;
+		long encTolerance1 = SCRAPDUALCONTROLLER_ENCTOLERANCE;
+		long encTolerance2 = SCRAPDUALCONTROLLER_ENCTOLERANCE;
+		long slowdownThresh1 = SCRAPDUALCONTROLLER_SLOWDOWNTHRESH1;
+		long slowdownThresh2 = SCRAPDUALCONTROLLER_SLOWDOWNTHRESH2;
+		int minSlowPower1 = SCRAPDUALCONTROLLER_MINSLOWPOWER1;
+		int minSlowPower2 = SCRAPDUALCONTROLLER_MINSLOWPOWER2;
+		float syncGain = SCRAPDUALCONTROLLER_SYNCGAIN; // speed moved toward the lagging wheel per count it is behind
+		float maxSync = SCRAPDUALCONTROLLER_MAXSYNC; // most speed moved between the wheels
 		ScrapSwitch* switch1;
 		ScrapSwitch* switch2;
+		ScrapMotorControl* speedControl1;
+		ScrapMotorControl* speedControl2;
+		ScrapHoming homing1;
+		ScrapHoming homing2;
+		ScrapProfile profile1;
+		ScrapProfile profile2;
+		virtual float calcSpeed1();
+		virtual float calcSpeed2();
+		virtual float calcSpeed() { return (calcSpeed1() + calcSpeed2())/2.0; }; 
+		void initValues();
 	public:
 		ScrapDualController();
+		ScrapDualController(ScrapMotorControl& motorControl1, ScrapMotorControl& motorControl2);
 		ScrapDualController(ScrapMotor& mot1, ScrapMotor& mot2, ScrapEncoder& enc1, ScrapEncoder& enc2);
 		ScrapDualController(ScrapMotor& mot1, ScrapMotor& mot2, ScrapEncoder& enc1, ScrapEncoder& enc2, ScrapSwitch& swi1, ScrapSwitch& swi2);
-		// speed can be externally controlled
-		ScrapMotorControl speedControl1;
-		ScrapMotorControl speedControl2;
-		// other functions and junk
-		bool set(long g1,long g2); //returns state of 'done'
-		bool set(long goal_both); //returns state of 'done'
-		void shiftCount(); //sets encoders to relative value from current goal
-		long getGoal1() { return goal1; };
-		long getGoal2() { return goal2; };
-		long getGoal() { return (goal1+goal2)/2; };
-		long getDiff1();
-		long getDiff2();
-		bool checkIfDone();
-		bool checkIfDone1();
-		bool checkIfDone2();
-		bool checkIfNoSpeed(); 
-		float calcSpeed1();
-		float calcSpeed2(); 
+		// get/set encoder goals
+		virtual bool set(long g1, long g2);
+		virtual bool set(long goal);
+		virtual void shiftCount(); //sets encoders to relative value from current goal
+		virtual long getGoal1() { return goal1; };
+		virtual long getGoal2() { return goal2; };
+		virtual long getGoal() { return (goal1+goal2)/2; };
+		virtual long getDiff1();
+		virtual long getDiff2();
+		virtual long getDiff() { return (getDiff1() + getDiff2())/2; };
+		virtual bool checkIfDone1();
+		virtual bool checkIfDone2();
+		virtual bool checkIfDone();
+		// get/set speed goal; these are mostly wrappers for motor control commands
+		virtual void setSpeed1(float speed) { speedControl1->setControl(speed); };
+		virtual void setSpeed2(float speed) { speedControl2->setControl(speed); };
+		virtual void setSpeed(float speed) { setSpeed1(speed); setSpeed2(speed); };
+		virtual void incrementSpeed(float speedDiff);
+		virtual void decrementSpeed(float speedDiff);
+		virtual float getSpeed1() { return speedControl1->getSpeed(); };
+		virtual float getSpeed2() { return speedControl2->getSpeed(); };
+		virtual float getSpeed() { return (getSpeed1() + getSpeed2())/2.0; };
+		virtual bool checkIfNoSpeed(); // check if both motors are not moving
+		// stop movement
+		virtual void stop();
+		// get encoder count
+		long getCount1() { return speedControl1->getCount(); };
+		long getCount2() { return speedControl2->getCount(); };
+		long getCount(); //returns average of encoder counts
+		void resetCount() { speedControl1->resetCount(); speedControl2->resetCount();};
+		// perform movement or reset
 		bool performMovement();
+		void performSpeedMovement() { speedControl1->performMovement(); speedControl2->performMovement(); };
 		bool performReset();
-		void incrementSpeed(int speedEncDiff);
-		void decrementSpeed(int speedEncDiff);
-		void moveSpeedToward1(int speedEncDiff);
-		void moveSpeedToward2(int speedEncDiff);
+		// homing speeds (counts/s) for both wheels, and time (us) the last reset took
+		void setHomingSpeeds(float fast, float slow) { homing1.setSpeeds(fast,slow); homing2.setSpeeds(fast,slow); };
+		void setHomingBackoff(long counts, float speed) { homing1.setBackoff(counts,speed); homing2.setBackoff(counts,speed); };
+		unsigned long getHomingTime() { return max(homing1.getDuration(),homing2.getDuration()); };
+		// acceleration (counts/s^2) and jerk (counts/s^3) limits for both wheels; acceleration 0 uses the slowdown thresholds instead
+		void setProfile(float accel, float jerk) { profile1.setLimits(accel,jerk); profile2.setLimits(accel,jerk); };
+		// balance motor speeds
+		void moveSpeedToward1(float speedDiff);
+		void moveSpeedToward2(float speedDiff);
 		void balanceSpeed();
-		void stop();
-		long getCount1() { return encoder1->getCount(); };
-		long getCount2() { return encoder2->getCount(); };
-		long getCount() { return (getCount1()+getCount2())/2; }; //returns average of encoder counts
-		void resetCount() { encoder1->resetCount(); encoder2->resetCount();};
-		void attachMotor1(ScrapMotor& mot);
-		void attachMotor2(ScrapMotor& mot);
-		void attachEncoder1(ScrapEncoder& enc);
-		void attachEncoder2(ScrapEncoder& enc);
+		// attach
 		void attachSwitch1(ScrapSwitch& swi) { switch1 = &swi; };
 		void attachSwitch2(ScrapSwitch& swi) { switch2 = &swi; };
+		// set values
+		virtual void setSyncGain(float gain) { syncGain = gain; };
+		virtual void setMaxSync(float speed) { maxSync = speed; };
+		virtual void setEncTolerance1(long tolerance) { encTolerance1 = tolerance; };
+		virtual void setEncTolerance2(long tolerance) { encTolerance2 = tolerance; };
+		virtual void setEncTolerance(long tolerance) { setEncTolerance1(tolerance); setEncTolerance2(tolerance); };
+		virtual void setSlowdownThresh1(long thresh) { slowdownThresh1 = thresh; };
+		virtual void setSlowdownThresh2(long thresh) { slowdownThresh2 = thresh; };
+		virtual void setSlowdownThresh(long thresh) { setSlowdownThresh1(thresh); setSlowdownThresh2(thresh); };
+		virtual void setMinSlowPower1(int power) { minSlowPower1 = power; };
+		virtual void setMinSlowPower2(int power) { minSlowPower2 = power; };
+		virtual void setMinSlowPower(int power) { setMinSlowPower1(power); setMinSlowPower2(power); };
+};
+
+
+// one straight move of the ScrapFullController motion queue, in encoder counts
+struct ScrapSegment {
+	long startX;
+	long startY;
+	long endX;
+	long endY;
+	float length;
+	float dirX; // unit direction
+	float dirY;
+	float speed; // requested path speed (counts/s)
+	float entrySpeed; // planned path speed at the start
+	float maxEntrySpeed; // fastest the corner with the previous segment can be taken
 };
 
 
@@ -212,10 +497,31 @@ class ScrapFullController {
 		float diffDecim = 0.01; // percentage diff from desired proportion
 		float desiredProportion; // x_goal/y_goal proportion
 		int encSpeedBalance = 30;
+		// motion queue: ring of segments, the oldest one is being driven
+		ScrapSegment queue[SCRAPFULLCONTROLLER_QUEUESIZE];
+		uint8_t queueHead = 0;
+		uint8_t queueLength = 0;
+		float accel = SCRAPFULLCONTROLLER_ACCEL;
+		float junctionDeviation = SCRAPFULLCONTROLLER_JUNCTIONDEV;
+		float pathGain = SCRAPFULLCONTROLLER_PATHGAIN;
+		ScrapSegment& getSegment(uint8_t i) { return queue[(queueHead + i) % SCRAPFULLCONTROLLER_QUEUESIZE]; };
+		float calcJunctionSpeed(ScrapSegment& prev, ScrapSegment& next);
+		void planQueue();
+		void setAxisSpeeds(float vx, float vy, long goalY);
 	public:
 		ScrapFullController();
 		ScrapFullController(ScrapController& xCont, ScrapDualController& yCont);
 		bool set(int gx, int gy);
+		// motion queue: moves run back to back, slowing only as much as each corner needs
+		bool queueMove(long gx, long gy, float speed = SCRAPFULLCONTROLLER_SPEED); // false if the queue is full
+		bool performQueue(); // call every control step; true once the queue is empty and the gantry stopped
+		void clearQueue();
+		uint8_t getQueueLength() { return queueLength; };
+		bool getIfQueueFull() { return queueLength == SCRAPFULLCONTROLLER_QUEUESIZE; };
+		float getPlannedSpeed(uint8_t i) { return getSegment(i).entrySpeed; }; // planned entry speed of queued segment i
+		void setAccel(float newAccel) { accel = newAccel; };
+		void setJunctionDeviation(float deviation) { junctionDeviation = deviation; };
+		void setPathGain(float gain) { pathGain = gain; };
 		int getGoalX() { return xControl->getGoal(); };
 		int getGoalY() { return yControl->getGoal(); };
 		int getCountX() { return xControl->getCount(); };
@@ -235,4 +541,61 @@ class ScrapFullController {
 };
 
 
+// timing of the scheduled control updates, all times in microseconds
+struct ScrapSchedulerStats {
+	unsigned long ticks; // updates run
+	unsigned long overruns; // updates that took longer than one period
+	unsigned long skipped; // timer ticks dropped because the previous update was still running
+	unsigned long held; // timer ticks dropped while held
+	unsigned long period; // nominal period
+	unsigned long minPeriod; // shortest time between the starts of two updates
+	unsigned long maxPeriod; // longest time between the starts of two updates
+	unsigned long meanPeriod;
+	unsigned long maxJitter; // largest difference between a period and the nominal period
+	unsigned long maxBusy; // longest update
+};
+
+
+/*
+Runs performMovement of every registered controller from a hardware timer at a fixed rate.
+AVR boards use timer 2 in CTC mode (analogWrite on the two timer 2 pins and tone() stop working);
+Teensy boards use an IntervalTimer. Other builds have no timer and call tick() themselves.
+Register a ScrapDualController or its two ScrapMotorControls, not both.
+Encoder interrupts still run during an update. Code that changes goals of scheduled controllers
+should do so between hold() and release(), so an update never sees half of a change.
+*/
+class ScrapScheduler {
+	private:
+		static ScrapMotorControl* motorControls[SCRAPSCHEDULER_MAXCONTROLS];
+		static ScrapDualController* dualControls[SCRAPSCHEDULER_MAXCONTROLS];
+		static uint8_t motorControlCount;
+		static uint8_t dualControlCount;
+		static volatile bool running;
+		static volatile bool busy;
+		static volatile bool holding;
+		// only written by tick(); read with interrupts off
+		static ScrapSchedulerStats stats;
+		static unsigned long firstStart;
+		static unsigned long lastStart;
+	public:
+		// start/stop the timer; the rate is rounded to what the timer can do, returns false if out of range
+		static bool begin(unsigned long rate = SCRAPSCHEDULER_RATE);
+		static void end();
+		static bool getIfRunning() { return running; };
+		// register controllers; false if full
+		static bool add(ScrapMotorControl& control);
+		static bool add(ScrapDualController& control);
+		static void clear();
+		// skip updates while the main code changes goals
+		static void hold() { holding = true; };
+		static void release() { holding = false; };
+		// one update of every controller; the timer interrupt calls this
+		static void tick();
+		// statistics
+		static ScrapSchedulerStats getStats();
+		static void resetStats();
+		static void printStats();
+};
+
+
 #endif
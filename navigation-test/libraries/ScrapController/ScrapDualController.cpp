@@ -3,78 +3,45 @@
 //ScrapDualController::
 
 ScrapDualController::ScrapDualController() {
+	initValues();
+}
 
+ScrapDualController::ScrapDualController(ScrapMotorControl& motorControl1, ScrapMotorControl& motorControl2) {
+	initValues();
+	speedControl1 = &motorControl1;
+	speedControl2 = &motorControl2;
+	stop();
 }
 
 ScrapDualController::ScrapDualController(ScrapMotor& mot1, ScrapMotor& mot2, ScrapEncoder& enc1, ScrapEncoder& enc2) {
-	attachMotor1(mot1);
-	attachMotor2(mot2);
-	attachEncoder1(enc1);
-	attachEncoder2(enc2);
-	speedControl1 = ScrapMotorControl(*motor1,*encoder1);
-	speedControl2 = ScrapMotorControl(*motor2,*encoder2);
-	speedControl1.setMinPower(minSlowPower1);
-	speedControl1.setMinSpeed(speedControl1.convertToSpeed(minEncSpeed));
-	speedControl1.setMaxSpeed(speedControl1.convertToSpeed(maxEncSpeed));
-	speedControl2.setMinPower(minSlowPower2);
-	speedControl2.setMinSpeed(speedControl2.convertToSpeed(minEncSpeed));
-	speedControl2.setMaxSpeed(speedControl2.convertToSpeed(maxEncSpeed));
+	initValues();
+	speedControl1 = new ScrapMotorControl(mot1,enc1);
+	speedControl2 = new ScrapMotorControl(mot2,enc2);
 	stop();
 }
 
 ScrapDualController::ScrapDualController(ScrapMotor& mot1, ScrapMotor& mot2, ScrapEncoder& enc1, ScrapEncoder& enc2, ScrapSwitch& swi1, ScrapSwitch& swi2) {
-	attachMotor1(mot1);
-	attachMotor2(mot2);
-	attachEncoder1(enc1);
-	attachEncoder2(enc2);
-	speedControl1 = ScrapMotorControl(*motor1,*encoder1);
-	speedControl2 = ScrapMotorControl(*motor2,*encoder2);
-	speedControl1.setMinPower(minSlowPower1);
-	speedControl1.setMinSpeed(speedControl1.convertToSpeed(minEncSpeed));
-	speedControl1.setMaxSpeed(speedControl1.convertToSpeed(maxEncSpeed));
-	speedControl2.setMinPower(minSlowPower2);
-	speedControl2.setMinSpeed(speedControl2.convertToSpeed(minEncSpeed));
-	speedControl2.setMaxSpeed(speedControl2.convertToSpeed(maxEncSpeed));
+	initValues();
+	speedControl1 = new ScrapMotorControl(mot1,enc1);
+	speedControl2 = new ScrapMotorControl(mot2,enc2);
 	attachSwitch1(swi1);
 	attachSwitch2(swi2);
 	stop();
 }
 
-// move back until switches are activated
+// values shared with ScrapControllerInterface
+void ScrapDualController::initValues() {
+	encTolerance = SCRAPDUALCONTROLLER_ENCTOLERANCE;
+	minEncSpeed = SCRAPDUALCONTROLLER_MINENCSPEED;
+	maxEncSpeed = SCRAPDUALCONTROLLER_MAXENCSPEED;
+	setProfile(SCRAPDUALCONTROLLER_ACCEL,SCRAPDUALCONTROLLER_JERK);
+}
+
+// move back until switches are activated; each wheel homes on its own switch, see ScrapHoming
 bool ScrapDualController::performReset() {
-	speedControl1.stop();
-	speedControl2.stop();
-	motor1->setDirection(-1);
-	motor2->setDirection(-1);
-	// check if both switches are pressed
-	if (switch1->getIfPressed() && switch2->getIfPressed()) {
-		speedControl1.setSpeed(0);
-		speedControl2.setSpeed(0);
-		encoder1->resetCount();
-		encoder2->resetCount();
-		speedControl1.performMovement();
-		speedControl2.performMovement();
-		return true;
-	}
-	else {
-		if (switch1->getIfPressed()) {
-			speedControl1.setSpeed(0);
-		}
-		else {
-			//motor1->setMotor(-225);
-			speedControl1.setSpeed(0.0011);
-		}
-		if (switch2->getIfPressed()) {
-			speedControl2.setSpeed(0);
-		}
-		else {
-			//motor2->setMotor(-225);
-			speedControl2.setSpeed(0.0011);
-		}
-		speedControl1.performMovement();
-		speedControl2.performMovement();
-		return false;
-	}
+	bool done1 = homing1.perform(*speedControl1,*switch1);
+	bool done2 = homing2.perform(*speedControl2,*switch2);
+	return done1 && done2;
 }
 
 bool ScrapDualController::set(long g1, long g2) {
@@ -83,13 +50,13 @@ bool ScrapDualController::set(long g1, long g2) {
 	return checkIfDone();
 }
 
-bool ScrapDualController::set(long goal_both) {
-	return set(goal_both,goal_both);
+bool ScrapDualController::set(long goal) {
+	return set(goal,goal);
 }
 
 void ScrapDualController::shiftCount() {
-	encoder1->setCount(encoder1->getCount() - goal1);
-	encoder2->setCount(encoder2->getCount() - goal2);
+	speedControl1->setCount(speedControl1->getCount() - goal1);
+	speedControl2->setCount(speedControl2->getCount() - goal2);
 	set(0,0);
 }
 
@@ -101,108 +68,114 @@ bool ScrapDualController::performMovement() {
 	}
 	//else, gotta do stuff
 	if (checkIfDone1()) {
-		speedControl1.stop();
+		profile1.reset();
+		speedControl1->stop();
 	}
 	else {
-		if (encoder1->getCount() < goal1) {
-			speedControl1.setControl(calcSpeed1());
-		}
-		else {
-			speedControl1.setControl(-calcSpeed1());
-		}
+		float target = (speedControl1->getCount() < goal1) ? calcSpeed1() : -calcSpeed1();
+		speedControl1->setControl(profile1.step(target));
 	}
 	if (checkIfDone2()) {
-		speedControl2.stop();
+		profile2.reset();
+		speedControl2->stop();
 	}
 	else {
-		if (encoder2->getCount() < goal2) {
-			speedControl2.setControl(calcSpeed2());
-		}
-		else {
-			speedControl2.setControl(-calcSpeed2());
-		}
+		float target = (speedControl2->getCount() < goal2) ? calcSpeed2() : -calcSpeed2();
+		speedControl2->setControl(profile2.step(target));
 	}
 	// based on separation, balance speed of each motor
 	balanceSpeed();
 	// now execute movement
-	speedControl1.performMovement();
-	speedControl2.performMovement();
+	speedControl1->performMovement();
+	speedControl2->performMovement();
 	
 	return false;
 
 }
 
 bool ScrapDualController::checkIfNoSpeed() {
-	return (speedControl1.getSpeed() == 0 && speedControl2.getSpeed() == 0);
+	return (speedControl1->getSpeed() == 0 && speedControl2->getSpeed() == 0);
 }
 
 // calculate speed to give motor
 float ScrapDualController::calcSpeed1() {
-	int diff = getDiff1();
-	return speedControl1.convertToSpeed(map(diff,1,slowdownThresh1,minEncSpeed,maxEncSpeed));
+	long diff = getDiff1();
+	if (profile1.getIfEnabled()) {
+		return profile1.getIfBraking(goal1 - speedControl1->getCount()) ? 0 : maxEncSpeed;
+	}
+	return speedControl1->mapFloat(diff,1,slowdownThresh1,minEncSpeed,maxEncSpeed);
 }
 
 // calculate speed to give motor
 float ScrapDualController::calcSpeed2() {
-	int diff = getDiff2();
-	return speedControl2.convertToSpeed(map(diff,1,slowdownThresh2,minEncSpeed,maxEncSpeed));
+	long diff = getDiff2();
+	if (profile2.getIfEnabled()) {
+		return profile2.getIfBraking(goal2 - speedControl2->getCount()) ? 0 : maxEncSpeed;
+	}
+	return speedControl2->mapFloat(diff,1,slowdownThresh2,minEncSpeed,maxEncSpeed);
 }
 
 long ScrapDualController::getDiff1() {
-	return abs(encoder1->getCount() - goal1);
+	return abs(speedControl1->getCount() - goal1);
 }
 
 long ScrapDualController::getDiff2() {
-	return abs(encoder2->getCount() - goal2);
+	return abs(speedControl2->getCount() - goal2);
 }
 
 void ScrapDualController::stop() {
-	speedControl1.setSpeed(0);
-	speedControl2.setSpeed(0);
-	speedControl1.performMovement();
-	speedControl2.performMovement();
+	profile1.reset();
+	profile2.reset();
+	speedControl1->stop();
+	speedControl2->stop();
 }
 
 // increment or decrement target speed
-void ScrapDualController::incrementSpeed(int speedEncDiff) {
-	speedControl1.incrementSpeed(speedEncDiff);
-	speedControl2.incrementSpeed(speedEncDiff);
+void ScrapDualController::incrementSpeed(float speedDiff) {
+	speedControl1->incrementSpeed(speedDiff);
+	speedControl2->incrementSpeed(speedDiff);
+}
+
+void ScrapDualController::decrementSpeed(float speedDiff) {
+	speedControl1->decrementSpeed(speedDiff);
+	speedControl2->decrementSpeed(speedDiff);
 }
 
-void ScrapDualController::decrementSpeed(int speedEncDiff) {
-	speedControl1.decrementSpeed(speedEncDiff);
-	speedControl2.decrementSpeed(speedEncDiff);
+long ScrapDualController::getCount() {
+	ScrapEncoderPairSnapshot snapshot;
+	ScrapEncoderInterface::getSnapshot(speedControl1->getEncoder(),speedControl2->getEncoder(),snapshot);
+	return (snapshot.count1+snapshot.count2)/2;
 }
 
+/*
+Cross coupling: the difference in distance left is the position error between the wheels, and a speed
+proportional to it moves from the leading wheel to the lagging one, on top of each wheel's own goal.
+Both counts come from the same instant, so an edge between two reads does not show up as error.
+*/
 void ScrapDualController::balanceSpeed() {
-	float common_speed;
-	// if 1 too far ahead, balance power towards 2
-	if (abs((encoder1->getCount() - encoder2->getCount())*motor1->getDirection()) >= diffTolerance) {
-		moveSpeedToward2(encSpeedBalance);
-	}
-	// if 2 too far ahead, balance power towards 1
-	else if (abs((encoder1->getCount() - encoder2->getCount())*motor1->getDirection()) <= -diffTolerance) {
-		moveSpeedToward1(encSpeedBalance);
-	}
-	// otherwise, make speeds match if possible
-	else {
-		if (speedControl1.getSpeedGoal() != 0 && speedControl1.getSpeedGoal() != 0) {
-			common_speed = (speedControl1.getSpeedGoal() + speedControl2.getSpeedGoal())/2.0;
-			speedControl1.setSpeed(common_speed);
-			speedControl2.setSpeed(common_speed);
-		}
+	// a wheel that is done stays stopped
+	if (checkIfDone1() || checkIfDone2()) {
+		return;
 	}
+	ScrapEncoderPairSnapshot snapshot;
+	ScrapEncoderInterface::getSnapshot(speedControl1->getEncoder(),speedControl2->getEncoder(),snapshot);
+	// positive when wheel 1 is behind
+	long syncError = abs(goal1 - snapshot.count1) - abs(goal2 - snapshot.count2);
+	float correction = speedControl1->constrainFloat(syncGain*syncError,-maxSync,maxSync);
+	// the lagging wheel may go past maxEncSpeed by up to maxSync, so both wheels do not have to slow down
+	speedControl1->setSpeed(max(0.0f,speedControl1->getSpeedGoal()+correction));
+	speedControl2->setSpeed(max(0.0f,speedControl2->getSpeedGoal()-correction));
 }
 
 // balance speed
-void ScrapDualController::moveSpeedToward1(int speedEncDiff) {
-	speedControl1.incrementSpeed(speedEncDiff);
-	speedControl2.decrementSpeed(speedEncDiff);
+void ScrapDualController::moveSpeedToward1(float speedDiff) {
+	speedControl1->incrementSpeed(speedDiff);
+	speedControl2->decrementSpeed(speedDiff);
 }
 
-void ScrapDualController::moveSpeedToward2(int speedEncDiff) {
-	speedControl1.decrementSpeed(speedEncDiff);
-	speedControl2.incrementSpeed(speedEncDiff);
+void ScrapDualController::moveSpeedToward2(float speedDiff) {
+	speedControl1->decrementSpeed(speedDiff);
+	speedControl2->incrementSpeed(speedDiff);
 }
 
 // check if encoder count is within tolerance of goal
@@ -211,27 +184,9 @@ bool ScrapDualController::checkIfDone() {
 }
 
 bool ScrapDualController::checkIfDone1() {
-	return (encoder1->getCount() >= goal1 - encTolerance ) && (encoder1->getCount() <= goal1 + encTolerance );
+	return (speedControl1->getCount() >= goal1 - encTolerance ) && (speedControl1->getCount() <= goal1 + encTolerance );
 }
 
 bool ScrapDualController::checkIfDone2() {
-	return (encoder2->getCount() >= goal2 - encTolerance ) && (encoder2->getCount() <= goal2 + encTolerance );
-}
-
-// attach motors + encoders to be used
-void ScrapDualController::attachMotor1(ScrapMotor& mot) {
-	motor1 = &mot;
-}
-
-void ScrapDualController::attachMotor2(ScrapMotor& mot) {
-	motor2 = &mot;
-}
-
-void ScrapDualController::attachEncoder1(ScrapEncoder& enc) {
-	encoder1 = &enc;
+	return (speedControl2->getCount() >= goal2 - encTolerance ) && (speedControl2->getCount() <= goal2 + encTolerance );
 }
-
-void ScrapDualController::attachEncoder2(ScrapEncoder& enc) {
-	encoder2 = &enc;
-}
-
@@ -0,0 +1,33 @@
+#ifndef SCRAPCONTROLLER_SCRAPFIXED_H
+#define SCRAPCONTROLLER_SCRAPFIXED_H
+#include "Arduino.h"
+
+/*
+Q16.16 fixed point: 16 integer bits, 16 fraction bits in 32 bits.
+The AVR has no FPU; a 32-bit multiply is a few dozen cycles where a float multiply or divide is hundreds.
+Gains are written with Q16() so the conversion happens at compile time.
+*/
+
+typedef int32_t q16_t;
+
+#define Q16_ONE 65536L
+#define Q16(x) ((q16_t)((x) * 65536.0 + ((x) < 0 ? -0.5 : 0.5)))
+
+// integer part, rounded toward negative infinity
+inline int32_t q16ToInt(q16_t a) { return a >> 16; }
+// integer part, rounded to nearest
+inline int32_t q16Round(q16_t a) { return (a + Q16_ONE / 2) >> 16; }
+inline q16_t q16FromInt(int32_t a) { return a * Q16_ONE; }
+// for setup code only, pulls in float math
+inline q16_t q16FromFloat(float a) { return (q16_t)(a * 65536.0f + (a < 0 ? -0.5f : 0.5f)); }
+inline float q16ToFloat(q16_t a) { return a / 65536.0f; }
+
+// Q16.16 times a plain integer; the caller keeps |a*b| below 2^31
+inline q16_t q16MulInt(q16_t a, int32_t b) { return a * b; }
+// Q16.16 times a small Q16.16 in 32 bits, for |a| < 2^22 (64.0) and 0 <= b < 2^13 (0.125):
+// a drops its low 4 bits first, so the product stays below 2^31
+inline q16_t q16MulSmall(q16_t a, q16_t b) { return ((a >> 4) * b) >> 12; }
+
+inline q16_t q16Constrain(q16_t a, q16_t low, q16_t high) { return a < low ? low : (a > high ? high : a); }
+
+#endif //SCRAPCONTROLLER_SCRAPFIXED_H
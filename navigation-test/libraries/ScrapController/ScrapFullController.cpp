@@ -94,6 +94,152 @@ void ScrapFullController::moveSpeedTowardY(int speedEncDiff) {
 	yControl->incrementSpeed(speedEncDiff);
 }
 
+// motion queue
+
+// a segment starts where the last queued one ends, or where the gantry is
+bool ScrapFullController::queueMove(long gx, long gy, float speed) {
+	if (getIfQueueFull()) {
+		return false;
+	}
+	ScrapSegment& seg = getSegment(queueLength);
+	if (queueLength > 0) {
+		ScrapSegment& prev = getSegment(queueLength - 1);
+		seg.startX = prev.endX;
+		seg.startY = prev.endY;
+	}
+	else {
+		seg.startX = xControl->getCount();
+		seg.startY = yControl->getCount();
+	}
+	seg.endX = gx;
+	seg.endY = gy;
+	float dx = gx - seg.startX;
+	float dy = gy - seg.startY;
+	seg.length = sqrt(dx*dx + dy*dy);
+	// nothing to do
+	if (seg.length < 1) {
+		return true;
+	}
+	seg.dirX = dx/seg.length;
+	seg.dirY = dy/seg.length;
+	seg.speed = speed;
+	seg.entrySpeed = 0;
+	seg.maxEntrySpeed = (queueLength > 0) ? calcJunctionSpeed(getSegment(queueLength - 1),seg) : 0;
+	queueLength++;
+	planQueue();
+	return true;
+}
+
+/*
+Junction deviation: the corner is taken as if on an arc that stays within junctionDeviation of the
+corner point, at the speed where the centripetal acceleration on that arc is accel.
+The axes change speed all at once at the corner, so the step in axis speed is capped as well.
+Straight on is limited only by the segment speeds, a full reversal stops.
+*/
+float ScrapFullController::calcJunctionSpeed(ScrapSegment& prev, ScrapSegment& next) {
+	float cosTheta = -(prev.dirX*next.dirX + prev.dirY*next.dirY);
+	float limit = min(prev.speed,next.speed);
+	if (cosTheta > 0.9999) {
+		return 0;
+	}
+	if (cosTheta < -0.9999) {
+		return limit;
+	}
+	float sinHalf = sqrt(0.5*(1.0 - cosTheta));
+	limit = min(limit,(float)sqrt(accel*junctionDeviation*sinHalf/(1.0 - sinHalf)));
+	// |next direction - previous direction| is 2*cos(theta/2)
+	float jump = 2.0*sqrt(0.5*(1.0 + cosTheta));
+	return min(limit,SCRAPFULLCONTROLLER_MAXJUMP/jump);
+}
+
+/*
+Entry speeds: backward from a stop at the end of the queue, each segment must be able to slow down to
+the next entry speed; then forward from the segment being driven, each must be reachable by
+speeding up. The driven segment keeps the entry speed it started with.
+*/
+void ScrapFullController::planQueue() {
+	float exitSpeed = 0;
+	for (int8_t i = queueLength - 1; i >= 1; i--) {
+		ScrapSegment& seg = getSegment(i);
+		seg.entrySpeed = min(seg.maxEntrySpeed,(float)sqrt(exitSpeed*exitSpeed + 2*accel*seg.length));
+		exitSpeed = seg.entrySpeed;
+	}
+	for (uint8_t i = 1; i < queueLength; i++) {
+		ScrapSegment& prev = getSegment(i - 1);
+		ScrapSegment& seg = getSegment(i);
+		seg.entrySpeed = min(seg.entrySpeed,(float)sqrt(prev.entrySpeed*prev.entrySpeed + 2*accel*prev.length));
+	}
+}
+
+bool ScrapFullController::performQueue() {
+	if (queueLength == 0) {
+		stop();
+		return true;
+	}
+	ScrapSegment& seg = getSegment(0);
+	long x = xControl->getCount();
+	long y = yControl->getCount();
+	float relX = x - seg.startX;
+	float relY = y - seg.startY;
+	// distance along the segment and off it (positive to the right)
+	float along = relX*seg.dirX + relY*seg.dirY;
+	float across = relX*seg.dirY - relY*seg.dirX;
+	bool last = queueLength == 1;
+	if (last) {
+		if (abs(x - seg.endX) <= SCRAPFULLCONTROLLER_ENCTOLERANCE && abs(y - seg.endY) <= SCRAPFULLCONTROLLER_ENCTOLERANCE) {
+			clearQueue();
+			return true;
+		}
+	}
+	else if (along >= seg.length) {
+		// carry on into the next segment without stopping
+		queueHead = (queueHead + 1) % SCRAPFULLCONTROLLER_QUEUESIZE;
+		queueLength--;
+		return performQueue();
+	}
+	float exitSpeed = last ? 0 : getSegment(1).entrySpeed;
+	float remaining = max(0.0f,seg.length - along);
+	// trapezoid in distance: speed up from the entry speed, slow down to the exit speed
+	float speed = min(seg.speed,(float)sqrt(seg.entrySpeed*seg.entrySpeed + 2*accel*max(0.0f,along)));
+	speed = min(speed,(float)sqrt(exitSpeed*exitSpeed + 2*accel*remaining));
+	speed = max(speed,(float)SCRAPFULLCONTROLLER_MINSPEED);
+	if (last && along >= seg.length) {
+		// overshot the end: come straight back to it
+		speed = -SCRAPFULLCONTROLLER_MINSPEED;
+	}
+	// both axes follow the line; the across term pulls the gantry back onto it
+	setAxisSpeeds(speed*seg.dirX - pathGain*across*seg.dirY, speed*seg.dirY + pathGain*across*seg.dirX, seg.endY);
+	return false;
+}
+
+void ScrapFullController::setAxisSpeeds(float vx, float vy, long goalY) {
+	// a speed under one count per second would round to a stop anyway
+	if (abs(vx) < 1) {
+		xControl->stop();
+	}
+	else {
+		xControl->setSpeed(vx);
+		xControl->performSpeedMovement();
+	}
+	if (abs(vy) < 1) {
+		yControl->stop();
+	}
+	else {
+		// the goal only steers the cross coupling between the two Y wheels
+		yControl->set(goalY);
+		yControl->setSpeed(vy);
+		yControl->balanceSpeed();
+		yControl->performSpeedMovement();
+	}
+}
+
+void ScrapFullController::clearQueue() {
+	queueHead = 0;
+	queueLength = 0;
+	stop();
+}
+
+
 // attach controllers
 void ScrapFullController::attachControllerX(ScrapController& xCont) {
 	xControl = &xCont;
@@ -0,0 +1,62 @@
+#include "ScrapController.h"
+
+//ScrapHoming::
+
+/*
+Fast approach until the switch closes, back off until it opens and the axis is backoffCount past
+where it opened, then approach slowly and zero the count on the second contact. The fast approach finds the
+switch from far away; the slow one decides where zero is. Once homed, perform() keeps returning true
+while the axis rests on the switch, so axes that finish early can wait for the others.
+*/
+bool ScrapHoming::perform(ScrapMotorControl& control, ScrapSwitch& swi) {
+	bool pressed = swi.getIfPressed();
+	// homed and still resting on the switch: nothing to do; moved off it since: home again
+	if (phase == SCRAPHOMING_DONE && !pressed) {
+		phase = SCRAPHOMING_IDLE;
+	}
+	if (phase == SCRAPHOMING_IDLE) {
+		startTime = micros();
+		// already on the switch: only the back off and slow approach are needed
+		phase = pressed ? SCRAPHOMING_BACKOFF : SCRAPHOMING_FAST;
+	}
+	switch (phase) {
+		case SCRAPHOMING_FAST:
+			if (pressed) {
+				control.stop();
+				phase = SCRAPHOMING_BACKOFF;
+			}
+			else {
+				control.setControl(-fastSpeed);
+			}
+			break;
+		case SCRAPHOMING_BACKOFF:
+			if (pressed) {
+				releaseCount = control.getCount();
+			}
+			if (!pressed && control.getCount() - releaseCount >= backoffCount) {
+				control.stop();
+				phase = SCRAPHOMING_SLOW;
+			}
+			else {
+				control.setControl(backoffSpeed);
+			}
+			break;
+		case SCRAPHOMING_SLOW:
+			if (pressed) {
+				control.reset();
+				duration = micros() - startTime;
+				phase = SCRAPHOMING_DONE;
+			}
+			else {
+				control.setControl(-slowSpeed);
+			}
+			break;
+		default:
+			break;
+	}
+	if (phase == SCRAPHOMING_DONE) {
+		return true;
+	}
+	control.performMovement();
+	return false;
+}
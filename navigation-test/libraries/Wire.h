@@ -0,0 +1,109 @@
+// fake Wire for pc testing: transactions go to the emulated devices attached with fakeI2CAttach(),
+// and the time they would take on the bus is added up in fakeI2CStats()
+
+#ifndef WIRE_H
+#define WIRE_H
+
+#include "Arduino.h"
+
+#define BUFFER_LENGTH 32
+#define FAKE_I2C_ADDRESSES 128
+
+// an emulated device: receives what the master writes and supplies what it reads
+class FakeI2CDevice {
+public:
+    virtual ~FakeI2CDevice() {}
+    virtual bool present() { return true; } // answers its address
+    virtual void receive(const uint8_t* data, uint8_t count) = 0; // one write transaction
+    virtual uint8_t transmit() = 0; // next byte of a read transaction
+};
+
+inline FakeI2CDevice** fakeI2CDevices() {
+    static FakeI2CDevice* devices[FAKE_I2C_ADDRESSES];
+    return devices;
+}
+inline void fakeI2CAttach(uint8_t address, FakeI2CDevice* device) { fakeI2CDevices()[address] = device; }
+
+struct FakeI2CStats {
+    unsigned long transactions;
+    unsigned long bytes; // data bytes, without the address bytes
+    unsigned long busMicros; // time the bus was busy
+};
+inline FakeI2CStats& fakeI2CStats() {
+    static FakeI2CStats stats;
+    return stats;
+}
+
+class TwoWire {
+private:
+    uint8_t address = 0;
+    uint8_t txBuffer[BUFFER_LENGTH];
+    uint8_t txLength = 0;
+    uint8_t rxBuffer[BUFFER_LENGTH];
+    uint8_t rxLength = 0;
+    uint8_t rxIndex = 0;
+    unsigned long clock = 100000;
+    // start, address byte, data bytes and stop, 9 bits a byte with the acknowledge; the simulated
+    // clock moves on by as much, so the bus takes its time in the controller tests too
+    void account(uint8_t count) {
+        unsigned long bits = 9UL * (count + 1) + 2;
+        unsigned long time = (bits * 1000000UL + clock - 1) / clock;
+        fakeI2CStats().transactions++;
+        fakeI2CStats().bytes += count;
+        fakeI2CStats().busMicros += time;
+        if (useSimulatedTime()) {
+            simulatedMicros() += time;
+        }
+    }
+public:
+    void begin() {}
+    void setClock(unsigned long frequency) { clock = frequency; }
+    void beginTransmission(uint8_t newAddress) {
+        address = newAddress;
+        txLength = 0;
+    }
+    size_t write(uint8_t value) {
+        if (txLength >= BUFFER_LENGTH) {
+            return 0;
+        }
+        txBuffer[txLength++] = value;
+        return 1;
+    }
+    // 0 on success, 2 if no device answers the address
+    uint8_t endTransmission(bool stop = true) {
+        FakeI2CDevice* device = fakeI2CDevices()[address & (FAKE_I2C_ADDRESSES - 1)];
+        if (device && !device->present()) {
+            device = nullptr;
+        }
+        account(device ? txLength : 0);
+        if (!device) {
+            return 2;
+        }
+        device->receive(txBuffer, txLength);
+        return 0;
+    }
+    uint8_t requestFrom(uint8_t newAddress, uint8_t count) {
+        FakeI2CDevice* device = fakeI2CDevices()[newAddress & (FAKE_I2C_ADDRESSES - 1)];
+        if (device && !device->present()) {
+            device = nullptr;
+        }
+        rxIndex = 0;
+        rxLength = 0;
+        if (!device) {
+            account(0);
+            return 0;
+        }
+        count = min(count, (uint8_t)BUFFER_LENGTH);
+        while (rxLength < count) {
+            rxBuffer[rxLength++] = device->transmit();
+        }
+        account(count);
+        return count;
+    }
+    int available() { return rxLength - rxIndex; }
+    int read() { return rxIndex < rxLength ? rxBuffer[rxIndex++] : -1; }
+};
+
+static TwoWire Wire;
+
+#endif //WIRE_H
@@ -0,0 +1,45 @@
+// fake SparkFun line follower array for pc testing: getRaw() returns what the test stored in fakeBarRaw()
+// (SensorBar_Test runs the real library against an emulated SX1509 instead)
+
+#ifndef SENSORBAR_H
+#define SENSORBAR_H
+
+#include "Arduino.h"
+
+inline uint8_t& fakeBarRaw() {
+    static uint8_t raw = 0;
+    return raw;
+}
+
+#define SENSORBAR_SAMPLES 8
+#define SENSORBAR_DATA_REGISTER 0x11
+
+struct SensorBarSample {
+    uint8_t raw;
+    unsigned long time;
+    long count;
+};
+
+typedef long (*SensorBarCountSource)();
+
+class SensorBar {
+public:
+    SensorBar(uint8_t address, uint8_t resetPin = 255, uint8_t interruptPin = 255, uint8_t oscillatorPin = 255) {}
+    uint8_t begin() { return 1; }
+    uint8_t getRaw() { return fakeBarRaw(); }
+    uint8_t getLastRaw() { return fakeBarRaw(); }
+    void setBarStrobe() {}
+    void clearBarStrobe() {}
+    void setInvertBits() {}
+    void clearInvertBits() {}
+    // sampling is not faked; every read returns fakeBarRaw()
+    uint8_t beginSampling(SensorBarCountSource countSource = 0) { return 0; }
+    void markChange() {}
+    uint8_t updateSample() { return 0; }
+    uint8_t takeChange() { return 0; }
+    void addSample(uint8_t raw) {}
+    void dropChange() {}
+    uint8_t getSample(uint8_t back, SensorBarSample& sample) { return 0; }
+};
+
+#endif //SENSORBAR_H
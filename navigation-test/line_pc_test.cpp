@@ -0,0 +1,433 @@
+// host tests for LineIntersection, run against a fake sensor bar and middle IR
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "LineIntersection.h"
+#include "LineTracker.h"
+
+const int MIDDLE_PIN = A0;
+
+// counts heap allocations, to show the bitmask path makes none
+static long allocations = 0;
+
+void* operator new(size_t size) {
+    ++allocations;
+    void* p = std::malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+/** the String version of LineIntersection the tables replace, kept for comparison **/
+class LegacyLineIntersection {
+private:
+    SensorBar* mySensorBar;
+    uint8_t line_byte;
+    String lastFullReading = "000000000";
+    int lastPosition = 0;
+    int density = 0;
+    int middlePin;
+    int middleThreshold = 850;
+    const char ON_LINE = '1';
+    const char OFF_LINE = '0';
+
+public:
+    LegacyLineIntersection(int pin) {
+        mySensorBar = new SensorBar(0x3E);
+        middlePin = pin;
+    }
+
+    int getDensity() { return density; }
+    bool getMiddleState() { return analogRead(middlePin) >= middleThreshold; }
+
+    String getFullArrayInString() {
+        String lineData = "";
+        density = 0;
+        int bit_value;
+        line_byte = mySensorBar->getRaw();
+        bool state = getMiddleState();
+        for (int8_t i = BYTE_SIZE - 1; i >= 0; i--) {
+            bit_value = bitRead(line_byte, i);
+            lineData += (bit_value ? ON_LINE : OFF_LINE);
+            density += bit_value;
+            if (i == 4) {
+                lineData += (state ? ON_LINE : OFF_LINE);
+                density += state;
+            }
+        }
+        lastFullReading = lineData;
+        return lineData;
+    }
+
+    int getLinePosition(bool getNewData = false) {
+        int position = 0;
+        if (getNewData) {
+            getFullArrayInString();
+        }
+        if (lastFullReading[4] == ON_LINE) {
+            if (lastFullReading[3] == ON_LINE) position -= 1;
+            if (lastFullReading[5] == ON_LINE) position += 1;
+        }
+        else {
+            if (lastFullReading[3] == ON_LINE || lastFullReading[5] == ON_LINE) {
+                if (lastFullReading[3] == ON_LINE) position -= 4;
+                if (lastFullReading[5] == ON_LINE) position += 4;
+            }
+            else if (lastFullReading[2] == ON_LINE || lastFullReading[6] == ON_LINE) {
+                if (lastFullReading[2] == ON_LINE) position -= 8;
+                if (lastFullReading[6] == ON_LINE) position += 8;
+            }
+            else if (lastFullReading[1] == ON_LINE || lastFullReading[7] == ON_LINE) {
+                if (lastFullReading[1] == ON_LINE) position -= 12;
+                if (lastFullReading[7] == ON_LINE) position += 12;
+            }
+            else if (lastFullReading[0] == ON_LINE || lastFullReading[8] == ON_LINE) {
+                if (lastFullReading[0] == ON_LINE) position -= 16;
+                if (lastFullReading[8] == ON_LINE) position += 16;
+            }
+            if (position == 0) {
+                position = lastPosition;
+            }
+        }
+        lastPosition = position;
+        return lastPosition;
+    }
+
+    bool getIfAtPerpendicular() { return getDensity() >= 5; }
+    bool getIfAtSeparatingY() {
+        return (lastFullReading[2] == ON_LINE && lastFullReading[6] == ON_LINE)
+               || (lastFullReading[1] == ON_LINE && lastFullReading[7] == ON_LINE);
+    }
+    bool getIfAtCrossingY() { return getIfAtSeparatingY(); }
+    bool getIfAtRightY() { return getIfAtPerpendicular(); }
+    bool getIfAtLeftY() { return getIfAtPerpendicular(); }
+};
+
+/** puts a 9-bit reading, leftmost sensor in bit 8, on the fake bar and middle IR **/
+void showReading(int reading) {
+    fakeBarRaw() = uint8_t((reading & 0x0F) | ((reading >> 1) & 0xF0));
+    fakeAnalog()[MIDDLE_PIN] = (reading >> LINE_MIDDLE_BIT) & 1 ? 1000 : 100;
+}
+
+/** every reading after every other reading gives the same text, density, position and class both ways **/
+int testParity() {
+    int failures = 0;
+    LegacyLineIntersection legacy(MIDDLE_PIN);
+    LineIntersection line(MIDDLE_PIN);
+    for (int previous = 0; previous < LINE_READING_COUNT; ++previous) {
+        for (int reading = 0; reading < LINE_READING_COUNT; ++reading) {
+            // the position is remembered across readings, so start from the previous one every time
+            showReading(previous);
+            legacy.getLinePosition(true);
+            line.getLinePosition(true);
+            showReading(reading);
+            String text = legacy.getFullArrayInString();
+            if (line.getFullArrayInString() != text || line.getReading() != reading) {
+                std::printf("FAIL reading %s packed as 0x%03X\n", text.c_str(), line.getReading());
+                ++failures;
+            }
+            int legacyPosition = legacy.getLinePosition();
+            int position = line.getLinePosition();
+            if (line.getDensity() != legacy.getDensity() || position != legacyPosition ||
+                line.getIfAtPerpendicular() != legacy.getIfAtPerpendicular() ||
+                line.getIfAtSeparatingY() != legacy.getIfAtSeparatingY() ||
+                line.getIfAtCrossingY() != legacy.getIfAtCrossingY() ||
+                line.getIfAtLeftY() != legacy.getIfAtLeftY() ||
+                line.getIfAtRightY() != legacy.getIfAtRightY()) {
+                std::printf("FAIL %s: density %d/%d, position %d/%d, class 0x%02X\n", text.c_str(),
+                            line.getDensity(), legacy.getDensity(), position, legacyPosition,
+                            line.getIntersectionClass());
+                ++failures;
+            }
+            if (failures > 10) {
+                return failures;
+            }
+        }
+    }
+    std::printf("parity with the String version: %d readings after each of %d readings, %d failures\n",
+                LINE_READING_COUNT, LINE_READING_COUNT, failures);
+    return failures;
+}
+
+/** the per-sample work of the sketch loop both ways: time per sample, and no allocations for the bitmask **/
+int testAllocations() {
+    const int samples = 200000;
+    LegacyLineIntersection legacy(MIDDLE_PIN);
+    LineIntersection line(MIDDLE_PIN);
+    std::mt19937 random(1);
+    int readings[256];
+    for (int& r : readings) {
+        r = random() % LINE_READING_COUNT;
+    }
+    long sink = 0;
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; ++i) {
+        showReading(readings[i & 255]);
+        legacy.getFullArrayInString();
+        sink += legacy.getLinePosition() + legacy.getIfAtCrossingY() + legacy.getIfAtPerpendicular();
+    }
+    double legacyUs = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() * 1e6 / samples;
+
+    long before = allocations;
+    begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; ++i) {
+        showReading(readings[i & 255]);
+        line.readLine();
+        sink += line.getLinePosition() + line.getIfAtCrossingY() + line.getIfAtPerpendicular();
+    }
+    double us = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() * 1e6 / samples;
+    double lineAllocations = double(allocations - before) / samples;
+
+    // std::string keeps 9 characters inline, so only the AVR String allocates on every +=
+    std::printf("per sample: String %.3f us; bitmask %.3f us, %.2f allocations (%ld)\n",
+                legacyUs, us, lineAllocations, sink % 2);
+    if (lineAllocations != 0) {
+        std::printf("FAIL the bitmask path allocates\n");
+        return 1;
+    }
+    return 0;
+}
+
+/**
+tape lines on the board, in mm; the robot drives along x = 0 with the bar at y, one count per mm.
+the bar has 8 sensors 9.5 mm apart with the middle IR between the middle two.
+**/
+struct Segment {
+    double x1, y1, x2, y2;
+};
+
+const double LINE_WIDTH = 19.0;
+const double SHAPE_Y = 200.0; // where the lines of every scene meet
+
+struct Scene {
+    const char* name;
+    uint8_t shape; // the shape this scene ends at
+    std::vector<Segment> lines;
+
+    bool onLine(double x, double y) const {
+        for (const Segment& s : lines) {
+            double dx = s.x2 - s.x1;
+            double dy = s.y2 - s.y1;
+            double t = ((x - s.x1) * dx + (y - s.y1) * dy) / (dx * dx + dy * dy);
+            t = std::max(0.0, std::min(1.0, t));
+            if (std::hypot(x - s.x1 - t * dx, y - s.y1 - t * dy) <= LINE_WIDTH / 2) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** 9-bit reading with the bar at y, leftmost sensor in bit 8 **/
+    int read(double y) const {
+        int reading = 0;
+        for (int i = 0; i <= BYTE_SIZE; ++i) {
+            double x = i == LINE_MIDDLE_BIT ? 0 : ((i < LINE_MIDDLE_BIT ? i : i - 1) - 3.5) * 9.5;
+            reading |= onLine(x, y) << (BYTE_SIZE - i);
+        }
+        return reading;
+    }
+};
+
+std::vector<Scene> makeScenes() {
+    const double along = 600 * std::cos(M_PI / 6); // branches 30 degrees off the followed line
+    const double across = 600 * std::sin(M_PI / 6);
+    Segment followed = { 0, -1000, 0, 1000 };
+    std::vector<Scene> scenes;
+    scenes.push_back({ "straight line", LINE_SHAPE_NONE, { followed } });
+    scenes.push_back({ "perpendicular line", LINE_SHAPE_PERPENDICULAR, { followed, { -300, SHAPE_Y, 300, SHAPE_Y } } });
+    // the second line of the crossing Y comes in from the right; it merges, so it is not a right branch
+    scenes.push_back({ "crossing Y", LINE_SHAPE_CROSSING_Y, { followed, { across, SHAPE_Y - along, 0, SHAPE_Y } } });
+    scenes.push_back({ "separating Y", LINE_SHAPE_SEPARATING_Y,
+                       { { 0, -1000, 0, SHAPE_Y }, { 0, SHAPE_Y, -across, SHAPE_Y + along }, { 0, SHAPE_Y, across, SHAPE_Y + along } } });
+    scenes.push_back({ "line from the left", LINE_SHAPE_LEFT_BRANCH, { followed, { -300, SHAPE_Y, 0, SHAPE_Y } } });
+    scenes.push_back({ "line from the right", LINE_SHAPE_RIGHT_BRANCH, { followed, { 0, SHAPE_Y, 300, SHAPE_Y } } });
+    return scenes;
+}
+
+/** where each shape may be reported, relative to SHAPE_Y when driving forward **/
+void getWindow(uint8_t shape, double& early, double& late) {
+    early = -12;
+    late = 12;
+    if (shape == LINE_SHAPE_CROSSING_Y) {
+        early = -60; // the lines touch before their centers meet
+    }
+    if (shape == LINE_SHAPE_SEPARATING_Y) {
+        late = 60; // the lines have to move a sensor apart first
+    }
+}
+
+/**
+drives the tracker over the scene from y = from to y = to, maxStep counts at most per reading, with each
+sensor reading wrong with probability noise; returns the y the shape was reported at, NAN if it was not
+**/
+double replay(const Scene& scene, uint8_t shape, double from, double to, int maxStep, double noise, unsigned seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    LineTracker tracker;
+    long count = 1000; // any start count; backward drives count down
+    int direction = to > from ? 1 : -1;
+    tracker.start(shape, count);
+    for (double y = from; direction * (to - y) >= 0; ) {
+        int reading = scene.read(y);
+        for (int i = 0; i <= BYTE_SIZE; ++i) {
+            if (chance(random) < noise) {
+                reading ^= 1 << i;
+            }
+        }
+        if (tracker.update(uint16_t(reading), count)) {
+            return from + direction * std::fabs(tracker.getEventCount() - 1000.0);
+        }
+        int step = 1 + random() % maxStep;
+        y += direction * step;
+        count += direction * step;
+    }
+    return NAN;
+}
+
+/** every tracker on every scene: only the scene's own shape is reported, and near where the lines meet **/
+int testTrackerScenes() {
+    int failures = 0;
+    std::vector<Scene> scenes = makeScenes();
+    const uint8_t shapes[] = { LINE_SHAPE_PERPENDICULAR, LINE_SHAPE_CROSSING_Y, LINE_SHAPE_SEPARATING_Y,
+                               LINE_SHAPE_LEFT_BRANCH, LINE_SHAPE_RIGHT_BRANCH };
+    const char* names[] = { "", "perpendicular", "crossing Y", "separating Y", "left branch", "right branch" };
+    std::printf("shape reported, mm from where the lines meet (steps of 1-3 counts per reading):\n");
+    for (const Scene& scene : scenes) {
+        std::printf("  %-20s", scene.name);
+        for (uint8_t shape : shapes) {
+            double at = replay(scene, shape, 0, 500, 3, 0, 1);
+            if (std::isnan(at)) {
+                std::printf("  %s -", names[shape]);
+            }
+            else {
+                std::printf("  %s %+.0f", names[shape], at - SHAPE_Y);
+            }
+            double early, late;
+            getWindow(shape, early, late);
+            bool expected = shape == scene.shape;
+            bool inWindow = !std::isnan(at) && at - SHAPE_Y >= early && at - SHAPE_Y <= late;
+            if (expected != inWindow || (!expected && !std::isnan(at))) {
+                std::printf("\nFAIL %s tracker on %s", names[shape], scene.name);
+                ++failures;
+            }
+        }
+        std::printf("\n");
+    }
+
+    // one reading cannot tell the Ys apart: the single-frame check fires on both
+    LineIntersection line(MIDDLE_PIN);
+    std::printf("  single-frame getIfAtCrossingY first true at:");
+    for (const Scene& scene : scenes) {
+        if (scene.shape != LINE_SHAPE_CROSSING_Y && scene.shape != LINE_SHAPE_SEPARATING_Y) {
+            continue;
+        }
+        double first = NAN;
+        for (double y = 0; y <= 500 && std::isnan(first); ++y) {
+            showReading(scene.read(y));
+            line.readLine();
+            if (line.getIfAtCrossingY()) {
+                first = y;
+            }
+        }
+        if (std::isnan(first)) {
+            std::printf(" %s never", scene.name);
+        }
+        else {
+            std::printf(" %s %+.0f", scene.name, first - SHAPE_Y);
+        }
+    }
+    std::printf("\n");
+    return failures;
+}
+
+/** the same shapes at other speeds, backward, and with sensors misreading **/
+int testTrackerReplay() {
+    int failures = 0;
+    std::vector<Scene> scenes = makeScenes();
+
+    // speed: the history is by distance, so big steps between readings only cost resolution
+    for (int maxStep : { 1, 5 }) {
+        for (const Scene& scene : scenes) {
+            if (scene.shape == LINE_SHAPE_NONE) {
+                continue;
+            }
+            double at = replay(scene, scene.shape, 0, 500, maxStep, 0, 2);
+            double early, late;
+            getWindow(scene.shape, early, late);
+            if (std::isnan(at) || at - SHAPE_Y < early || at - SHAPE_Y > late + maxStep) {
+                std::printf("FAIL %s with steps up to %d: reported at %+.0f\n", scene.name, maxStep, at - SHAPE_Y);
+                ++failures;
+            }
+        }
+    }
+
+    // backward over a crossing Y is a separating Y, and the other way around
+    double crossingBack = replay(scenes[2], LineTracker::getShape(BackwardFollowUntilSeparatingY), 500, 0, 3, 0, 3);
+    double separatingBack = replay(scenes[3], LineTracker::getShape(BackwardFollowUntilCrossingY), 500, 0, 3, 0, 3);
+    double crossingWrong = replay(scenes[2], LINE_SHAPE_CROSSING_Y, 500, 0, 3, 0, 3);
+    std::printf("backward: crossing Y read as separating at %+.0f, separating Y as crossing at %+.0f\n",
+                crossingBack - SHAPE_Y, separatingBack - SHAPE_Y);
+    if (std::isnan(crossingBack) || std::isnan(separatingBack) || !std::isnan(crossingWrong) ||
+        crossingBack - SHAPE_Y > 0 || crossingBack - SHAPE_Y < -80 ||
+        separatingBack - SHAPE_Y < 0 || separatingBack - SHAPE_Y > 60) {
+        std::printf("FAIL backward approaches\n");
+        ++failures;
+    }
+
+    // misreading sensors: the right shape still shows up in place, and a straight line shows nothing
+    const double noise = 0.01;
+    const int runs = 200;
+    int missed = 0;
+    int misplaced = 0;
+    int falseEvents = 0;
+    for (unsigned seed = 0; seed < runs; ++seed) {
+        for (const Scene& scene : scenes) {
+            if (scene.shape == LINE_SHAPE_NONE) {
+                for (uint8_t shape = LINE_SHAPE_PERPENDICULAR; shape <= LINE_SHAPE_RIGHT_BRANCH; ++shape) {
+                    falseEvents += !std::isnan(replay(scene, shape, 0, 500, 3, noise, seed));
+                }
+                continue;
+            }
+            double at = replay(scene, scene.shape, 0, 500, 3, noise, seed);
+            double early, late;
+            getWindow(scene.shape, early, late);
+            if (std::isnan(at)) {
+                ++missed;
+            }
+            else if (at - SHAPE_Y < early || at - SHAPE_Y > late) {
+                ++misplaced;
+            }
+        }
+    }
+    std::printf("%.0f%% of sensors misreading, %d runs of each scene: %d missed, %d misplaced, "
+                "%d reported on a straight line\n", noise * 100, runs, missed, misplaced, falseEvents);
+    // one in a hundred replays at most, of 5 scenes and of 5 trackers on the straight line
+    if (missed + misplaced > runs * 5 / 100 || falseEvents > runs * 5 / 100) {
+        std::printf("FAIL tracker with misreading sensors\n");
+        ++failures;
+    }
+    return failures;
+}
+
+int main() {
+    int failures = testParity();
+    failures += testAllocations();
+    failures += testTrackerScenes();
+    failures += testTrackerReplay();
+
+    return failures ? 1 : 0;
+}
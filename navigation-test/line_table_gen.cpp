@@ -0,0 +1,72 @@
+// generates LineTableData.h, the density, position and class of every LineIntersection reading
+// usage: LineTable_Generator > libraries/LineIntersection/LineTableData.h
+// (copy the result to competition-code/libraries/LineIntersection as well)
+// the rules are the ones the string version applied to its 9 characters, leftmost sensor first
+
+#include <cstdio>
+
+#include "LineIntersection.h"
+
+/** character i of the string version: sensor i from the left, the middle IR at 4 **/
+bool onLine(int reading, int i) {
+    return (reading >> (BYTE_SIZE - i)) & 1;
+}
+
+int density(int reading) {
+    int count = 0;
+    for (int i = 0; i <= BYTE_SIZE; ++i) {
+        count += onLine(reading, i);
+    }
+    return count;
+}
+
+int position(int reading) {
+    int position = 0;
+    if (onLine(reading, 4)) {
+        // on the line, only the closest two sensors count
+        if (onLine(reading, 3)) position -= 1;
+        if (onLine(reading, 5)) position += 1;
+        return position;
+    }
+    // otherwise the closest pair that sees the line
+    for (int away = 1; away <= 4; ++away) {
+        if (onLine(reading, 4 - away) || onLine(reading, 4 + away)) {
+            if (onLine(reading, 4 - away)) position -= 4 * away;
+            if (onLine(reading, 4 + away)) position += 4 * away;
+            break;
+        }
+    }
+    return position == 0 ? LINE_NO_POSITION : position;
+}
+
+int intersectionClass(int reading) {
+    int result = 0;
+    if (density(reading) >= 5) {
+        result |= LINE_PERPENDICULAR | LINE_LEFT_Y | LINE_RIGHT_Y;
+    }
+    if ((onLine(reading, 2) && onLine(reading, 6)) || (onLine(reading, 1) && onLine(reading, 7))) {
+        result |= LINE_CROSSING_Y | LINE_SEPARATING_Y;
+    }
+    return result;
+}
+
+void printTable(const char* comment, const char* type, const char* name, int (*entry)(int), bool hex) {
+    std::printf("// %s\n", comment);
+    std::printf("static const %s %s[LINE_READING_COUNT] PROGMEM = {\n", type, name);
+    for (int reading = 0; reading < LINE_READING_COUNT; ++reading) {
+        std::printf(hex ? "%s0x%02X,%s" : "%s%4d,%s", (reading % 16 == 0) ? "\t" : "", entry(reading),
+                    (reading % 16 == 15) ? "\n" : " ");
+    }
+    std::printf("};\n\n");
+}
+
+int main() {
+    std::printf("// generated by LineTable_Generator (navigation-test/line_table_gen.cpp) - do not edit\n");
+    std::printf("#ifndef LINETABLEDATA_H\n#define LINETABLEDATA_H\n\n#include \"LineIntersection.h\"\n\n");
+    printTable("sensors on the line", "uint8_t", "LINE_DENSITY", density, false);
+    printTable("line position, negative to the left; LINE_NO_POSITION off the middle if nothing or a balanced pair sees the line",
+               "int8_t", "LINE_POSITION", position, false);
+    printTable("LINE_PERPENDICULAR, LINE_CROSSING_Y, ... flags", "uint8_t", "LINE_CLASS", intersectionClass, true);
+    std::printf("#endif\n");
+    return 0;
+}
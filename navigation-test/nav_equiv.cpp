@@ -0,0 +1,332 @@
+// checks that Navigation (BoardTable states) and Navigation17 (polar coordinates) agree
+// usage: Navigation_Equivalence [depth] [threads]
+// runs every command sequence (left, right, forward, backward) up to depth from the start in both models
+// and reports where they diverge:
+//   availability - a command works in one model only
+//   turn         - both turn, by a different angle
+//   approach     - both go forward, with a different Approach
+//   position     - a state of one model is reached together with two different states of the other
+// Navigation17 backward moves have no approach, so only their availability is compared.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "BoardTable.h"
+#include "Navigation17.h"
+
+// tasks with more than this many commands left are split into one task per command
+const int SPLIT_DEPTH = 5;
+const int MAX_DEPTH = 32; // paths are packed 2 bits per command into 64 bits
+const int NAV17_STATE_COUNT = DIRECTION_COUNT * (Navigation17::MAX_R + 1) * DIRECTION_COUNT;
+const int NO_MATCH = -1;
+const char COMMAND_LETTERS[] = { 'l', 'r', 'f', 'b' };
+
+enum Divergence { Availability, TurnAngle, ApproachType, Position, DIVERGENCE_KINDS };
+const char* DIVERGENCE_NAMES[DIVERGENCE_KINDS] = { "availability", "turn", "approach", "position" };
+
+struct Task {
+    uint16_t state;
+    Navigation17 nav17;
+    uint8_t depth;   // commands taken so far
+    uint64_t path;
+};
+
+struct Found {
+    unsigned long long count = 0;
+    Task example;
+    int command;
+    std::string detail;
+};
+
+// key: kind, Navigation state, Navigation17 state, command
+typedef std::map<std::tuple<int, int, int, int>, Found> DivergenceMap;
+
+int nav17Id(Navigation17& nav17) {
+    Coordinate position = nav17.getPosition();
+    return (position.t * (Navigation17::MAX_R + 1) + position.r) * DIRECTION_COUNT + nav17.getFacing();
+}
+
+std::string nav17Text(int id) {
+    int facing = id % DIRECTION_COUNT;
+    int r = (id / DIRECTION_COUNT) % (Navigation17::MAX_R + 1);
+    int t = id / DIRECTION_COUNT / (Navigation17::MAX_R + 1);
+    return "(" + std::to_string(t) + ", " + std::to_string(r) + ") facing " + DIRECTION_NAMES[facing];
+}
+
+std::string pathText(const Task& task) {
+    std::string text;
+    for (int i = 0; i < task.depth; ++i) {
+        text += COMMAND_LETTERS[(task.path >> (2 * i)) & 0x03];
+    }
+    return text.empty() ? "(start)" : text;
+}
+
+/** Turn enum to degrees, left positive like Movement::turn **/
+int turnDegrees(uint8_t turn) {
+    int degrees = ((turn + 1) / 2) * 45;
+    return (turn % 2) ? degrees : -degrees;
+}
+
+class Checker {
+private:
+    const int maxDepth;
+    // first state of the other model each state was reached with
+    std::vector<std::atomic<int> > navMatch;
+    std::vector<std::atomic<int> > nav17Match;
+    // work stealing: every worker takes from the back of its own deque and steals from the front of others
+    std::vector<std::deque<Task> > queues;
+    std::vector<std::unique_ptr<std::mutex> > locks;
+    std::atomic<long> pending; // tasks queued or running
+    std::atomic<unsigned long long> visited;
+    std::atomic<unsigned long long> steals;
+    std::mutex resultLock;
+    DivergenceMap divergences;
+
+    void record(DivergenceMap& local, Divergence kind, Task& task, int command, const std::string& detail) {
+        Found& found = local[std::make_tuple(int(kind), int(task.state), nav17Id(task.nav17), command)];
+        if (found.count++ == 0) {
+            found.example = task;
+            found.command = command;
+            found.detail = detail;
+        }
+    }
+
+    /** pairs the two states, a position divergence if either was already paired with something else **/
+    void match(DivergenceMap& local, Task& task) {
+        int id = nav17Id(task.nav17);
+        int expected = NO_MATCH;
+        if (!navMatch[task.state].compare_exchange_strong(expected, id) && expected != id) {
+            record(local, Position, task, -1, "Navigation state also reached as Navigation17 " + nav17Text(expected));
+        }
+        expected = NO_MATCH;
+        if (!nav17Match[id].compare_exchange_strong(expected, task.state) && expected != task.state) {
+            record(local, Position, task, -1, "Navigation17 state also reached as Navigation state " +
+                   BoardTable::getIntersectionName(BoardTable::getIntersection(expected)) + " " +
+                   BoardTable::getStateName(expected));
+        }
+    }
+
+    /** applies command to both models; false if the search stops here **/
+    bool step(DivergenceMap& local, Task& task, int command, Task& next) {
+        next = task;
+        next.depth = task.depth + 1;
+        next.path = task.path | (uint64_t(command) << (2 * task.depth));
+        next.state = BoardTable::getNextState(task.state, RouteCommand(command));
+        bool navOk = next.state != BOARD_NO_STATE;
+        bool nav17Ok;
+        switch (command) {
+        case CommandLeft: nav17Ok = next.nav17.turnLeft(); break;
+        case CommandRight: nav17Ok = next.nav17.turnRight(); break;
+        case CommandForward: nav17Ok = next.nav17.goForward(); break;
+        default: nav17Ok = next.nav17.goBackward(); break;
+        }
+        if (navOk != nav17Ok) {
+            record(local, Availability, task, command, std::string("only ") +
+                   (navOk ? "Navigation" : "Navigation17") + " can move");
+            return false;
+        }
+        if (!navOk) {
+            return false;
+        }
+        uint8_t move = BoardTable::getMove(task.state, RouteCommand(command));
+        if (command == CommandLeft || command == CommandRight) {
+            int turned = (next.nav17.getFacing() - task.nav17.getFacing() + DIRECTION_COUNT) % DIRECTION_COUNT;
+            int nav17Degrees = (turned <= DIRECTION_COUNT / 2 ? turned : turned - DIRECTION_COUNT) * 45;
+            int navDegrees = turnDegrees(move);
+            // a 180 degree turn can go either way
+            if (navDegrees != nav17Degrees && !(abs(navDegrees) == 180 && abs(nav17Degrees) == 180)) {
+                record(local, TurnAngle, task, command, "Navigation turns " + std::to_string(navDegrees) +
+                       ", Navigation17 turns " + std::to_string(nav17Degrees));
+            }
+        }
+        else if (command == CommandForward) {
+            Approach nav17Approach = Navigation17::getApproach(task.nav17.getPosition(), task.nav17.getFacing());
+            if (move != nav17Approach) {
+                record(local, ApproachType, task, command, "Navigation approach " + std::to_string(move) +
+                       ", Navigation17 approach " + std::to_string(nav17Approach));
+            }
+        }
+        return true;
+    }
+
+    /** depth first search of everything below task **/
+    void search(DivergenceMap& local, Task& task, unsigned long long& count) {
+        ++count;
+        match(local, task);
+        if (task.depth >= maxDepth) {
+            return;
+        }
+        Task next;
+        for (int c = 0; c < ROUTE_COMMAND_COUNT; ++c) {
+            if (step(local, task, c, next)) {
+                search(local, next, count);
+            }
+        }
+    }
+
+    void push(int worker, const Task& task) {
+        ++pending;
+        std::lock_guard<std::mutex> lock(*locks[worker]);
+        queues[worker].push_back(task);
+    }
+
+    bool take(int worker, Task& task, std::mt19937& random) {
+        {
+            std::lock_guard<std::mutex> lock(*locks[worker]);
+            if (!queues[worker].empty()) {
+                task = queues[worker].back();
+                queues[worker].pop_back();
+                return true;
+            }
+        }
+        int count = int(queues.size());
+        int first = random() % count;
+        for (int i = 0; i < count; ++i) {
+            int victim = (first + i) % count;
+            if (victim == worker) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(*locks[victim]);
+            if (!queues[victim].empty()) {
+                task = queues[victim].front();
+                queues[victim].pop_front();
+                ++steals;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void work(int worker) {
+        DivergenceMap local;
+        std::mt19937 random(worker);
+        unsigned long long count = 0;
+        Task task;
+        while (pending > 0) {
+            if (!take(worker, task, random)) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (maxDepth - task.depth > SPLIT_DEPTH) {
+                // split: children go on this worker's deque for others to steal
+                ++count;
+                match(local, task);
+                Task next;
+                for (int c = 0; c < ROUTE_COMMAND_COUNT; ++c) {
+                    if (step(local, task, c, next)) {
+                        push(worker, next);
+                    }
+                }
+            }
+            else {
+                search(local, task, count);
+            }
+            --pending;
+        }
+        visited += count;
+        std::lock_guard<std::mutex> lock(resultLock);
+        for (auto& entry : local) {
+            Found& found = divergences[entry.first];
+            if (found.count == 0) {
+                found = entry.second;
+            }
+            else {
+                found.count += entry.second.count;
+            }
+        }
+    }
+
+public:
+    Checker(int depth, int threadCount) : maxDepth(depth), navMatch(BOARD_STATE_COUNT),
+                                          nav17Match(NAV17_STATE_COUNT), queues(threadCount),
+                                          pending(0), visited(0), steals(0) {
+        for (auto& m : navMatch) m = NO_MATCH;
+        for (auto& m : nav17Match) m = NO_MATCH;
+        for (int i = 0; i < threadCount; ++i) {
+            locks.emplace_back(new std::mutex());
+        }
+    }
+
+    void run() {
+        Task start;
+        start.state = BoardTable::getStartState();
+        start.depth = 0;
+        start.path = 0;
+        push(0, start);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < int(queues.size()); ++i) {
+            threads.emplace_back(&Checker::work, this, i);
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    unsigned long long getVisited() { return visited; }
+    unsigned long long getSteals() { return steals; }
+    DivergenceMap& getDivergences() { return divergences; }
+
+    int getMatchedCount() {
+        int matched = 0;
+        for (auto& m : navMatch) {
+            matched += m != NO_MATCH;
+        }
+        return matched;
+    }
+};
+
+int main(int argc, char** argv) {
+    int depth = argc > 1 ? std::atoi(argv[1]) : 10;
+    int threadCount = argc > 2 ? std::atoi(argv[2]) : int(std::thread::hardware_concurrency());
+    depth = std::max(0, std::min(depth, MAX_DEPTH));
+    threadCount = std::max(1, threadCount);
+
+    Checker checker(depth, threadCount);
+    auto begin = std::chrono::steady_clock::now();
+    checker.run();
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - begin).count();
+
+    std::printf("depth %d on %d threads: %llu states in %.2f s (%.0f states/s), %llu steals\n", depth, threadCount,
+                checker.getVisited(), seconds, checker.getVisited() / std::max(seconds, 1e-9), checker.getSteals());
+    std::printf("%d Navigation states reached\n", checker.getMatchedCount());
+
+    // distinct divergences per kind, with the first few examples
+    const int examples = 5;
+    for (int kind = 0; kind < DIVERGENCE_KINDS; ++kind) {
+        int distinct = 0;
+        unsigned long long total = 0;
+        for (auto& entry : checker.getDivergences()) {
+            if (std::get<0>(entry.first) != kind) {
+                continue;
+            }
+            Found& found = entry.second;
+            if (distinct++ < examples) {
+                Coordinate position = found.example.nav17.getPosition();
+                std::string path = pathText(found.example);
+                if (found.command >= 0) {
+                    path = path + " then " + COMMAND_LETTERS[found.command];
+                }
+                std::printf("  %s: %s %s / (%d, %d) facing %s after %s: %s\n", DIVERGENCE_NAMES[kind],
+                            BoardTable::getIntersectionName(BoardTable::getIntersection(found.example.state)).c_str(),
+                            BoardTable::getStateName(found.example.state).c_str(), position.t, position.r,
+                            DIRECTION_NAMES[found.example.nav17.getFacing()], path.c_str(), found.detail.c_str());
+            }
+            total += found.count;
+        }
+        std::printf("%s divergences: %d distinct, %llu along all paths\n", DIVERGENCE_NAMES[kind], distinct, total);
+    }
+    return 0;
+}
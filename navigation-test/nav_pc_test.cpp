@@ -1,16 +1,567 @@
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
+#include <new>
+#include <vector>
 
 #include "Navigation17.h"
+#include "Navigation.h"
+#include "Gameboard.h"
 
-int main() {
+// counts heap allocations while countAllocations is set
+bool countAllocations = false;
+long allocationCount = 0;
+
+void* operator new(std::size_t size) {
+    if (countAllocations) {
+        ++allocationCount;
+    }
+    void* p = std::malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void testNavigation17() {
     Movement m;
     Navigation17 n(&m);
 
     std::cout << n.getCurrentStateInfo();
     n.goForward();
     std::cout << n.getCurrentStateInfo();
+}
+
+/** Navigation17's moves as they were worked out after every move before the move table (Serial output removed,
+ *  out of range directions wrapped), fills available and approaches for position **/
+void navigation17Reference(Coordinate position, Coordinate* available, Approach* approaches) {
+    const int MAX_R = Navigation17::MAX_R;
+    for (int i = 0; i < DIRECTION_COUNT; ++i) {
+        available[i].t = 0;
+        available[i].r = 0;
+        approaches[i] = NoApproach;
+    }
+    if (position.r > 0) {
+        if (position.r < MAX_R) {
+            if (position.r < (MAX_R - 1) && position.r > 1) {
+                int counter_clockwise_direction = (((((position.t + 1) % DIRECTION_COUNT) / 2) + 1) * 2) % DIRECTION_COUNT;
+                available[counter_clockwise_direction].t = 1;
+                if (available[counter_clockwise_direction].t == 1 &&
+                    ((position.t + 1) % DIRECTION_COUNT == NORTH || (position.t + 1) % DIRECTION_COUNT == SOUTH)) {
+                    available[counter_clockwise_direction].t = 2;
+                }
+                if ((position.t + available[counter_clockwise_direction].t) % 2) {
+                    approaches[counter_clockwise_direction] = FollowOnLeftUntilCrossesLine;
+                } else {
+                    approaches[counter_clockwise_direction] = FollowUntilPerpendicularLine;
+                }
+                int clockwise_direction = ((((position.t / 2) * 2) - 2) + DIRECTION_COUNT) % DIRECTION_COUNT;
+                available[clockwise_direction].t = -1;
+                if (available[clockwise_direction].t == -1 &&
+                    ((position.t - 1) % DIRECTION_COUNT == NORTH || (position.t - 1) % DIRECTION_COUNT == SOUTH)) {
+                    available[counter_clockwise_direction].t = -2;
+                }
+                if ((position.t + available[clockwise_direction].t) % 2) {
+                    approaches[counter_clockwise_direction] = FollowOnRightUntilCrossesLine;
+                } else {
+                    approaches[counter_clockwise_direction] = FollowUntilPerpendicularLine;
+                }
+            }
+            available[position.t].r = 1;
+            if (position.t % 2) {
+                approaches[position.t] = FollowUntilCrossingY;
+            }
+        }
+        int in_direction = opposite(Direction(position.t));
+        available[in_direction].r = -1;
+        if (position.t % 2) {
+            approaches[in_direction] = FollowUntilSeparatingY;
+        } else if (position.t == NORTH || position.t == SOUTH) {
+            approaches[NORTH] = NoFollowUntilPerpendicularLine;
+            approaches[SOUTH] = NoFollowUntilPerpendicularLine;
+        } else {
+            approaches[EAST] = FollowUntilPerpendicularLine;
+            approaches[WEST] = FollowUntilPerpendicularLine;
+        }
+        if (position.r == MAX_R - 1) {
+            approaches[position.t] = MoveIntoDropPosition;
+        } else if (position.r == 1) {
+            approaches[in_direction] = MoveIntoDropPosition;
+        }
+    } else {
+        for (int i = 0; i < DIRECTION_COUNT; ++i) {
+            available[i].t = i;
+            available[i].r = 1;
+        }
+    }
+}
+
+/** checks Navigation17's move table against the reference for every position and times both **/
+int testNavigation17Table() {
+    const int repetitions = 20000;
+    int failures = 0;
+    Coordinate available[DIRECTION_COUNT];
+    Approach approaches[DIRECTION_COUNT];
+
+    for (int r = 0; r <= Navigation17::MAX_R; ++r) {
+        for (int t = 0; t < DIRECTION_COUNT; ++t) {
+            navigation17Reference(Coordinate(t, r), available, approaches);
+            for (int d = 0; d < DIRECTION_COUNT; ++d) {
+                Coordinate step = Navigation17::getStep(Coordinate(t, r), Direction(d));
+                Approach approach = Navigation17::getApproach(Coordinate(t, r), Direction(d));
+                if (step.t != (available[d].t + DIRECTION_COUNT) % DIRECTION_COUNT || step.r != available[d].r ||
+                    approach != approaches[d]) {
+                    std::cout << "FAIL Navigation17 table at (" << t << ", " << r << ") " << DIRECTION_NAMES[d]
+                              << ": step (" << step.t << ", " << step.r << ") approach " << approach
+                              << ", expected (" << available[d].t << ", " << available[d].r << ") approach "
+                              << approaches[d] << std::endl;
+                    ++failures;
+                }
+            }
+        }
+    }
+
+    // per arrival: the reference works out all directions, the table is read for the one direction moved in
+    const int cells = (Navigation17::MAX_R + 1) * DIRECTION_COUNT;
+    volatile int sink = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+        Coordinate position(i % DIRECTION_COUNT, (i / DIRECTION_COUNT) % (Navigation17::MAX_R + 1));
+        navigation17Reference(position, available, approaches);
+        sink = sink + available[i % DIRECTION_COUNT].r + approaches[i % DIRECTION_COUNT];
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+        Coordinate position(i % DIRECTION_COUNT, (i / DIRECTION_COUNT) % (Navigation17::MAX_R + 1));
+        sink = sink + Navigation17::getStep(position, Direction(i % DIRECTION_COUNT)).r +
+               Navigation17::getApproach(position, Direction(i % DIRECTION_COUNT));
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "Navigation17 table: " << cells << " positions checked, " << failures << " failures" << std::endl;
+    std::cout << "Navigation17 table: " << std::chrono::duration<double, std::nano>(middle - begin).count() / repetitions
+              << " ns per arrival before, " << std::chrono::duration<double, std::nano>(end - middle).count() / repetitions
+              << " ns per move with the table, "
+              << sizeof(uint16_t) * cells * DIRECTION_COUNT << " bytes of flash" << std::endl;
+    return failures;
+}
+
+/** follow a route through the BoardTable, returns the final state (BOARD_NO_STATE if a move is invalid) **/
+uint16_t walkRoute(uint16_t state, Route& route, int& cost) {
+    cost = 0;
+    for (int i = 0; i < route.getLength() && state != BOARD_NO_STATE; ++i) {
+        cost += RoutePlanner::getMoveCost(state, route.getCommand(i));
+        state = BoardTable::getNextState(state, route.getCommand(i));
+    }
+    return state;
+}
+
+/** plans from the start state to every intersection, checks the routes and times the planner **/
+int testRoutePlanner() {
+    const int repetitions = 200;
+    int failures = 0;
+    int unreachable = 0;
+    long totalLength = 0;
+    Movement m;
+    Navigation nav(1, m);
+    Route route;
+
+    for (int i = 0; i < BOARD_INTERSECTION_COUNT; ++i) {
+        if (!nav.planRoute(i, route)) {
+            ++unreachable;
+            continue;
+        }
+        int cost;
+        uint16_t end = walkRoute(nav.getCurrentState(), route, cost);
+        if (end == BOARD_NO_STATE || BoardTable::getIntersection(end) != i || cost != route.getCost()) {
+            std::cout << "FAIL route to " << BoardTable::getIntersectionName(i) << ": " << route.toString() << std::endl;
+            ++failures;
+        }
+        totalLength += route.getLength();
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        for (int i = 0; i < BOARD_INTERSECTION_COUNT; ++i) {
+            nav.planRoute(i, route);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double plans = double(repetitions) * BOARD_INTERSECTION_COUNT;
+    double usPerPlan = std::chrono::duration<double, std::micro>(end - begin).count() / plans;
+
+    nav.planRoute("Middle drop and  0deg", route);
+    std::cout << "route to Middle drop and  0deg: " << route.toString()
+              << " (cost " << route.getCost() << ")" << std::endl;
+    std::cout << "planner: " << BOARD_INTERSECTION_COUNT << " targets, "
+              << unreachable << " unreachable, avg route length "
+              << double(totalLength) / (BOARD_INTERSECTION_COUNT - unreachable)
+              << ", " << usPerPlan << " us/plan" << std::endl;
+
+    // copies keep the position but make their own planner; the sketch assigns a new Navigation in setup
+    Navigation copy(nav);
+    Route copied;
+    copy = nav;
+    if (!copy.planRoute("Middle drop and  0deg", copied) || copied.toString() != route.toString()) {
+        std::cout << "FAIL copied navigation planned " << copied.toString() << std::endl;
+        ++failures;
+    }
+    return failures;
+}
 
+/** checks RouteTable lookups against RoutePlanner search from every state reachable from the start, and times both **/
+int testRouteTable() {
+    const int repetitions = 200;
+    int failures = 0;
+    RoutePlanner planner;
+    Route searched;
+    Route looked;
 
+    // states the robot can actually be in: everything reachable from the start state
+    std::vector<uint16_t> live;
+    std::vector<bool> seen(BOARD_STATE_COUNT, false);
+    live.push_back(BoardTable::getStartState());
+    seen[BoardTable::getStartState()] = true;
+    for (size_t i = 0; i < live.size(); ++i) {
+        for (int c = 0; c < ROUTE_COMMAND_COUNT; ++c) {
+            uint16_t next = BoardTable::getNextState(live[i], RouteCommand(c));
+            if (next != BOARD_NO_STATE && !seen[next]) {
+                seen[next] = true;
+                live.push_back(next);
+            }
+        }
+    }
+
+    for (uint16_t state : live) {
+        if (!RouteTable::getIfRoutable(state)) {
+            std::cout << "FAIL state " << state << " is reachable but not in the route table" << std::endl;
+            ++failures;
+            continue;
+        }
+        for (int t = 0; t < BOARD_INTERSECTION_COUNT; ++t) {
+            bool found = planner.planRoute(state, t, searched);
+            if (found != RouteTable::lookupRoute(state, t, looked) || looked.getCost() != searched.getCost()) {
+                std::cout << "FAIL table route from " << state << " to " << t << ": " << looked.toString()
+                          << " vs " << searched.toString() << std::endl;
+                ++failures;
+            }
+        }
+    }
+
+    // benchmark: full route search vs table lookup, and single next-hop lookups
+    auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        for (int t = 0; t < BOARD_INTERSECTION_COUNT; ++t) {
+            planner.planRoute(live[r % live.size()], t, searched);
+        }
+    }
+    auto mid = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        for (int t = 0; t < BOARD_INTERSECTION_COUNT; ++t) {
+            RouteTable::lookupRoute(live[r % live.size()], t, looked);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    volatile int sink = 0;
+    for (int r = 0; r < repetitions; ++r) {
+        for (int t = 0; t < BOARD_INTERSECTION_COUNT; ++t) {
+            sink += RouteTable::getNextCommand(live[r % live.size()], t);
+        }
+    }
+    auto hopEnd = std::chrono::steady_clock::now();
+    double routes = double(repetitions) * BOARD_INTERSECTION_COUNT;
+    std::cout << "route table: " << live.size() << " live states checked, search "
+              << std::chrono::duration<double, std::micro>(mid - begin).count() / routes << " us/route, lookup "
+              << std::chrono::duration<double, std::micro>(end - mid).count() / routes << " us/route, next hop "
+              << std::chrono::duration<double, std::nano>(hopEnd - end).count() / routes << " ns" << std::endl;
+    return failures;
+}
+
+/** Movement that records, for every forward approach, whether it was told to keep its speed **/
+class RecordingMovement : public Movement {
+public:
+    std::vector<bool> cruising;
+    // lengths of the chains performed: each one ends at the first approach that stops at its line
+    std::vector<int> chains() {
+        std::vector<int> lengths;
+        int length = 0;
+        for (bool cruise : cruising) {
+            ++length;
+            if (!cruise) {
+                lengths.push_back(length);
+                length = 0;
+            }
+        }
+        if (length > 0) {
+            lengths.push_back(-length); // a chain left cruising
+        }
+        return lengths;
+    }
+    void approachNoFollowUntilPerpendicularLine() override { cruising.push_back(getIfCruising()); }
+    void approachFollowUntilPerpendicularLine() override { cruising.push_back(getIfCruising()); }
+    void approachFollowUntilTokenSlot() override { cruising.push_back(getIfCruising()); }
+    void approachFollowOnLeftUntilPerpendicularLine() override { cruising.push_back(getIfCruising()); }
+    void approachFollowOnRightUntilPerpendicularLine() override { cruising.push_back(getIfCruising()); }
+    void approachFollowOnLeftUntilCrossesLine() override { cruising.push_back(getIfCruising()); }
+    void approachFollowOnRightUntilCrossesLine() override { cruising.push_back(getIfCruising()); }
+    void approachFollowUntilCrossingY() override { cruising.push_back(getIfCruising()); }
+    void approachFollowUntilSeparatingY() override { cruising.push_back(getIfCruising()); }
+    void approachMoveIntoStart() override { cruising.push_back(getIfCruising()); }
+    void approachMoveIntoDropPosition() override { cruising.push_back(getIfCruising()); }
+};
+
+/** drives the route to every intersection with executePlan and checks where it ends **/
+int testExecutePlan() {
+    int failures = 0;
+    int forwardMoves = 0;
+    int stops = 0;
+    RecordingMovement m;
+    Route route;
+    // Movement prints every move; keep the test output readable
+    std::streambuf* out = std::cout.rdbuf(nullptr);
+    for (int t = 0; t < BOARD_INTERSECTION_COUNT; ++t) {
+        Navigation nav(1, m);
+        if (!nav.lookupRoute(t, route)) {
+            continue;
+        }
+        int cost;
+        uint16_t start = nav.getCurrentState();
+        uint16_t expected = walkRoute(start, route, cost);
+        m.cruising.clear();
+        if (!nav.executePlan(route) || nav.getCurrentState() != expected) {
+            std::cout.rdbuf(out);
+            std::cout << "FAIL executePlan to " << BoardTable::getIntersectionName(t) << ": " << route.toString()
+                      << std::endl;
+            out = std::cout.rdbuf(nullptr);
+            ++failures;
+        }
+        // a forward run arrives as one chain, split only after a drop position or when the chain is full;
+        // every approach but the last of a chain keeps its speed
+        std::vector<int> expectedChains;
+        uint16_t state = start;
+        int runLength = 0;
+        for (int i = 0; i < route.getLength(); ++i) {
+            RouteCommand command = route.getCommand(i);
+            if (command == CommandForward) {
+                ++forwardMoves;
+                ++runLength;
+            }
+            bool drop = command == CommandForward && BoardTable::getMove(state, command) == MoveIntoDropPosition;
+            state = BoardTable::getNextState(state, command);
+            bool runEnds = i + 1 == route.getLength() || route.getCommand(i + 1) != CommandForward || drop ||
+                runLength == MOVEMENT_MAX_CHAIN;
+            if (runLength > 0 && runEnds) {
+                expectedChains.push_back(runLength);
+                ++stops;
+                runLength = 0;
+            }
+        }
+        std::vector<int> chains = m.chains();
+        if (chains != expectedChains) {
+            std::cout.rdbuf(out);
+            std::cout << "FAIL executePlan to " << BoardTable::getIntersectionName(t) << ": chains of";
+            for (int length : chains) {
+                std::cout << " " << length;
+            }
+            std::cout << ", expected";
+            for (int length : expectedChains) {
+                std::cout << " " << length;
+            }
+            std::cout << std::endl;
+            out = std::cout.rdbuf(nullptr);
+            ++failures;
+        }
+    }
+    // an invalid route is refused before moving
+    Navigation nav(1, m);
+    uint16_t start = nav.getCurrentState();
+    route.clear();
+    route.addCommand(CommandForward);
+    route.addCommand(CommandBackward);
+    route.addCommand(CommandBackward);
+    route.addCommand(CommandBackward);
+    if (nav.executePlan(route) || nav.getCurrentState() != start) {
+        std::cout.rdbuf(out);
+        std::cout << "FAIL executePlan moved on an invalid route" << std::endl;
+        out = std::cout.rdbuf(nullptr);
+        ++failures;
+    }
+    std::cout.rdbuf(out);
+    std::cout << "execute plan: " << forwardMoves << " forward moves from the start, " << stops
+              << " stops with chained approaches" << std::endl;
+    return failures;
+}
+
+/** blocks the first move of a route and checks that Navigation routes around it **/
+int testBlockedMove() {
+    int failures = 0;
+    int checked = 0;
+    Movement m;
+    // Movement prints every move; keep the test output readable
+    std::streambuf* out = std::cout.rdbuf(nullptr);
+    Route route;
+    for (int t = 0; t < BOARD_INTERSECTION_COUNT; ++t) {
+        Navigation nav(1, m);
+        if (!nav.lookupRoute(t, route) || route.getLength() == 0) {
+            continue;
+        }
+        RouteCommand first = route.getCommand(0);
+        uint16_t cost = route.getCost();
+        Route blockedRoute = route;
+        uint16_t start = nav.getCurrentState();
+        nav.blockMove(first);
+        // the blocked move is refused, on its own and as part of a route
+        bool moved = first == CommandLeft ? nav.turnLeft() : first == CommandRight ? nav.turnRight()
+            : first == CommandForward ? nav.goForward() : nav.goBackward();
+        if (moved || nav.executePlan(blockedRoute) || nav.getCurrentState() != start) {
+            std::cout.rdbuf(out);
+            std::cout << "FAIL blocked move to " << BoardTable::getIntersectionName(t) << " was driven" << std::endl;
+            out = std::cout.rdbuf(nullptr);
+            ++failures;
+        }
+        bool found = nav.lookupRoute(t, route);
+        ++checked;
+        if (found && (route.getCommand(0) == first || route.getCost() < cost)) {
+            std::cout.rdbuf(out);
+            std::cout << "FAIL route to " << BoardTable::getIntersectionName(t) << " still uses the blocked move: "
+                      << route.toString() << std::endl;
+            out = std::cout.rdbuf(nullptr);
+            ++failures;
+        }
+    }
+    std::cout.rdbuf(out);
+    std::cout << "blocked moves: " << checked << " routes replanned around their first move" << std::endl;
+    return failures;
+}
+
+/** id of a pointer-graph state, BOARD_NO_STATE for nullptr **/
+uint16_t stateId(IntersectionState* state) {
+    return state ? state->getId() : BOARD_NO_STATE;
+}
+
+/** checks that the BoardTable matches the Gameboard pointer graph for rounds 1-4 **/
+int testBoardTable() {
+    int failures = 0;
+    Movement m;
+    for (int round = 1; round <= 4; ++round) {
+        Gameboard board(round, &m);
+        if (board.getStateCount() != BOARD_STATE_COUNT || stateId(board.getStartState()) != BoardTable::getStartState()) {
+            std::cout << "FAIL board size/start state, round " << round << std::endl;
+            ++failures;
+            continue;
+        }
+        for (int id = 0; id < BOARD_STATE_COUNT; ++id) {
+            IntersectionState* s = board.getState(id);
+            uint16_t next[ROUTE_COMMAND_COUNT] = {
+                stateId(s->getLeftState()), stateId(s->getRightState()),
+                stateId(s->peekForward()), stateId(s->peekBackward())
+            };
+            uint8_t move[ROUTE_COMMAND_COUNT] = {
+                uint8_t(next[CommandLeft] == BOARD_NO_STATE ? 0 : s->getLeftTurn()),
+                uint8_t(next[CommandRight] == BOARD_NO_STATE ? 0 : s->getRightTurn()),
+                uint8_t(s->getForwardApproach()), uint8_t(s->getBackwardApproach())
+            };
+            for (int c = 0; c < ROUTE_COMMAND_COUNT; ++c) {
+                if (next[c] != BoardTable::getNextState(id, RouteCommand(c)) ||
+                    move[c] != BoardTable::getMove(id, RouteCommand(c))) {
+                    std::cout << "FAIL state " << id << " command " << c << ", round " << round << std::endl;
+                    ++failures;
+                }
+            }
+            if (s->getName() != BoardTable::getStateName(id)) {
+                std::cout << "FAIL state name " << id << std::endl;
+                ++failures;
+            }
+        }
+        for (int i = 0; i < BOARD_INTERSECTION_COUNT; ++i) {
+            Intersection* intersection = board.getIntersection(i);
+            if (intersection->getIfToken() != BoardTable::getIfToken(i, round) ||
+                intersection->getName() != BoardTable::getIntersectionName(i) ||
+                BoardTable::findIntersection(intersection->getName()) != i) {
+                std::cout << "FAIL intersection " << i << ", round " << round << std::endl;
+                ++failures;
+            }
+        }
+    }
+    std::cout << "board table: " << BOARD_STATE_COUNT << " states checked for rounds 1-4, "
+              << sizeof(BoardStateEntry) * BOARD_STATE_COUNT << " bytes of flash" << std::endl;
+    return failures;
+}
+
+/** checks that names live in flash only and reports the SRAM they used to take on the board **/
+int testNameStorage() {
+    int failures = 0;
+    Movement m;
+    allocationCount = 0;
+    countAllocations = true;
+    Gameboard board(1, &m);
+    countAllocations = false;
+    // only the graph itself: every intersection, its four state pairs and eight states
+    long graphAllocations = long(board.getIntersectionCount()) * (1 + 4 + INTERSECTION_STATE_COUNT);
+    if (allocationCount != graphAllocations) {
+        std::cout << "FAIL gameboard made " << allocationCount << " allocations, expected " << graphAllocations << std::endl;
+        ++failures;
+    }
+
+    char buffer[64];
+    IntersectionState* state = board.getIntersection(6)->getState(5);
+    size_t length = state->formatFullName(buffer, sizeof(buffer));
+    if (std::string(buffer) != "Intersection |1ft and 0deg| in state C[F]" || length != std::strlen(buffer)) {
+        std::cout << "FAIL full name: " << buffer << std::endl;
+        ++failures;
+    }
+    // truncated names still end in a terminator inside the buffer
+    for (size_t size = 1; size < sizeof(buffer); ++size) {
+        std::memset(buffer, 'x', sizeof(buffer));
+        length = state->formatFullName(buffer, size);
+        if (length != std::strlen(buffer) || length >= size ||
+            std::string("Intersection |1ft and 0deg| in state C[F]").compare(0, length, buffer) != 0) {
+            std::cout << "FAIL full name truncated to " << size << ": " << buffer << std::endl;
+            ++failures;
+        }
+    }
+
+    // the flash table formats the same names without the graph
+    uint16_t tableState = 6 * BOARD_STATES_PER_INTERSECTION + 5;
+    std::string tableName = std::string(BoardTable::getIntersectionName(6).c_str()) + " " +
+                            BoardTable::getStateName(tableState).c_str();
+    if (tableName != "1ft and 0deg C[F]") {
+        std::cout << "FAIL table name: " << tableName << std::endl;
+        ++failures;
+    }
+    for (size_t size = 1; size < BOARD_NAME_LENGTH; ++size) {
+        std::memset(buffer, 'x', sizeof(buffer));
+        length = BoardTable::formatIntersectionName(6, buffer, size);
+        if (length != std::strlen(buffer) || length >= size || std::string("1ft and 0deg").compare(0, length, buffer) != 0) {
+            std::cout << "FAIL table name truncated to " << size << ": " << buffer << std::endl;
+            ++failures;
+        }
+        std::memset(buffer, 'x', sizeof(buffer));
+        length = BoardTable::formatStateName(tableState, buffer, size);
+        if (length != std::strlen(buffer) || length >= size || std::string("C[F]").compare(0, length, buffer) != 0) {
+            std::cout << "FAIL table state name truncated to " << size << ": " << buffer << std::endl;
+            ++failures;
+        }
+    }
+    if (BoardTable::formatIntersectionName(BOARD_NO_INTERSECTION, buffer, sizeof(buffer)) != 0 || buffer[0] != '\0') {
+        std::cout << "FAIL name of a missing intersection: " << buffer << std::endl;
+        ++failures;
+    }
+    return failures;
+}
+
+int main() {
+    testNavigation17();
+    int failures = testNavigation17Table();
+    failures += testBoardTable();
+    failures += testRoutePlanner();
+    failures += testRouteTable();
+    failures += testExecutePlan();
+    failures += testBlockedMove();
+    failures += testNameStorage();
 
-    return 0;
+    return failures ? 1 : 0;
 }
@@ -0,0 +1,142 @@
+// compares IncrementalPlanner repairs with full replans while random moves of the board fail
+// usage: Replan_Benchmark [trials] [seed]
+// every trial drives from a random state toward a random intersection; before each move, the move the
+// robot is about to make fails with some probability, and unrelated moves elsewhere fail as well.
+// each failure is repaired incrementally and also planned from scratch; the costs have to match.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "BoardTable.h"
+#include "IncrementalPlanner.h"
+#include "RoutePlanner.h"
+
+const double ROUTE_FAILURE = 0.25; // chance the next move of the route fails
+const double OTHER_FAILURE = 0.5;  // chance some other move on the board fails at the same time
+
+int main(int argc, char** argv) {
+    int trials = argc > 1 ? std::atoi(argv[1]) : 500;
+    unsigned seed = argc > 2 ? unsigned(std::atoi(argv[2])) : 1;
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+    // states the robot can be in
+    std::vector<uint16_t> live(1, BoardTable::getStartState());
+    std::vector<bool> seen(BOARD_STATE_COUNT, false);
+    seen[live[0]] = true;
+    for (size_t i = 0; i < live.size(); ++i) {
+        for (int c = 0; c < ROUTE_COMMAND_COUNT; ++c) {
+            uint16_t next = BoardTable::getNextState(live[i], RouteCommand(c));
+            if (next != BOARD_NO_STATE && !seen[next]) {
+                seen[next] = true;
+                live.push_back(next);
+            }
+        }
+    }
+
+    IncrementalPlanner repairer;
+    IncrementalPlanner fresh;
+    RoutePlanner planner;
+    Route route;
+    Route freshRoute;
+    Route searched;
+    int failures = 0;
+    long repairs = 0;
+    long cutOff = 0;
+    long repairExpanded = 0;
+    long fullExpanded = 0;
+    double repairSeconds = 0;
+    double fullSeconds = 0;
+
+    for (int trial = 0; trial < trials; ++trial) {
+        uint16_t state = live[random() % live.size()];
+        uint8_t target = random() % BOARD_INTERSECTION_COUNT;
+        repairer.clearBlocked();
+        repairer.setTarget(target);
+        repairer.setStart(state);
+        bool found = repairer.planRoute(route);
+        // without failures the result has to match the plain search
+        if (found != planner.planRoute(state, target, searched) || (found && route.getCost() != searched.getCost())) {
+            std::printf("FAIL trial %d: initial cost %d, search cost %d\n", trial, route.getCost(), searched.getCost());
+            ++failures;
+        }
+        if (!found) {
+            continue;
+        }
+
+        std::vector<std::pair<uint16_t, RouteCommand> > blocked;
+        while (route.getLength() > 0) {
+            bool failed = false;
+            if (chance(random) < ROUTE_FAILURE) {
+                blocked.push_back(std::make_pair(state, route.getCommand(0)));
+                repairer.blockEdge(state, route.getCommand(0));
+                failed = true;
+            }
+            if (chance(random) < OTHER_FAILURE) {
+                uint16_t other = live[random() % live.size()];
+                RouteCommand command = RouteCommand(random() % ROUTE_COMMAND_COUNT);
+                if (BoardTable::getNextState(other, command) != BOARD_NO_STATE) {
+                    blocked.push_back(std::make_pair(other, command));
+                    repairer.blockEdge(other, command);
+                }
+            }
+
+            auto begin = std::chrono::steady_clock::now();
+            found = repairer.planRoute(route);
+            auto end = std::chrono::steady_clock::now();
+            if (failed) {
+                ++repairs;
+                repairExpanded += repairer.getExpandedCount();
+                repairSeconds += std::chrono::duration<double>(end - begin).count();
+
+                fresh.clearBlocked();
+                for (auto& edge : blocked) {
+                    fresh.blockEdge(edge.first, edge.second);
+                }
+                fresh.setStart(state);
+                begin = std::chrono::steady_clock::now();
+                fresh.setTarget(target);
+                bool freshFound = fresh.planRoute(freshRoute);
+                end = std::chrono::steady_clock::now();
+                fullExpanded += fresh.getExpandedCount();
+                fullSeconds += std::chrono::duration<double>(end - begin).count();
+                if (found != freshFound || (found && route.getCost() != freshRoute.getCost())) {
+                    std::printf("FAIL trial %d: repaired cost %d, full replan cost %d\n", trial,
+                                found ? route.getCost() : -1, freshFound ? freshRoute.getCost() : -1);
+                    ++failures;
+                }
+            }
+            if (!found) {
+                ++cutOff;
+                break;
+            }
+            if (route.getLength() == 0) {
+                break;
+            }
+            // make the first move of the (repaired) route
+            RouteCommand command = route.getCommand(0);
+            if (repairer.getIfBlocked(state, command)) {
+                std::printf("FAIL trial %d: route uses a blocked move\n", trial);
+                ++failures;
+                break;
+            }
+            state = BoardTable::getNextState(state, command);
+            repairer.setStart(state);
+            repairer.planRoute(route);
+        }
+    }
+
+    std::printf("%d trials, %ld repairs (%ld left the target unreachable)\n", trials, repairs, cutOff);
+    if (repairs > 0) {
+        std::printf("repair:      %.1f states expanded, %.2f us per repair\n",
+                    double(repairExpanded) / repairs, repairSeconds * 1e6 / repairs);
+        std::printf("full replan: %.1f states expanded, %.2f us per replan\n",
+                    double(fullExpanded) / repairs, fullSeconds * 1e6 / repairs);
+    }
+    std::printf("%d failures\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+// generates RouteTableData.h: next-hop commands for every (state, target intersection) pair
+// usage: RouteTable_Generator > libraries/Navigation/RouteTableData.h
+// (copy the result to competition-code/libraries/Navigation as well)
+// a size report is written to stderr
+
+#include <cstdio>
+#include <map>
+#include <vector>
+
+#include "BoardTable.h"
+#include "RoutePlanner.h"
+#include "RouteTable.h"
+
+const int INF = 1 << 28;
+
+int main() {
+    const int n = BOARD_STATE_COUNT;
+    // Floyd-Warshall over the state graph, keeping the first command of each shortest path
+    std::vector<int> dist(n * n, INF);
+    std::vector<int> first(n * n, -1);
+    for (int i = 0; i < n; ++i) {
+        dist[i * n + i] = 0;
+        for (int c = 0; c < ROUTE_COMMAND_COUNT; ++c) {
+            int j = BoardTable::getNextState(i, RouteCommand(c));
+            if (j == BOARD_NO_STATE) {
+                continue;
+            }
+            int cost = RoutePlanner::getMoveCost(i, RouteCommand(c));
+            if (cost < dist[i * n + j]) {
+                dist[i * n + j] = cost;
+                first[i * n + j] = c;
+            }
+        }
+    }
+    for (int k = 0; k < n; ++k) {
+        for (int i = 0; i < n; ++i) {
+            int ik = dist[i * n + k];
+            if (ik == INF) {
+                continue;
+            }
+            for (int j = 0; j < n; ++j) {
+                if (ik + dist[k * n + j] < dist[i * n + j]) {
+                    dist[i * n + j] = ik + dist[k * n + j];
+                    first[i * n + j] = first[i * n + k];
+                }
+            }
+        }
+    }
+
+    // one row per state: 2-bit command per target intersection; states already at the target,
+    // or that cannot reach it, get command 0 and rely on the reachable bit
+    std::vector<std::vector<uint8_t> > rows;
+    std::map<std::vector<uint8_t>, int> rowIndex;
+    std::vector<int> stateRow(n);
+    std::vector<int> reachable(n, 1);
+    for (int i = 0; i < n; ++i) {
+        std::vector<uint8_t> row(ROUTE_TABLE_ROW_BYTES, 0);
+        for (int t = 0; t < BOARD_INTERSECTION_COUNT; ++t) {
+            int best = INF;
+            int command = 0;
+            for (int slot = 0; slot < BOARD_STATES_PER_INTERSECTION; ++slot) {
+                int j = t * BOARD_STATES_PER_INTERSECTION + slot;
+                if (dist[i * n + j] < best) {
+                    best = dist[i * n + j];
+                    command = (i == j) ? 0 : first[i * n + j];
+                }
+            }
+            if (best == INF) {
+                reachable[i] = 0;
+                command = 0;
+            }
+            row[t / 4] |= command << ((t % 4) * 2);
+        }
+        // identical rows are stored once
+        auto found = rowIndex.find(row);
+        if (found == rowIndex.end()) {
+            found = rowIndex.insert(std::make_pair(row, int(rows.size()))).first;
+            rows.push_back(row);
+        }
+        stateRow[i] = found->second;
+    }
+    if (rows.size() > ROUTE_TABLE_NO_ROW) {
+        std::fprintf(stderr, "too many distinct rows for uint8_t row index: %d\n", int(rows.size()));
+        return 1;
+    }
+
+    std::printf("// generated by RouteTable_Generator (navigation-test/route_table_gen.cpp) - do not edit\n");
+    std::printf("#ifndef ROUTETABLEDATA_H\n#define ROUTETABLEDATA_H\n\n#include \"RouteTable.h\"\n\n");
+    std::printf("#define ROUTE_TABLE_ROWS %d\n\n", int(rows.size()));
+    std::printf("// row of ROUTE_TABLE_COMMANDS for each state, ROUTE_TABLE_NO_ROW if the state cannot reach every intersection\n");
+    std::printf("static const uint8_t ROUTE_TABLE_STATE_ROWS[BOARD_STATE_COUNT] PROGMEM = {\n");
+    int routable = 0;
+    for (int i = 0; i < n; ++i) {
+        int row = reachable[i] ? stateRow[i] : ROUTE_TABLE_NO_ROW;
+        routable += reachable[i];
+        std::printf("%s%3d,%s", (i % 16 == 0) ? "\t" : "", row, (i % 16 == 15) ? "\n" : " ");
+    }
+    std::printf("%s};\n\n", (n % 16) ? "\n" : "");
+    std::printf("// first command toward each target intersection, 2 bits per target (RouteCommand values)\n");
+    std::printf("static const uint8_t ROUTE_TABLE_COMMANDS[ROUTE_TABLE_ROWS][ROUTE_TABLE_ROW_BYTES] PROGMEM = {\n");
+    for (size_t r = 0; r < rows.size(); ++r) {
+        std::printf("\t{");
+        for (int b = 0; b < ROUTE_TABLE_ROW_BYTES; ++b) {
+            std::printf(" 0x%02X%s", rows[r][b], (b == ROUTE_TABLE_ROW_BYTES - 1) ? " " : ",");
+        }
+        std::printf("},\n");
+    }
+    std::printf("};\n\n#endif\n");
+
+    // size report
+    int packedBytes = n + int(rows.size()) * ROUTE_TABLE_ROW_BYTES;
+    std::fprintf(stderr, "route table: %d states (%d can reach every intersection), %d distinct rows\n",
+                 n, routable, int(rows.size()));
+    std::fprintf(stderr, "route table: %d bytes of flash (uncompressed one byte per entry: %d bytes)\n",
+                 packedBytes, n * BOARD_INTERSECTION_COUNT);
+    return 0;
+}
@@ -0,0 +1,1540 @@
+// host tests for the ScrapController motor control, run against a simulated DC motor
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "ScrapController.h"
+
+const long SIM_STEP = 100; // plant integration step (us)
+
+/** first order DC motor with a deadband: speed in encoder counts per second **/
+struct MotorPlant {
+    double gain = 8.0;      // counts/s per PWM above the deadband
+    double deadband = 30.0; // PWM that only overcomes friction
+    double tau = 0.08;      // time constant (s)
+    double speed = 0;
+    double position = 0;
+    bool stalled = false;
+
+    void step(int power, int direction, double seconds) {
+        double drive = power > deadband ? (power - deadband) * gain : 0;
+        double target = stalled ? 0 : drive * direction;
+        speed += (target - speed) * seconds / tau;
+        position += speed * seconds;
+    }
+};
+
+class SimMotor : public ScrapMotorInterface {
+protected:
+    virtual void initMotor() {}
+public:
+    SimMotor() { currPower = 0; currDir = 0; powerMultiplier = 1; }
+    virtual void setMotor(int pwm) { setDirection(pwm); setPower(abs(pwm)); }
+    virtual void setDirection(int pwm) { currDir = pwm > 0 ? 1 : (pwm < 0 ? -1 : 0); }
+    virtual void setDirectionMultiplier(int multi) { powerMultiplier = multi; }
+    virtual void setPower(int pwm) { currPower = max(0, min(255, pwm)); }
+    virtual void incrementPower(int val) { setPower(currPower + val); }
+    virtual void decrementPower(int val) { setPower(currPower - val); }
+    virtual int getDirection() { return currDir; }
+    virtual int getPower() { return currPower; }
+    virtual void stop() { setMotor(0); }
+};
+
+class SimEncoder : public ScrapEncoderInterface {
+protected:
+    virtual void initEncoder() {}
+public:
+    SimEncoder() { encCount = 0; }
+    virtual long getCount() { return encCount; }
+    virtual void resetCount() { encCount = 0; markCountSet(); }
+    virtual void setCount(long newCount) { encCount = newCount; markCountSet(); }
+    virtual void incrementCount() { encCount++; }
+    virtual void decrementCount() { encCount--; }
+    virtual void checkEncoder() {}
+    virtual void checkEncoderFlipped() {}
+    // what the encoder interrupt does on an edge
+    void edge(int step) { encCount += step; markEdge(); }
+
+    // the wheel moved from the last position to position (counts) by now; each edge is recorded
+    // at the time the wheel crossed it, as if the wheel moved at a steady speed in between
+    double lastPosition = 0;
+    unsigned long lastTime = 0;
+    void moveTo(double position) {
+        unsigned long now = simulatedMicros();
+        if (lastTime == 0) {
+            lastTime = now;
+        }
+        long to = long(std::floor(position));
+        int step = to > encCount ? 1 : -1;
+        while (encCount != to) {
+            double boundary = step > 0 ? encCount + 1 : encCount;
+            simulatedMicros() = lastTime + (unsigned long)((boundary - lastPosition) / (position - lastPosition) * (now - lastTime));
+            edge(step);
+        }
+        simulatedMicros() = now;
+        lastPosition = position;
+        lastTime = now;
+    }
+};
+
+/** the mapFloat stepping ScrapMotorControl used before the PID loop, kept for comparison **/
+class LegacyMotorControl {
+private:
+    unsigned long prevTime = 0;
+    float prevSpeed = 0.0;
+    float speedGoal = 0.0;
+    long prevCount = 0;
+    int minPower = 0;
+    ScrapMotorInterface* motor;
+    ScrapEncoderInterface* encoder;
+
+    float calcSpeed() {
+        unsigned long newTime = micros();
+        long newCount = encoder->getCount();
+        float currSpeed = 0;
+        if (prevTime == 0)
+            prevTime = newTime;
+        unsigned long timeDelta = newTime - prevTime;
+        if (timeDelta != 0) {
+            currSpeed = 1000000 * (float(abs(newCount - prevCount)) / float(timeDelta));
+        }
+        else {
+            currSpeed = prevSpeed;
+        }
+        prevTime = newTime;
+        prevCount = newCount;
+        prevSpeed = currSpeed;
+        return currSpeed;
+    }
+    float mapFloat(float x, float in_min, float in_max, float out_min, float out_max) {
+        return (constrainFloat(x, in_min, in_max) - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+    }
+    float constrainFloat(float x, float low, float high) {
+        return x < low ? low : (x > high ? high : x);
+    }
+
+public:
+    LegacyMotorControl(ScrapMotorInterface& mot, ScrapEncoderInterface& enc) : motor(&mot), encoder(&enc) {}
+    void setMinPower(int power) { minPower = power; }
+    void setControl(float newSpeed) { motor->setDirection(newSpeed < 0 ? -1 : 1); speedGoal = std::fabs(newSpeed); }
+    void performMovement() {
+        float currSpeed = calcSpeed();
+        int powChange = 0;
+        if (currSpeed < speedGoal) {
+            powChange = currSpeed != 0 ? (int)mapFloat(speedGoal / currSpeed, 1.0, 2.0, 1.0, 6.0) : 6;
+            motor->setPower(max(minPower, motor->getPower() + powChange));
+        }
+        else if (currSpeed > speedGoal) {
+            powChange = currSpeed != 0 ? (int)mapFloat(currSpeed / speedGoal, 1.0, 2.0, 1.0, 6.0) : 6;
+            motor->setPower(max(minPower, motor->getPower() - powChange));
+        }
+    }
+};
+
+/** the speed estimate and PID law of ScrapMotorControl in floating point, optionally without anti-windup **/
+template <bool AntiWindup>
+class FloatPidControl {
+private:
+    unsigned long prevTime = 0;
+    unsigned long prevInterval = 0;
+    unsigned long prevEdgeTime = 0;
+    long prevEdgeCount = 0;
+    double prevSpeed = 0;
+    long prevCount = 0;
+    double speedGoal = 0;
+    double integral = 0;
+    int minPower = 0;
+    ScrapMotorInterface* motor;
+    ScrapEncoderInterface* encoder;
+
+public:
+    FloatPidControl(ScrapMotorInterface& mot, ScrapEncoderInterface& enc) : motor(&mot), encoder(&enc) {}
+    void setMinPower(int power) { minPower = power; }
+    void setControl(float newSpeed) { motor->setDirection(newSpeed < 0 ? -1 : 1); speedGoal = std::fabs(newSpeed); }
+    double measureSpeed(const ScrapEncoderSnapshot& snapshot, long& edgeCount, unsigned long& edgeTime) {
+        long counts = std::labs(snapshot.count - prevCount);
+        long spanCount;
+        unsigned long spanTime;
+        edgeCount = snapshot.count;
+        edgeTime = snapshot.edgeTime;
+        if (prevInterval == 0) {
+            return prevSpeed;
+        }
+        if (counts >= SCRAPMOTORCONTROL_SPANEDGES) {
+            for (uint8_t back = 0; back < SCRAPMOTORCONTROL_SPANEDGES; ++back) {
+                if (encoder->getEdge(back, spanCount, spanTime) && spanCount != prevEdgeCount &&
+                    (spanCount - prevEdgeCount) % SCRAPMOTORCONTROL_SPANEDGES == 0) {
+                    edgeCount = spanCount;
+                    edgeTime = spanTime;
+                    break;
+                }
+            }
+            return std::labs(edgeCount - prevEdgeCount) * 1e6 / (edgeTime - prevEdgeTime);
+        }
+        if (counts > 0) {
+            if (encoder->getEdge(SCRAPMOTORCONTROL_SPANEDGES, spanCount, spanTime) &&
+                std::labs(snapshot.count - spanCount) == SCRAPMOTORCONTROL_SPANEDGES) {
+                return SCRAPMOTORCONTROL_SPANEDGES * 1e6 / (snapshot.edgeTime - spanTime);
+            }
+            return counts * 1e6 / (snapshot.edgeTime - prevEdgeTime);
+        }
+        unsigned long sinceEdge = snapshot.time - snapshot.edgeTime;
+        if (snapshot.edgeTime == 0 || sinceEdge > SCRAPMOTORCONTROL_STOPTIME) {
+            return 0;
+        }
+        return std::min(prevSpeed, 1e6 / sinceEdge);
+    }
+    void performMovement() {
+        ScrapEncoderSnapshot snapshot;
+        encoder->getSnapshot(snapshot);
+        if (prevTime == 0) {
+            prevTime = snapshot.time;
+            prevCount = snapshot.count;
+            prevEdgeCount = snapshot.count;
+            prevEdgeTime = snapshot.edgeTime;
+        }
+        prevInterval = snapshot.time - prevTime;
+        double lastSpeed = prevSpeed;
+        long edgeCount;
+        unsigned long edgeTime;
+        double speed = measureSpeed(snapshot, edgeCount, edgeTime);
+        prevTime = snapshot.time;
+        prevCount = snapshot.count;
+        prevEdgeCount = edgeCount;
+        prevEdgeTime = edgeTime;
+        prevSpeed = speed;
+        double error = speedGoal - speed;
+        double dt = std::min<double>(prevInterval, SCRAPMOTORCONTROL_MAXINTERVAL) / 1e6;
+        double low = minPower;
+        double high = SCRAPMOTORCONTROL_MAXPOWER;
+        double proportional = SCRAPMOTORCONTROL_KP * error;
+        double derivative = SCRAPMOTORCONTROL_KD * (lastSpeed - speed);
+        double newIntegral = std::max(-high, std::min(high, integral + SCRAPMOTORCONTROL_KI * error * dt));
+        double power = proportional + newIntegral + derivative;
+        if (!AntiWindup || (!(power > high && error > 0) && !(power < low && error < 0))) {
+            integral = newIntegral;
+        }
+        power = std::max(low, std::min(high, proportional + integral + derivative));
+        motor->setPower(int(std::floor(power + 0.5)));
+    }
+};
+
+struct StepResult {
+    std::vector<double> speed; // plant speed every millisecond
+    double riseTime = -1;      // seconds from 10% to 90% of the goal
+    double settleTime = -1;    // seconds until the speed stays within 5% of the goal
+    double overshoot = 0;      // fraction of the goal
+    double finalError = 0;     // mean error over the last 200 ms, fraction of the goal
+};
+
+/**
+runs a controller toward goal for duration us; it is called every period us plus up to jitter us.
+stallUntil holds the wheel still until that time (us) to wind up the integral
+**/
+template <class Control>
+StepResult runStep(double goal, long period, long jitter, long duration, long stallUntil = 0) {
+    SimMotor motor;
+    SimEncoder encoder;
+    MotorPlant plant;
+    Control controller(motor, encoder);
+    controller.setMinPower(35);
+    useSimulatedTime() = true;
+    simulatedMicros() = 1000;
+    unsigned long start = simulatedMicros();
+    unsigned long nextControl = start;
+    unsigned random = 1;
+    StepResult result;
+    controller.setControl(goal);
+    for (long t = 0; t <= duration; t += SIM_STEP) {
+        simulatedMicros() = start + t;
+        if (simulatedMicros() >= nextControl) {
+            controller.performMovement();
+            random = random * 1103515245u + 12345u;
+            nextControl += period + (jitter ? long((random >> 8) % jitter) : 0);
+        }
+        plant.stalled = t < stallUntil;
+        plant.step(motor.getPower(), motor.getDirection(), SIM_STEP / 1e6);
+        simulatedMicros() = start + t + SIM_STEP;
+        encoder.moveTo(plant.position);
+        if (t % 1000 == 0) {
+            result.speed.push_back(plant.speed);
+        }
+    }
+    useSimulatedTime() = false;
+
+    // measured from the end of the stall
+    size_t first = size_t(stallUntil / 1000);
+    double rise10 = -1;
+    for (size_t i = first; i < result.speed.size(); ++i) {
+        double s = result.speed[i];
+        if (rise10 < 0 && s >= 0.1 * goal) rise10 = (i - first) / 1000.0;
+        if (result.riseTime < 0 && s >= 0.9 * goal) result.riseTime = (i - first) / 1000.0 - rise10;
+        result.overshoot = std::max(result.overshoot, (s - goal) / goal);
+        if (std::fabs(s - goal) > 0.05 * goal) result.settleTime = (i + 1 - first) / 1000.0;
+    }
+    double sum = 0;
+    for (size_t i = result.speed.size() - 200; i < result.speed.size(); ++i) {
+        sum += result.speed[i] - goal;
+    }
+    result.finalError = sum / 200 / goal;
+    return result;
+}
+
+void printStep(const char* name, const StepResult& r) {
+    std::printf("  %-26s rise %5.3f s, settle %5.3f s, overshoot %5.1f%%, final error %5.2f%%\n",
+                name, r.riseTime, r.settleTime, r.overshoot * 100, r.finalError * 100);
+}
+
+/** microseconds per performMovement call on this machine **/
+template <class Control>
+double timeUpdates() {
+    SimMotor motor;
+    SimEncoder encoder;
+    Control controller(motor, encoder);
+    controller.setMinPower(35);
+    controller.setControl(1200);
+    useSimulatedTime() = true;
+    const int calls = 200000;
+    double position = 0.5;
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; ++i) {
+        simulatedMicros() = 1000 + 2000UL * i;
+        position += 2 + i % 3;
+        encoder.moveTo(position);
+        controller.performMovement();
+    }
+    auto end = std::chrono::steady_clock::now();
+    useSimulatedTime() = false;
+    return std::chrono::duration<double, std::micro>(end - begin).count() / calls;
+}
+
+/** exposes the speed estimate of ScrapMotorControl **/
+class SpeedProbe : public ScrapMotorControl {
+public:
+    SpeedProbe(ScrapMotorInterface& mot, ScrapEncoderInterface& enc) : ScrapMotorControl(mot, enc) {}
+    long measure() { return calcSpeed(); }
+};
+
+struct EstimateResult {
+    double meanError = 0; // mean of estimate - speed, counts/s
+    double noise = 0;     // standard deviation of the estimate, counts/s
+    double legacyMeanError = 0;
+    double legacyNoise = 0;
+};
+
+/**
+reads the speed every period us while the wheel turns at speed counts/s; the channels are out of
+phase, so the four edges of a quadrature cycle are unevenly spaced
+**/
+EstimateResult measureEstimate(double speed, long period) {
+    static const double phase[4] = { 0, 0.2, 0, -0.15 }; // edge position errors, counts
+    SimMotor motor;
+    SimEncoder encoder;
+    SpeedProbe probe(motor, encoder);
+    useSimulatedTime() = true;
+    const unsigned long start = 1000;
+    const long duration = 2000000;
+    long edge = 1;
+    long legacyCount = 0;
+    std::vector<double> estimates;
+    std::vector<double> legacy;
+    for (long t = 0; t <= duration; t += period) {
+        // every edge up to now, at its own time
+        while (true) {
+            unsigned long at = start + (unsigned long)((edge + phase[edge & 3]) / speed * 1e6);
+            if (at > start + t) {
+                break;
+            }
+            simulatedMicros() = at;
+            encoder.edge(1);
+            ++edge;
+        }
+        simulatedMicros() = start + t;
+        long estimate = probe.measure();
+        long count = encoder.getCount();
+        // skip the first 200 ms
+        if (t >= 200000) {
+            estimates.push_back(estimate);
+            legacy.push_back((count - legacyCount) * 1e6 / period);
+        }
+        legacyCount = count;
+    }
+    useSimulatedTime() = false;
+    EstimateResult result;
+    for (int pass = 0; pass < 2; ++pass) {
+        const std::vector<double>& values = pass ? legacy : estimates;
+        double sum = 0;
+        double squares = 0;
+        for (double v : values) {
+            sum += v;
+            squares += v * v;
+        }
+        double mean = sum / values.size();
+        double noise = std::sqrt(std::max(0.0, squares / values.size() - mean * mean));
+        (pass ? result.legacyMeanError : result.meanError) = mean - speed;
+        (pass ? result.legacyNoise : result.noise) = noise;
+    }
+    return result;
+}
+
+/** checks the M/T speed estimate against counts per update, and how fast it sees a stop **/
+int testSpeedEstimate() {
+    int failures = 0;
+    const double speeds[] = { 60, 300, 1200, 3600 };
+    const long periods[] = { 1000, 4000 };
+    std::printf("speed estimate, noise (standard deviation) and bias in counts/s:\n");
+    for (long period : periods) {
+        for (double speed : speeds) {
+            EstimateResult r = measureEstimate(speed, period);
+            std::printf("  %4.0f counts/s every %4ld us: edge times %5.1f, %5.1f; counts per update %5.1f, %5.1f\n",
+                        speed, period, r.noise, r.meanError, r.legacyNoise, r.legacyMeanError);
+            if (r.noise > 0.05 * speed + 2 || std::fabs(r.meanError) > 0.02 * speed + 1 || r.noise > r.legacyNoise) {
+                std::printf("FAIL speed estimate at %.0f counts/s every %ld us\n", speed, period);
+                ++failures;
+            }
+        }
+    }
+
+    // a wheel that stops reads as slowing down right away and as stopped after SCRAPMOTORCONTROL_STOPTIME
+    SimMotor motor;
+    SimEncoder encoder;
+    SpeedProbe probe(motor, encoder);
+    useSimulatedTime() = true;
+    simulatedMicros() = 1000;
+    probe.measure();
+    for (int i = 0; i < 200; ++i) {
+        simulatedMicros() += 1000;
+        encoder.edge(1);
+        probe.measure();
+    }
+    unsigned long stopped = simulatedMicros();
+    long halfway = 0;
+    long zeroAt = -1;
+    for (int i = 1; i <= 200; ++i) {
+        simulatedMicros() = stopped + i * 1000;
+        long estimate = probe.measure();
+        if (i == 4) {
+            halfway = estimate;
+        }
+        if (zeroAt < 0 && estimate == 0) {
+            zeroAt = i * 1000;
+        }
+    }
+    useSimulatedTime() = false;
+    std::printf("  stop from 1000 counts/s: %ld counts/s after 4 ms, 0 after %ld ms\n", halfway, zeroAt / 1000);
+    if (halfway > 250 || zeroAt < 0 || zeroAt > SCRAPMOTORCONTROL_STOPTIME + 1000) {
+        std::printf("FAIL speed estimate after a stop\n");
+        ++failures;
+    }
+    return failures;
+}
+
+/** checks the Q16.16 PID against the float model and its behavior at different loop rates **/
+int testSpeedPid() {
+    int failures = 0;
+    const double goal = 1200;
+    const long duration = 1500000;
+    StepResult fixed2 = runStep<ScrapMotorControl>(goal, 2000, 0, duration);
+    StepResult float2 = runStep<FloatPidControl<true> >(goal, 2000, 0, duration);
+    StepResult fixedJitter = runStep<ScrapMotorControl>(goal, 2000, 8000, duration);
+    StepResult fixed10 = runStep<ScrapMotorControl>(goal, 10000, 0, duration);
+    StepResult legacy2 = runStep<LegacyMotorControl>(goal, 2000, 0, duration);
+    StepResult legacy10 = runStep<LegacyMotorControl>(goal, 10000, 0, duration);
+    StepResult stalled = runStep<ScrapMotorControl>(goal, 2000, 0, duration + 1000000, 1000000);
+    StepResult windup = runStep<FloatPidControl<false> >(goal, 2000, 0, duration + 1000000, 1000000);
+
+    std::printf("speed step to %.0f counts/s:\n", goal);
+    printStep("fixed PID, 2 ms", fixed2);
+    printStep("float PID, 2 ms", float2);
+    printStep("fixed PID, 2-10 ms", fixedJitter);
+    printStep("fixed PID, 10 ms", fixed10);
+    printStep("fixed PID, 1 s stall", stalled);
+    printStep("no anti-windup, 1 s stall", windup);
+    printStep("mapFloat stepping, 2 ms", legacy2);
+    printStep("mapFloat stepping, 10 ms", legacy10);
+
+    // fixed point follows the float model closely
+    double worst = 0;
+    for (size_t i = 0; i < fixed2.speed.size(); ++i) {
+        worst = std::max(worst, std::fabs(fixed2.speed[i] - float2.speed[i]));
+    }
+    std::printf("  fixed vs float: largest speed difference %.1f counts/s\n", worst);
+    if (worst > 0.02 * goal) {
+        std::printf("FAIL fixed point PID differs from the float model by %.1f counts/s\n", worst);
+        ++failures;
+    }
+    // every run reaches the goal, whatever the loop rate
+    const StepResult* runs[] = { &fixed2, &fixedJitter, &fixed10, &stalled };
+    for (const StepResult* r : runs) {
+        if (r->settleTime < 0 || r->settleTime > 0.5 || std::fabs(r->finalError) > 0.02) {
+            std::printf("FAIL step response did not settle: %.3f s, %.2f%% error\n", r->settleTime, r->finalError * 100);
+            ++failures;
+        }
+    }
+    // anti-windup: a stalled wheel does not make the release overshoot
+    if (stalled.overshoot > 0.05 || stalled.overshoot >= windup.overshoot) {
+        std::printf("FAIL %.1f%% overshoot after a stall\n", stalled.overshoot * 100);
+        ++failures;
+    }
+
+    // cost per update on this machine only; the board is not measured here
+    double legacyHost = timeUpdates<LegacyMotorControl>();
+    double fixedHost = timeUpdates<ScrapMotorControl>();
+    std::printf("update cost: mapFloat stepping %.3f us, fixed PID %.3f us on this machine\n", legacyHost, fixedHost);
+    return failures;
+}
+
+/** gains far above the defaults are clamped, so the Q16.16 products saturate the output instead of overflowing **/
+int testLargeGains() {
+    int failures = 0;
+    const float gains[][3] = { { 10, 0, 0 }, { 0, 5000, 0 }, { 30000, 30000, 30000 },
+                               { SCRAPMOTORCONTROL_MAXGAIN, 0, 0 }, { 0, SCRAPMOTORCONTROL_MAXKI, 0 } };
+    // every update, and the longest time step the integral takes
+    const unsigned long intervals[] = { 2000, SCRAPMOTORCONTROL_MAXINTERVAL };
+    for (const float* g : gains) {
+        for (unsigned long interval : intervals) {
+            SimMotor motor;
+            SimEncoder encoder;
+            ScrapMotorControl controller(motor, encoder);
+            controller.setMinPower(35);
+            controller.setGains(g[0], g[1], g[2]);
+            useSimulatedTime() = true;
+            simulatedMicros() = 1000;
+            // the wheel is held, so the error stays at its largest
+            controller.setControl(4000);
+            for (int i = 0; i < 20; ++i) {
+                simulatedMicros() += interval;
+                controller.performMovement();
+            }
+            useSimulatedTime() = false;
+            if (motor.getPower() != SCRAPMOTORCONTROL_MAXPOWER) {
+                std::printf("FAIL gains %g, %g, %g every %lu us: power %d on a held wheel\n", g[0], g[1], g[2], interval,
+                            motor.getPower());
+                ++failures;
+            }
+        }
+    }
+    return failures;
+}
+
+/** motor whose setPower takes simulated time, and can fire the scheduler timer in the middle **/
+class SlowMotor : public SimMotor {
+public:
+    unsigned long cost = 0;     // us per setPower
+    bool interruptMe = false;   // tick the scheduler from inside the update
+    virtual void setPower(int pwm) {
+        SimMotor::setPower(pwm);
+        simulatedMicros() += cost;
+        if (interruptMe) {
+            ScrapScheduler::tick();
+        }
+    }
+};
+
+/** checks that the scheduler runs its controllers on time and reports what went wrong **/
+int testScheduler() {
+    int failures = 0;
+    MotorPlant plants[2];
+    SlowMotor motors[2];
+    SimEncoder encoders[2];
+    ScrapMotorControl left(motors[0], encoders[0]);
+    ScrapMotorControl right(motors[1], encoders[1]);
+    left.setMinPower(35);
+    right.setMinPower(35);
+    useSimulatedTime() = true;
+    simulatedMicros() = 1000;
+
+    ScrapScheduler::clear();
+    ScrapScheduler::add(left);
+    ScrapScheduler::add(right);
+    const long period = 1000000 / SCRAPSCHEDULER_RATE;
+    if (!ScrapScheduler::begin(SCRAPSCHEDULER_RATE) || ScrapScheduler::getStats().period != period) {
+        std::printf("FAIL scheduler did not start at 1 kHz\n");
+        ++failures;
+    }
+    // timer fires every period, each interrupt delayed by up to 40 us
+    left.setControl(900);
+    right.setControl(1400);
+    unsigned long start = simulatedMicros();
+    unsigned random = 7;
+    const long duration = 1000000;
+    double average[2] = { 0, 0 }; // over the last 200 ms
+    for (long tick = 0; tick * period < duration; ++tick) {
+        random = random * 1103515245u + 12345u;
+        unsigned long fire = start + tick * period + (random >> 8) % 40;
+        double seconds = (fire - simulatedMicros()) / 1e6;
+        simulatedMicros() = fire;
+        for (int i = 0; i < 2; ++i) {
+            plants[i].step(motors[i].getPower(), motors[i].getDirection(), seconds);
+            encoders[i].moveTo(plants[i].position);
+            if (tick * period >= duration - 200000) {
+                average[i] += plants[i].speed * period / 200000;
+            }
+        }
+        ScrapScheduler::tick();
+    }
+    ScrapSchedulerStats stats = ScrapScheduler::getStats();
+    ScrapScheduler::printStats();
+    if (stats.ticks != duration / period || stats.maxJitter >= 40 || stats.meanPeriod < period - 1 || stats.meanPeriod > period + 1 ||
+        stats.overruns != 0 || stats.skipped != 0) {
+        std::printf("FAIL scheduler timing\n");
+        ++failures;
+    }
+    if (std::fabs(average[0] - 900) > 20 || std::fabs(average[1] - 1400) > 20) {
+        std::printf("FAIL scheduled controllers reached %.0f and %.0f counts/s\n", average[0], average[1]);
+        ++failures;
+    }
+
+    // slow updates are overruns; a timer tick during an update is skipped; held ticks do nothing
+    ScrapScheduler::resetStats();
+    motors[0].cost = period + 200;
+    for (int i = 0; i < 5; ++i) {
+        simulatedMicros() += period;
+        ScrapScheduler::tick();
+    }
+    motors[0].cost = 0;
+    motors[1].interruptMe = true;
+    simulatedMicros() += period;
+    ScrapScheduler::tick();
+    motors[1].interruptMe = false;
+    ScrapScheduler::hold();
+    int power = motors[0].getPower();
+    left.setControl(200);
+    simulatedMicros() += period;
+    ScrapScheduler::tick();
+    ScrapScheduler::release();
+    stats = ScrapScheduler::getStats();
+    if (stats.overruns != 5 || stats.maxBusy < period + 200 || stats.skipped != 1 || stats.held != 1 ||
+        motors[0].getPower() != power) {
+        std::printf("FAIL scheduler counted %lu overruns, %lu skipped, %lu held\n",
+                    stats.overruns, stats.skipped, stats.held);
+        ++failures;
+    }
+    ScrapScheduler::end();
+    ScrapScheduler::clear();
+    useSimulatedTime() = false;
+    return failures;
+}
+
+/** drives the two encoder pins through a quadrature waveform **/
+struct QuadratureSignal {
+    int pinA;
+    int pinB;
+    long position = 0; // quarter steps; forward is AB = 00 -> 01 -> 11 -> 10
+
+    QuadratureSignal(int a, int b) : pinA(a), pinB(b) { write(); }
+
+    void write() {
+        static const uint8_t states[4] = { 0, 1, 3, 2 };
+        uint8_t state = states[position & 3];
+        digitalWrite(pinA, state >> 1);
+        digitalWrite(pinB, state & 1);
+    }
+    void step(int direction) {
+        position += direction;
+        write();
+    }
+};
+
+/** replays waveforms with direction changes, glitches and lost edges through the decoder **/
+int testQuadrature() {
+    int failures = 0;
+    QuadratureSignal signal(40, 41);
+    ScrapEncoder encoder(40, 41);
+
+    // one interrupt per edge, changing direction at random
+    unsigned random = 11;
+    int direction = 1;
+    for (int i = 0; i < 20000; ++i) {
+        random = random * 1103515245u + 12345u;
+        if ((random >> 16) % 50 == 0) {
+            direction = -direction;
+        }
+        signal.step(direction);
+        encoder.update();
+    }
+    if (encoder.getCount() != signal.position || encoder.getErrorCount() != 0) {
+        std::printf("FAIL quadrature walk: count %ld, expected %ld, %lu errors\n",
+                    encoder.getCount(), signal.position, encoder.getErrorCount());
+        ++failures;
+    }
+
+    // a glitch both edges of which interrupt counts one step and takes it back;
+    // one that is gone before the interrupt reads the pins changes nothing
+    long before = encoder.getCount();
+    for (int i = 0; i < 100; ++i) {
+        int pin = i % 2 ? signal.pinA : signal.pinB;
+        digitalWrite(pin, !digitalRead(pin));
+        encoder.update();
+        digitalWrite(pin, !digitalRead(pin));
+        encoder.update();
+        digitalWrite(pin, !digitalRead(pin));
+        digitalWrite(pin, !digitalRead(pin));
+        encoder.update();
+    }
+    if (encoder.getCount() != before || encoder.getErrorCount() != 0) {
+        std::printf("FAIL quadrature glitches moved the count by %ld\n", encoder.getCount() - before);
+        ++failures;
+    }
+
+    // two edges with a single interrupt: the direction is unknown, so the step is dropped and counted
+    before = encoder.getCount();
+    for (int i = 0; i < 10; ++i) {
+        signal.step(1);
+        signal.step(1);
+        encoder.update();
+        signal.step(1);
+        encoder.update();
+    }
+    if (encoder.getCount() != before + 10 || encoder.getErrorCount() != 10) {
+        std::printf("FAIL quadrature lost edges: moved %ld, %lu errors\n",
+                    encoder.getCount() - before, encoder.getErrorCount());
+        ++failures;
+    }
+
+    // a flipped encoder counts the other way
+    QuadratureSignal mirrored(42, 43);
+    ScrapEncoder flipped(42, 43, true);
+    for (int i = 0; i < 400; ++i) {
+        mirrored.step(1);
+        flipped.update();
+    }
+    if (flipped.getCount() != -400) {
+        std::printf("FAIL flipped quadrature count %ld\n", flipped.getCount());
+        ++failures;
+    }
+
+    // the 2x decoders still count on A edges only
+    ScrapEncoder twice(42, 43);
+    for (int i = 0; i < 400; ++i) {
+        uint8_t a = digitalRead(mirrored.pinA);
+        mirrored.step(1);
+        if (digitalRead(mirrored.pinA) != a) {
+            twice.checkEncoder();
+            flipped.checkEncoderFlipped();
+        }
+    }
+    if (twice.getCount() != 200 || flipped.getCount() != -600) {
+        std::printf("FAIL 2x decoding counted %ld and %ld\n", twice.getCount(), flipped.getCount() + 400);
+        ++failures;
+    }
+    return failures;
+}
+
+/** fires bursts of encoder "interrupts" at a chosen preemption point of a snapshot read **/
+struct Preemption {
+    static SimEncoder* encoders[2];
+    static int point;      // preemption points passed so far
+    static int at;         // point the burst fires at
+    static int burst;      // interrupts in the burst
+    static int next;       // encoder the next edge goes to
+    // each edge takes 8 us, so an edge time tells which edge it was
+    static void edge() {
+        simulatedMicros() += 8;
+        encoders[next]->edge(1);
+        if (encoders[1 - next] != encoders[next]) {
+            next = 1 - next;
+        }
+    }
+    static void fire() {
+        if (point == at) {
+            for (int i = 0; i < burst; ++i) {
+                edge();
+            }
+        }
+        ++point;
+    }
+    // counts at zero, then some edges so both counts have an edge time
+    static void start(unsigned long base, int edges, int atPoint, int burstSize) {
+        simulatedMicros() = base;
+        encoders[0]->setCount(0);
+        encoders[1]->setCount(0);
+        next = 0;
+        for (int i = 0; i < edges; ++i) {
+            edge();
+        }
+        point = 0;
+        at = atPoint;
+        burst = burstSize;
+    }
+};
+SimEncoder* Preemption::encoders[2];
+int Preemption::point = 0;
+int Preemption::at = 0;
+int Preemption::burst = 0;
+int Preemption::next = 0;
+
+/** moves a ScrapEncoder a few quarter steps at one preemption point of its getCount **/
+struct CountPreemption {
+    static QuadratureSignal* signal;
+    static ScrapEncoder* encoder;
+    static int point;
+    static int at;
+    static void fire() {
+        if (point == at) {
+            for (int i = 0; i < 3; ++i) {
+                signal->step(1);
+                encoder->update();
+            }
+        }
+        ++point;
+    }
+};
+QuadratureSignal* CountPreemption::signal = nullptr;
+ScrapEncoder* CountPreemption::encoder = nullptr;
+int CountPreemption::point = 0;
+int CountPreemption::at = 0;
+
+/**
+reads the pair through ScrapEncoderInterface::getSnapshot with bursts of encoder interrupts landing
+at every point between its loads. The wheels take turns, one edge each, so at any instant
+count1 - count2 is 0 or 1 and each edge time follows from its count; a torn snapshot breaks that.
+An interrupt between the bytes of one load has the same effect as one just before or after it:
+either way the sequence changes before it is read again.
+**/
+int testSnapshot() {
+    int failures = 0;
+    int checked = 0;
+    int naiveTorn = 0;
+    SimEncoder encoders[2];
+    Preemption::encoders[0] = &encoders[0];
+    Preemption::encoders[1] = &encoders[1];
+    useSimulatedTime() = true;
+    const unsigned long base = 5000;
+    for (int burst = 1; burst <= 3; ++burst) {
+        for (int at = 0; at < 8; ++at) {
+            Preemption::start(base, 10, at, burst);
+            preemptionHook() = Preemption::fire;
+            ScrapEncoderPairSnapshot snapshot;
+            ScrapEncoderInterface::getSnapshot(encoders[0], encoders[1], snapshot);
+            preemptionHook() = nullptr;
+            ++checked;
+            long separation = snapshot.count1 - snapshot.count2;
+            if (separation < 0 || separation > 1 ||
+                snapshot.edgeTime1 != base + 8 * (2 * snapshot.count1 - 1) ||
+                snapshot.edgeTime2 != base + 8 * (2 * snapshot.count2) ||
+                snapshot.time != base + 8 * (snapshot.count1 + snapshot.count2)) {
+                std::printf("FAIL torn snapshot with %d interrupts at point %d: counts %ld %ld, edges %lu %lu, time %lu\n",
+                            burst, at, snapshot.count1, snapshot.count2, snapshot.edgeTime1, snapshot.edgeTime2, snapshot.time);
+                ++failures;
+            }
+
+            // the same interrupts against reading the counts one after the other
+            Preemption::start(base, 10, at, burst);
+            long count1 = encoders[0].getCount();
+            Preemption::fire();
+            long count2 = encoders[1].getCount();
+            Preemption::fire();
+            if (count1 - count2 < 0 || count1 - count2 > 1) {
+                ++naiveTorn;
+            }
+        }
+    }
+    // a single encoder interrupting its own snapshot
+    Preemption::encoders[1] = &encoders[0];
+    for (int burst = 1; burst <= 3; ++burst) {
+        for (int at = 0; at < 4; ++at) {
+            Preemption::start(base, 5, at, burst);
+            preemptionHook() = Preemption::fire;
+            ScrapEncoderSnapshot snapshot;
+            encoders[0].getSnapshot(snapshot);
+            preemptionHook() = nullptr;
+            ++checked;
+            if (snapshot.edgeTime != base + 8 * snapshot.count || snapshot.time != snapshot.edgeTime) {
+                std::printf("FAIL torn snapshot with %d interrupts at point %d: count %ld, edge %lu, time %lu\n",
+                            burst, at, snapshot.count, snapshot.edgeTime, snapshot.time);
+                ++failures;
+            }
+        }
+    }
+    // getCount reads again when edges land between its loads, and returns the count after them
+    QuadratureSignal signal(48, 49);
+    ScrapEncoder encoder(48, 49);
+    CountPreemption::signal = &signal;
+    CountPreemption::encoder = &encoder;
+    for (int at = 0; at < 2; ++at) {
+        CountPreemption::point = 0;
+        CountPreemption::at = at;
+        long before = encoder.getCount();
+        preemptionHook() = CountPreemption::fire;
+        long count = encoder.getCount();
+        preemptionHook() = nullptr;
+        ++checked;
+        if (count != before + 3 || CountPreemption::point < 4) {
+            std::printf("FAIL getCount with edges at point %d read %ld after %ld\n", at, count, before);
+            ++failures;
+        }
+    }
+    std::printf("%d of %d snapshots read under interrupts were whole; reading the counts one by one tore %d times\n",
+                checked - failures, checked, naiveTorn);
+    if (naiveTorn == 0) {
+        std::printf("FAIL the stress test never hit a torn read\n");
+        ++failures;
+    }
+    useSimulatedTime() = false;
+    return failures;
+}
+
+/** ScrapDualController with the bang-bang balancing it used before cross coupling, kept for comparison **/
+class LegacyDualController : public ScrapDualController {
+private:
+    long diffTolerance = 40;
+    float speedBalance = 10;
+
+    void legacyBalance() {
+        float common_speed;
+        long separation = getCount1() - getCount2();
+        if (abs(separation * speedControl1->getDirection()) >= diffTolerance) {
+            moveSpeedToward2(speedBalance);
+        }
+        // never true: kept as it was
+        else if (abs(separation * speedControl1->getDirection()) <= -diffTolerance) {
+            moveSpeedToward1(speedBalance);
+        }
+        else {
+            if (speedControl1->getSpeedGoal() != 0 && speedControl1->getSpeedGoal() != 0) {
+                common_speed = (speedControl1->getSpeedGoal() + speedControl2->getSpeedGoal()) / 2.0;
+                speedControl1->setSpeed(common_speed);
+                speedControl2->setSpeed(common_speed);
+            }
+        }
+    }
+
+public:
+    bool legacy = false;
+    LegacyDualController(ScrapMotorControl& motorControl1, ScrapMotorControl& motorControl2)
+        : ScrapDualController(motorControl1, motorControl2) {}
+    bool move() {
+        if (!legacy) {
+            return performMovement();
+        }
+        if (checkIfDone()) {
+            stop();
+            return true;
+        }
+        if (checkIfDone1()) {
+            speedControl1->stop();
+        }
+        else {
+            speedControl1->setControl(getCount1() < goal1 ? calcSpeed1() : -calcSpeed1());
+        }
+        if (checkIfDone2()) {
+            speedControl2->stop();
+        }
+        else {
+            speedControl2->setControl(getCount2() < goal2 ? calcSpeed2() : -calcSpeed2());
+        }
+        legacyBalance();
+        speedControl1->performMovement();
+        speedControl2->performMovement();
+        return false;
+    }
+};
+
+struct StraightResult {
+    std::vector<long> drift; // count1 - count2 every 100 ms
+    long maxDrift = 0;
+    double meanDrift = 0; // mean of |count1 - count2| until the goal
+    long finalDrift = 0;
+    double doneTime = -1; // seconds until both wheels are at the goal
+};
+
+/**
+drives a straight segment on two mismatched wheels; mode 0 uncoupled, 1 bang-bang, 2 cross coupled.
+Wheel 2 is held for 50 ms at 1 s, as if it caught on a seam in the board
+**/
+StraightResult runStraight(int mode, long distance) {
+    MotorPlant plants[2];
+    plants[1].gain = 7.2;
+    plants[1].deadband = 36;
+    SimMotor motors[2];
+    SimEncoder encoders[2];
+    ScrapMotorControl control1(motors[0], encoders[0]);
+    ScrapMotorControl control2(motors[1], encoders[1]);
+    ScrapMotorControl* controls[2] = { &control1, &control2 };
+    for (ScrapMotorControl* control : controls) {
+        control->setMinPower(35);
+        control->setMinSpeed(SCRAPDUALCONTROLLER_MINENCSPEED);
+        control->setMaxSpeed(SCRAPDUALCONTROLLER_MAXENCSPEED);
+    }
+    useSimulatedTime() = true;
+    simulatedMicros() = 1000;
+    LegacyDualController dual(control1, control2);
+    dual.legacy = mode == 1;
+    if (mode == 0) {
+        dual.setSyncGain(0);
+    }
+    dual.set(distance);
+    unsigned long start = simulatedMicros();
+    StraightResult result;
+    for (long t = 0; t <= 6000000; t += SIM_STEP) {
+        simulatedMicros() = start + t;
+        long drift = encoders[0].getCount() - encoders[1].getCount();
+        if (t % 100000 == 0) {
+            result.drift.push_back(drift);
+        }
+        result.maxDrift = std::max(result.maxDrift, std::labs(drift));
+        result.meanDrift += std::labs(drift);
+        if (t % 1000 == 0 && dual.move()) {
+            result.doneTime = t / 1e6;
+            result.finalDrift = drift;
+            result.meanDrift /= t / SIM_STEP + 1;
+            break;
+        }
+        plants[1].stalled = t >= 1000000 && t < 1050000;
+        for (int i = 0; i < 2; ++i) {
+            plants[i].step(motors[i].getPower(), motors[i].getDirection(), SIM_STEP / 1e6);
+        }
+        simulatedMicros() = start + t + SIM_STEP;
+        for (int i = 0; i < 2; ++i) {
+            encoders[i].moveTo(plants[i].position);
+        }
+    }
+    useSimulatedTime() = false;
+    return result;
+}
+
+/** straight line drift and time to the goal with and without cross coupling **/
+int testDualSync() {
+    int failures = 0;
+    const long distance = 4000;
+    const char* names[3] = { "uncoupled", "bang-bang", "cross coupled" };
+    StraightResult runs[3];
+    std::printf("straight %ld counts at up to %d counts/s, wheel 2 10%% weaker and held at 1 s; drift every 100 ms:\n",
+                distance, SCRAPDUALCONTROLLER_MAXENCSPEED);
+    for (int mode = 0; mode < 3; ++mode) {
+        runs[mode] = runStraight(mode, distance);
+        std::printf("  %-14s", names[mode]);
+        for (long drift : runs[mode].drift) {
+            std::printf(" %4ld", drift);
+        }
+        std::printf("\n  %-14s drift largest %ld, mean %.1f, at the goal %ld; done after %.2f s\n", "",
+                    runs[mode].maxDrift, runs[mode].meanDrift, runs[mode].finalDrift, runs[mode].doneTime);
+    }
+    const StraightResult& coupled = runs[2];
+    if (coupled.doneTime < 0 || coupled.meanDrift * 3 > runs[0].meanDrift || coupled.meanDrift * 3 > runs[1].meanDrift ||
+        std::labs(coupled.finalDrift) > 2 * SCRAPDUALCONTROLLER_ENCTOLERANCE ||
+        coupled.doneTime > 1.1 * runs[0].doneTime) {
+        std::printf("FAIL cross coupling: mean drift %.1f, done after %.2f s\n", coupled.meanDrift, coupled.doneTime);
+        ++failures;
+    }
+    return failures;
+}
+
+/** X axis on one wheel and Y axis on two, each a simulated motor and encoder **/
+struct SimGantry {
+    MotorPlant plants[3];
+    SimMotor motors[3];
+    SimEncoder encoders[3];
+    ScrapMotorControl controls[3];
+    ScrapController x;
+    ScrapDualController y;
+    ScrapFullController full;
+    double worstAcross = 0; // farthest from the line through the current waypoints
+
+    SimGantry() {
+        plants[2].gain = 7.6;
+        for (int i = 0; i < 3; ++i) {
+            controls[i].attachMotor(motors[i]);
+            controls[i].attachEncoder(encoders[i]);
+            controls[i].setMinPower(35);
+            controls[i].setMinSpeed(0);
+            controls[i].setMaxSpeed(4000);
+        }
+        x = ScrapController(controls[0]);
+        y = ScrapDualController(controls[1], controls[2]);
+        full = ScrapFullController(x, y);
+    }
+    // advances the plants by one simulation step
+    void step(unsigned long now) {
+        for (int i = 0; i < 3; ++i) {
+            plants[i].step(motors[i].getPower(), motors[i].getDirection(), SIM_STEP / 1e6);
+        }
+        simulatedMicros() = now;
+        for (int i = 0; i < 3; ++i) {
+            encoders[i].moveTo(plants[i].position);
+        }
+    }
+    double getX() { return plants[0].position; }
+    double getY() { return (plants[1].position + plants[2].position) / 2; }
+};
+
+struct PathResult {
+    double time = -1;       // seconds to the last waypoint
+    double worstAcross = 0; // farthest from the segment being driven (counts)
+    double slowest = 1e9;   // slowest speed between the first and the last waypoint (counts/s)
+    long endError = 0;      // counts from the last waypoint on the worse axis
+};
+
+/** distance from point p to the segment a-b **/
+double segmentDistance(double px, double py, double ax, double ay, double bx, double by) {
+    double dx = bx - ax;
+    double dy = by - ay;
+    double t = std::max(0.0, std::min(1.0, ((px - ax) * dx + (py - ay) * dy) / (dx * dx + dy * dy)));
+    return std::hypot(px - ax - t * dx, py - ay - t * dy);
+}
+
+/**
+drives the waypoints one set() at a time (mode 0), through the motion queue one waypoint at a time so
+it stops at each (mode 1), or through the motion queue with lookahead (mode 2)
+**/
+PathResult runPath(const long (*points)[2], int count, int mode) {
+    SimGantry gantry;
+    useSimulatedTime() = true;
+    simulatedMicros() = 1000;
+    unsigned long start = simulatedMicros();
+    PathResult result;
+    int next = 0;   // next waypoint to hand over
+    bool moving = false;
+    double prevX = 0;
+    double prevY = 0;
+    for (long t = 0; t <= 20000000; t += SIM_STEP) {
+        simulatedMicros() = start + t;
+        if (t % 1000 == 0) {
+            bool done;
+            if (mode > 0) {
+                int ahead = mode == 1 ? 1 : SCRAPFULLCONTROLLER_QUEUESIZE;
+                while (next < count && gantry.full.getQueueLength() < ahead) {
+                    gantry.full.queueMove(points[next][0], points[next][1]);
+                    ++next;
+                }
+                done = gantry.full.performQueue() && next == count;
+            }
+            else {
+                if (!moving && next < count) {
+                    gantry.full.set(points[next][0], points[next][1]);
+                    ++next;
+                    moving = true;
+                }
+                done = gantry.full.performMovement();
+                if (done) {
+                    moving = false;
+                    done = next == count;
+                }
+            }
+            if (done) {
+                result.time = t / 1e6;
+                break;
+            }
+            // path speed over the last millisecond, while between the first and the last waypoint
+            double speed = std::hypot(gantry.getX() - prevX, gantry.getY() - prevY) * 1000;
+            double fromFirst = std::hypot(gantry.getX() - points[0][0], gantry.getY() - points[0][1]);
+            double toLast = std::hypot(gantry.getX() - points[count - 1][0], gantry.getY() - points[count - 1][1]);
+            if (fromFirst > 50 && toLast > 50) {
+                result.slowest = std::min(result.slowest, speed);
+            }
+            prevX = gantry.getX();
+            prevY = gantry.getY();
+        }
+        // off the path: distance to the nearest segment of the whole path
+        double across = std::hypot(gantry.getX(), gantry.getY());
+        for (int i = 0; i < count; ++i) {
+            double ax = i ? points[i - 1][0] : 0;
+            double ay = i ? points[i - 1][1] : 0;
+            across = std::min(across, segmentDistance(gantry.getX(), gantry.getY(), ax, ay, points[i][0], points[i][1]));
+        }
+        result.worstAcross = std::max(result.worstAcross, across);
+        gantry.step(start + t + SIM_STEP);
+    }
+    result.endError = std::max(std::labs(gantry.x.getCount() - points[count - 1][0]),
+                               std::labs(gantry.y.getCount() - points[count - 1][1]));
+    useSimulatedTime() = false;
+    return result;
+}
+
+/** the motion queue against one set() per waypoint on a path with straight runs and corners **/
+int testMotionQueue() {
+    int failures = 0;
+    // from the origin: a straight run split in three, a quarter circle in eight chords, a right angle,
+    // and back home
+    long path[16][2] = { { 600, 0 }, { 1200, 0 }, { 1800, 0 } };
+    int count = 3;
+    for (int i = 1; i <= 8; ++i) {
+        double angle = i * M_PI / 16;
+        path[count][0] = 1800 + std::lround(1000 * std::sin(angle));
+        path[count][1] = 1000 - std::lround(1000 * std::cos(angle));
+        ++count;
+    }
+    path[count][0] = 2800;
+    path[count][1] = 2400;
+    path[count + 1][0] = 0;
+    path[count + 1][1] = 2400;
+    path[count + 2][0] = 0;
+    path[count + 2][1] = 0;
+    count += 3;
+    const char* names[3] = { "one set() per waypoint", "queue, stop at each", "queue, lookahead" };
+    PathResult runs[3];
+    std::printf("%d waypoints at %d counts/s:\n", count, SCRAPFULLCONTROLLER_SPEED);
+    for (int mode = 0; mode < 3; ++mode) {
+        runs[mode] = runPath(path, count, mode);
+        std::printf("  %-24s %5.2f s, slowest %5.0f counts/s, %5.1f counts off the path, %ld from the end\n",
+                    names[mode], runs[mode].time, runs[mode].slowest, runs[mode].worstAcross, runs[mode].endError);
+    }
+    const PathResult& queued = runs[2];
+    if (queued.time < 0 || queued.time > 0.8 * runs[1].time ||
+        queued.slowest < SCRAPFULLCONTROLLER_MINSPEED * 0.5 || queued.worstAcross > SCRAPFULLCONTROLLER_JUNCTIONDEV * 2 ||
+        queued.endError > SCRAPFULLCONTROLLER_ENCTOLERANCE) {
+        std::printf("FAIL motion queue\n");
+        ++failures;
+    }
+
+    // planning: straight-on junctions keep the full speed, right angles slow down, reversals stop
+    SimGantry gantry;
+    ScrapFullController& full = gantry.full;
+    full.queueMove(2000, 0);
+    full.queueMove(4000, 0);
+    full.queueMove(4000, 2000);
+    full.queueMove(0, 2000);
+    full.queueMove(4000, 2000);
+    float straight = full.getPlannedSpeed(1);
+    float corner = full.getPlannedSpeed(2);
+    float reversal = full.getPlannedSpeed(4);
+    std::printf("  planned junction speeds: straight %.0f, right angle %.0f, reversal %.0f counts/s\n",
+                straight, corner, reversal);
+    if (straight < SCRAPFULLCONTROLLER_SPEED - 1 || corner <= 0 || corner >= straight || reversal != 0 ||
+        full.getPlannedSpeed(0) != 0) {
+        std::printf("FAIL motion queue planning\n");
+        ++failures;
+    }
+    for (int i = 0; i < SCRAPFULLCONTROLLER_QUEUESIZE; ++i) {
+        full.queueMove(i % 2 ? 0 : 100, 0);
+    }
+    if (!full.getIfQueueFull() || full.queueMove(5000, 5000)) {
+        std::printf("FAIL motion queue accepted more than %d segments\n", SCRAPFULLCONTROLLER_QUEUESIZE);
+        ++failures;
+    }
+    return failures;
+}
+
+const int SWITCH_PIN = 40;
+const int SWITCH_PIN2 = 41;
+
+/** the constant speed reset ScrapController used before ScrapHoming, kept for comparison **/
+bool legacyReset(ScrapMotorControl& control, ScrapSwitch& swi, float speed) {
+    control.stop();
+    if (swi.getIfPressed()) {
+        control.reset();
+        return true;
+    }
+    control.setControl(-speed);
+    control.performMovement();
+    return false;
+}
+
+struct HomingResult {
+    double time = -1;     // seconds until the reset reported done
+    double zero = 0;      // where the count was zeroed, in counts past the switch
+    double restsOn = 0;   // where the axis came to rest, past the switch
+};
+
+/**
+homes one axis from start counts away from its switch, which closes at position 0 (LOW, the default
+ScrapSwitch wiring), with the 1 ms control step starting phase us into the simulation;
+speed 0 uses ScrapHoming, anything else the constant speed reset
+**/
+HomingResult runHoming(double startPosition, long phase, float speed) {
+    MotorPlant plant;
+    SimMotor motor;
+    SimEncoder encoder;
+    ScrapMotorControl control(motor, encoder);
+    control.setMinPower(35);
+    control.setMinSpeed(0);
+    control.setMaxSpeed(4000);
+    ScrapSwitch swi(SWITCH_PIN);
+    ScrapController axis(control);
+    axis.attachSwitch(swi);
+    plant.position = startPosition;
+    useSimulatedTime() = true;
+    simulatedMicros() = 1000;
+    encoder.moveTo(startPosition);
+    unsigned long start = simulatedMicros();
+    HomingResult result;
+    for (long t = 0; t <= 60000000; t += SIM_STEP) {
+        simulatedMicros() = start + t;
+        fakePins()[SWITCH_PIN] = plant.position <= 0 ? LOW : HIGH;
+        if (t % 1000 == phase && result.time < 0) {
+            if (speed == 0 ? axis.performReset() : legacyReset(control, swi, speed)) {
+                result.time = t / 1e6;
+                result.zero = -plant.position;
+            }
+        }
+        // let the axis coast to a stop after the reset
+        if (result.time >= 0 && t / 1e6 > result.time + 0.5) {
+            break;
+        }
+        plant.step(motor.getPower(), motor.getDirection(), SIM_STEP / 1e6);
+        simulatedMicros() = start + t + SIM_STEP;
+        encoder.moveTo(plant.position);
+    }
+    result.restsOn = -plant.position;
+    useSimulatedTime() = false;
+    return result;
+}
+
+/** two-phase homing against the constant speed reset: time from far away and spread of the zero **/
+int testHoming() {
+    int failures = 0;
+    const char* names[3] = { "old reset at 100", "old reset at 800", "two-phase" };
+    const float speeds[3] = { 100, 800, 0 };
+    const double distances[3] = { 200, 800, 2000 };
+    double spread[3];
+    double times[3][3];
+    std::printf("homing onto a switch at 0 with a 1 ms control step:\n");
+    for (int mode = 0; mode < 3; ++mode) {
+        double lowest = 1e9;
+        double highest = -1e9;
+        for (int d = 0; d < 3; ++d) {
+            times[mode][d] = 0;
+            // the zero depends on where the switch closes between two control steps; try several phases
+            for (int k = 0; k < 10; ++k) {
+                HomingResult r = runHoming(distances[d] + k * 0.37, (k * SIM_STEP) % 1000, speeds[mode]);
+                if (r.time < 0) {
+                    std::printf("FAIL homing %s from %.0f counts never finished\n", names[mode], distances[d]);
+                    ++failures;
+                    continue;
+                }
+                times[mode][d] = std::max(times[mode][d], r.time);
+                lowest = std::min(lowest, r.zero);
+                highest = std::max(highest, r.zero);
+            }
+        }
+        spread[mode] = highest - lowest;
+        std::printf("  %-22s from %4.0f/%4.0f/%4.0f counts: %5.2f/%5.2f/%5.2f s, zero spread %.2f counts\n",
+                    names[mode], distances[0], distances[1], distances[2],
+                    times[mode][0], times[mode][1], times[mode][2], spread[mode]);
+    }
+    // as repeatable as the slow constant reset, and faster than it from anywhere but close by
+    if (spread[2] > spread[0] * 1.5 + 0.05 || spread[2] * 4 > spread[1] ||
+        times[2][1] * 3 > times[0][1] || times[2][2] * 3 > times[0][2]) {
+        std::printf("FAIL two-phase homing\n");
+        ++failures;
+    }
+
+    // starting on the switch only backs off and comes back; both wheels of a dual controller home apart
+    HomingResult onSwitch = runHoming(-3, 0, 0);
+    if (onSwitch.time < 0 || onSwitch.time > 1.0 || std::fabs(onSwitch.zero) > 0.5) {
+        std::printf("FAIL homing from on the switch: %.2f s, zero %.2f\n", onSwitch.time, onSwitch.zero);
+        ++failures;
+    }
+
+    MotorPlant plants[2];
+    SimMotor motors[2];
+    SimEncoder encoders[2];
+    ScrapMotorControl controls[2];
+    ScrapSwitch switches[2] = { ScrapSwitch(SWITCH_PIN), ScrapSwitch(SWITCH_PIN2) };
+    const int pins[2] = { SWITCH_PIN, SWITCH_PIN2 };
+    plants[0].position = 900;
+    plants[1].position = 2500;
+    plants[1].gain = 7.2;
+    useSimulatedTime() = true;
+    simulatedMicros() = 1000;
+    for (int i = 0; i < 2; ++i) {
+        controls[i].attachMotor(motors[i]);
+        controls[i].attachEncoder(encoders[i]);
+        controls[i].setMinPower(35);
+        controls[i].setMinSpeed(0);
+        controls[i].setMaxSpeed(4000);
+        encoders[i].moveTo(plants[i].position);
+    }
+    ScrapDualController dual(controls[0], controls[1]);
+    dual.attachSwitch1(switches[0]);
+    dual.attachSwitch2(switches[1]);
+    unsigned long start = simulatedMicros();
+    double doneTime = -1;
+    for (long t = 0; t <= 20000000 && doneTime < 0; t += SIM_STEP) {
+        simulatedMicros() = start + t;
+        for (int i = 0; i < 2; ++i) {
+            fakePins()[pins[i]] = plants[i].position <= 0 ? LOW : HIGH;
+        }
+        if (t % 1000 == 0 && dual.performReset()) {
+            doneTime = t / 1e6;
+        }
+        for (int i = 0; i < 2; ++i) {
+            plants[i].step(motors[i].getPower(), motors[i].getDirection(), SIM_STEP / 1e6);
+        }
+        simulatedMicros() = start + t + SIM_STEP;
+        for (int i = 0; i < 2; ++i) {
+            encoders[i].moveTo(plants[i].position);
+        }
+    }
+    // the wheels coast on after the reset; the counts have to follow them from the switch
+    double offset = std::max(std::fabs(plants[0].position - encoders[0].getCount()),
+                             std::fabs(plants[1].position - encoders[1].getCount()));
+    std::printf("  dual controller from 900/2500 counts: %.2f s (reported %.2f s), counts off the switch by %.2f\n",
+                doneTime, dual.getHomingTime() / 1e6, offset);
+    if (doneTime < 0 || offset > 1.1 || std::fabs(dual.getHomingTime() / 1e6 - doneTime) > 0.002) {
+        std::printf("FAIL dual controller homing\n");
+        ++failures;
+    }
+    useSimulatedTime() = false;
+    return failures;
+}
+
+struct MoveResult {
+    double time = -1;     // seconds until the controller reported done
+    double overshoot = 0; // farthest past the goal (counts)
+    double peakAccel = 0; // largest wheel acceleration over 10 ms (counts/s^2); what makes a wheel slip
+    double peakJerk = 0;  // largest change of the commanded acceleration over 20 ms while moving (counts/s^3)
+    double settled = 0;   // counts from the goal once the wheel came to rest
+};
+
+/** one ScrapController move of distance counts; accel 0 is the slowdown threshold ramp it had before **/
+MoveResult runMove(long distance, float accel, float jerk, float maxSpeed) {
+    MotorPlant plant;
+    SimMotor motor;
+    SimEncoder encoder;
+    ScrapMotorControl control(motor, encoder);
+    control.setMinPower(35);
+    control.setMinSpeed(0);
+    control.setMaxSpeed(4000);
+    ScrapController axis(control);
+    axis.setProfile(accel, jerk);
+    axis.setMaxSpeedEnc(maxSpeed);
+    axis.set(distance);
+    useSimulatedTime() = true;
+    simulatedMicros() = 1000;
+    unsigned long start = simulatedMicros();
+    MoveResult result;
+    std::vector<double> speeds;   // wheel speed every 10 ms
+    std::vector<double> commands; // speed goal every 10 ms until done
+    for (long t = 0; t <= 20000000; t += SIM_STEP) {
+        simulatedMicros() = start + t;
+        if (t % 1000 == 0 && result.time < 0 && axis.performMovement()) {
+            result.time = t / 1e6;
+        }
+        if (t % 10000 == 0) {
+            speeds.push_back(plant.speed);
+            if (result.time < 0) {
+                commands.push_back(control.getSpeedGoal());
+            }
+        }
+        result.overshoot = std::max(result.overshoot, plant.position - distance);
+        if (result.time >= 0 && t / 1e6 > result.time + 0.5) {
+            break;
+        }
+        plant.step(motor.getPower(), motor.getDirection(), SIM_STEP / 1e6);
+        simulatedMicros() = start + t + SIM_STEP;
+        encoder.moveTo(plant.position);
+    }
+    for (size_t i = 1; i < speeds.size(); ++i) {
+        result.peakAccel = std::max(result.peakAccel, std::fabs(speeds[i] - speeds[i - 1]) / 0.01);
+    }
+    // the speed goal is kept in whole counts/s, so each sample is off by up to half a count; over 20 ms
+    // that rounding adds at most 2 / 0.02^2 = 5000 counts/s^3, where over 10 ms it would add 20000
+    for (size_t i = 4; i < commands.size(); ++i) {
+        double change = (commands[i] - 2 * commands[i - 2] + commands[i - 4]) / (0.02 * 0.02);
+        result.peakJerk = std::max(result.peakJerk, std::fabs(change));
+    }
+    result.settled = plant.position - distance;
+    useSimulatedTime() = false;
+    return result;
+}
+
+/** shortest time to travel distance from rest to rest within the limits, with the speed topping out at maxSpeed **/
+double minMoveTime(double distance, double maxSpeed, double accel, double jerk) {
+    // a ramp from rest up to v and back down: its time and its distance
+    auto rampTime = [&](double v) { return (v >= accel * accel / jerk) ? v / accel + accel / jerk : 2 * std::sqrt(v / jerk); };
+    auto rampDistance = [&](double v) { return v * rampTime(v) / 2; };
+    double low = 0;
+    double high = maxSpeed;
+    if (2 * rampDistance(maxSpeed) > distance) {
+        for (int i = 0; i < 60; ++i) {
+            double v = (low + high) / 2;
+            (2 * rampDistance(v) > distance ? high : low) = v;
+        }
+    }
+    return 2 * rampTime(high) + (distance - 2 * rampDistance(high)) / high;
+}
+
+/** jerk-limited and trapezoidal profiles against the slowdown ramp, on a long and a short move **/
+int testProfile() {
+    int failures = 0;
+    const char* names[4] = { "slowdown ramp", "trapezoid", "S-curve", "S-curve, 1700 max" };
+    const float accels[4] = { 0, SCRAPCONTROLLER_ACCEL, SCRAPCONTROLLER_ACCEL, SCRAPCONTROLLER_ACCEL };
+    const float jerks[4] = { 0, 0, SCRAPCONTROLLER_JERK, SCRAPCONTROLLER_JERK };
+    const float maxSpeeds[4] = { 1400, 1400, 1400, 1700 };
+    const long distances[2] = { 3000, 150 };
+    MoveResult runs[2][4];
+    std::printf("single axis moves, %d counts/s^2 and %d counts/s^3 limits:\n", SCRAPCONTROLLER_ACCEL, SCRAPCONTROLLER_JERK);
+    for (int d = 0; d < 2; ++d) {
+        for (int mode = 0; mode < 4; ++mode) {
+            MoveResult& r = runs[d][mode];
+            r = runMove(distances[d], accels[mode], jerks[mode], maxSpeeds[mode]);
+            std::printf("  %4ld counts, %-18s %5.2f s, overshoot %5.1f, rests %5.1f from the goal, "
+                        "peak acceleration %6.0f, peak jerk %7.0f\n",
+                        distances[d], names[mode], r.time, r.overshoot, r.settled, r.peakAccel, r.peakJerk);
+        }
+        const MoveResult& ramp = runs[d][0];
+        // the ramp is only quicker by accelerating at several times the limit; within the limits a move
+        // cannot beat minMoveTime, and the wheel trailing the profile adds about a lag at each end
+        for (int mode = 2; mode < 4; ++mode) {
+            const MoveResult& scurve = runs[d][mode];
+            double fastest = minMoveTime(distances[d], maxSpeeds[mode], SCRAPCONTROLLER_ACCEL, SCRAPCONTROLLER_JERK);
+            std::printf("  %4ld counts, %-18s fastest within the limits %.2f s\n", distances[d], names[mode], fastest);
+            if (scurve.time < 0 || scurve.time > fastest + 2 * SCRAPPROFILE_LAG ||
+                scurve.overshoot > SCRAPCONTROLLER_ENCTOLERANCE || std::fabs(scurve.settled) > SCRAPCONTROLLER_ENCTOLERANCE ||
+                scurve.peakAccel > SCRAPCONTROLLER_ACCEL * 1.1 || scurve.peakAccel * 2 > ramp.peakAccel ||
+                scurve.peakJerk > SCRAPCONTROLLER_JERK + 2 / (0.02 * 0.02)) {
+                std::printf("FAIL %s profile on %ld counts\n", names[mode], distances[d]);
+                ++failures;
+            }
+        }
+    }
+    // with the gentler starts and stops the top speed can go up, which wins the time back on long moves
+    if (runs[0][3].time > 1.01 * runs[0][0].time) {
+        std::printf("FAIL S-curve profile at a higher top speed\n");
+        ++failures;
+    }
+
+    // the profile itself: never past the acceleration limit, and lands on the target without overshoot
+    ScrapProfile profile;
+    profile.setLimits(SCRAPCONTROLLER_ACCEL, SCRAPCONTROLLER_JERK);
+    useSimulatedTime() = true;
+    simulatedMicros() = 1000;
+    double peak = 0;
+    double highest = 0;
+    double peakJerk = 0;
+    for (int i = 0; i < 1000; ++i) {
+        simulatedMicros() += 1000;
+        double accel = profile.getAccel();
+        highest = std::max(highest, double(profile.step(1000)));
+        peak = std::max(peak, std::fabs(double(profile.getAccel())));
+        peakJerk = std::max(peakJerk, std::fabs(profile.getAccel() - accel) / 0.001);
+    }
+    useSimulatedTime() = false;
+    // braking from there has to take the distance getStopDistance gave
+    double planned = profile.getStopDistance();
+    double travelled = 0;
+    useSimulatedTime() = true;
+    for (int i = 0; i < 1000; ++i) {
+        simulatedMicros() += 1000;
+        double accel = profile.getAccel();
+        travelled += profile.step(0) / 1000.0;
+        peakJerk = std::max(peakJerk, std::fabs(profile.getAccel() - accel) / 0.001);
+    }
+    useSimulatedTime() = false;
+    std::printf("  profile to 1000 counts/s: highest %.1f, peak acceleration %.0f, peak jerk %.0f; "
+                "planned to stop in %.1f counts, took %.1f\n", highest, peak, peakJerk, planned, travelled);
+    if (highest > 1000.01 || peak > SCRAPCONTROLLER_ACCEL + 1 || peakJerk > SCRAPCONTROLLER_JERK + 1 ||
+        std::fabs(planned - travelled) > 2) {
+        std::printf("FAIL profile limits\n");
+        ++failures;
+    }
+    return failures;
+}
+
+int main() {
+    int failures = testSpeedEstimate();
+    failures += testSpeedPid();
+    failures += testLargeGains();
+    failures += testScheduler();
+    failures += testQuadrature();
+    failures += testSnapshot();
+    failures += testDualSync();
+    failures += testMotionQueue();
+    failures += testHoming();
+    failures += testProfile();
+
+    return failures ? 1 : 0;
+}
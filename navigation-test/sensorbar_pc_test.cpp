@@ -0,0 +1,218 @@
+// host tests for the SparkFun line follower array library, run against an emulated SX1509 on the fake bus
+#include <cstdio>
+
+#include "sensorbar.h"
+#include "Wire.h"
+#include "FakeSX1509.h"
+
+const uint8_t BAR_ADDRESS = 0x3E;
+const int INTERRUPT_PIN = 2;
+
+static FakeSX1509 sx1509(INTERRUPT_PIN);
+static SensorBar* bar = nullptr;
+static long encoderCount = 0;
+
+long readEncoder() {
+    return encoderCount;
+}
+
+void barChanged() {
+    bar->markChange();
+}
+
+/** a loop asks for the raw bits, the position and the density, like line following does **/
+int readAll(SensorBar& sensorBar) {
+    return sensorBar.getRaw() + sensorBar.getPosition() + sensorBar.getDensity();
+}
+
+void setUp() {
+    fakeI2CAttach(BAR_ADDRESS, &sx1509);
+    sx1509.isr = nullptr;
+    sx1509.setPort(0);
+    useSimulatedTime() = true;
+    simulatedMicros() = 0;
+    encoderCount = 0;
+}
+
+int testPolling() {
+    int failures = 0;
+    setUp();
+    SensorBar polled(BAR_ADDRESS, 255, INTERRUPT_PIN);
+    if (!polled.begin()) {
+        std::printf("FAIL polling: begin did not find the bar\n");
+        return 1;
+    }
+    sx1509.setPort(0x18);
+    if (polled.getRaw() != 0x18 || polled.getDensity() != 2) {
+        std::printf("FAIL polling: raw %02X density %d\n", polled.getRaw(), polled.getDensity());
+        failures++;
+    }
+    fakeI2CStats() = FakeI2CStats();
+    readAll(polled);
+    // every getter scans: the IR write, then the register address and the read
+    if (fakeI2CStats().transactions != 9) {
+        std::printf("FAIL polling: %lu transactions for one loop, expected 9\n", fakeI2CStats().transactions);
+        failures++;
+    }
+    return failures;
+}
+
+int testSampling() {
+    int failures = 0;
+    setUp();
+    SensorBar sampled(BAR_ADDRESS, 255, INTERRUPT_PIN);
+    bar = &sampled;
+    sampled.begin();
+    sx1509.isr = barChanged;
+    sx1509.setPort(0x18);
+    if (!sampled.beginSampling(readEncoder) || sampled.getRaw() != 0x18 || sampled.getSampleCount() != 1) {
+        std::printf("FAIL sampling: first sample %02X, %lu samples\n", sampled.getRaw(), sampled.getSampleCount());
+        failures++;
+    }
+
+    // no change, no bus traffic
+    fakeI2CStats() = FakeI2CStats();
+    for (int i = 0; i < 1000; ++i) {
+        readAll(sampled);
+    }
+    if (fakeI2CStats().transactions != 0) {
+        std::printf("FAIL sampling: %lu transactions without a change\n", fakeI2CStats().transactions);
+        failures++;
+    }
+
+    // a change is stamped when it is signalled, and read once
+    unsigned long portReads = sx1509.portReads;
+    simulatedMicros() = 5000;
+    encoderCount = 120;
+    sx1509.setPort(0x0C);
+    simulatedMicros() = 6000;
+    encoderCount = 130;
+    if (sampled.getPosition() <= 0 || sampled.getRaw() != 0x0C || sampled.getDensity() != 2) {
+        std::printf("FAIL sampling: position %d raw %02X after the change\n", sampled.getPosition(), sampled.getRaw());
+        failures++;
+    }
+    if (fakeI2CStats().transactions != 2 || sx1509.portReads != portReads + 1) {
+        std::printf("FAIL sampling: %lu transactions for a change, expected 2\n", fakeI2CStats().transactions);
+        failures++;
+    }
+    SensorBarSample sample;
+    if (!sampled.getSample(0, sample) || sample.raw != 0x0C || sample.time != 5000 || sample.count != 120) {
+        std::printf("FAIL sampling: newest sample %02X at %lu us, count %ld\n", sample.raw, sample.time, sample.count);
+        failures++;
+    }
+    if (!sampled.getSample(1, sample) || sample.raw != 0x18 || sampled.getSample(2, sample)) {
+        std::printf("FAIL sampling: older samples\n");
+        failures++;
+    }
+
+    // two changes before the bar is read are one sample, with the newer bits and the older stamp
+    encoderCount = 200;
+    sx1509.setPort(0x08);
+    encoderCount = 210;
+    sx1509.setPort(0x10);
+    if (sampled.getRaw() != 0x10 || sampled.getSampleCount() != 3 || !sampled.getSample(0, sample) || sample.count != 200) {
+        std::printf("FAIL sampling: %02X after two changes, %lu samples\n", sampled.getRaw(), sampled.getSampleCount());
+        failures++;
+    }
+
+    // the ring keeps the newest SENSORBAR_SAMPLES
+    for (int i = 0; i < 20; ++i) {
+        encoderCount = 1000 + i;
+        sx1509.setPort(1 << (i % 8));
+        sampled.updateSample();
+    }
+    for (int back = 0; back < SENSORBAR_SAMPLES; ++back) {
+        if (!sampled.getSample(back, sample) || sample.count != 1019 - back) {
+            std::printf("FAIL sampling: sample %d back has count %ld\n", back, sample.count);
+            failures++;
+        }
+    }
+    if (sampled.getSample(SENSORBAR_SAMPLES, sample)) {
+        std::printf("FAIL sampling: a sample older than the ring\n");
+        failures++;
+    }
+    bar = nullptr;
+    return failures;
+}
+
+int testSamplingWithoutIsr() {
+    int failures = 0;
+    setUp();
+    SensorBar sampled(BAR_ADDRESS, 255, INTERRUPT_PIN);
+    sampled.begin();
+    sampled.setInvertBits();
+    sx1509.setPort(0xE7);
+    sampled.beginSampling();
+    simulatedMicros() = 700;
+    sx1509.setPort(0xF3);
+    simulatedMicros() = 900;
+    fakeI2CStats() = FakeI2CStats();
+    SensorBarSample sample;
+    // the pin is polled and the change stamped when it is read
+    if (!sampled.updateSample() || !sampled.getSample(0, sample) || sample.raw != 0x0C || sample.time != 900) {
+        std::printf("FAIL no isr: sample %02X at %lu us\n", sample.raw, sample.time);
+        failures++;
+    }
+    if (sampled.updateSample() || fakeI2CStats().transactions != 2) {
+        std::printf("FAIL no isr: %lu transactions\n", fakeI2CStats().transactions);
+        failures++;
+    }
+    SensorBar noPin(BAR_ADDRESS);
+    if (noPin.beginSampling()) {
+        std::printf("FAIL no isr: sampling without an interrupt pin\n");
+        failures++;
+    }
+    return failures;
+}
+
+/** bus time of the two modes over a run where the line changes every few loops **/
+int testBusTime() {
+    const int LOOPS = 10000;
+    const int LOOPS_PER_CHANGE = 25;
+    setUp();
+    SensorBar polled(BAR_ADDRESS, 255, INTERRUPT_PIN);
+    polled.begin();
+    fakeI2CStats() = FakeI2CStats();
+    for (int i = 0; i < LOOPS; ++i) {
+        if (i % LOOPS_PER_CHANGE == 0) {
+            sx1509.setPort(0x18 << (i / LOOPS_PER_CHANGE % 4));
+        }
+        readAll(polled);
+    }
+    FakeI2CStats polling = fakeI2CStats();
+
+    setUp();
+    SensorBar sampled(BAR_ADDRESS, 255, INTERRUPT_PIN);
+    bar = &sampled;
+    sampled.begin();
+    sx1509.isr = barChanged;
+    sampled.beginSampling(readEncoder);
+    fakeI2CStats() = FakeI2CStats();
+    for (int i = 0; i < LOOPS; ++i) {
+        if (i % LOOPS_PER_CHANGE == 0) {
+            sx1509.setPort(0x18 << (i / LOOPS_PER_CHANGE % 4));
+        }
+        readAll(sampled);
+    }
+    FakeI2CStats sampling = fakeI2CStats();
+    bar = nullptr;
+
+    std::printf("bus per loop at 100 kHz, line changing every %d loops: polling %.1f us (%.2f transactions), "
+                "sampling %.1f us (%.2f transactions)\n", LOOPS_PER_CHANGE,
+                (double)polling.busMicros / LOOPS, (double)polling.transactions / LOOPS,
+                (double)sampling.busMicros / LOOPS, (double)sampling.transactions / LOOPS);
+    if (sampling.transactions * LOOPS_PER_CHANGE > polling.transactions) {
+        std::printf("FAIL bus time: sampling is not cheaper than polling\n");
+        return 1;
+    }
+    return 0;
+}
+
+int main() {
+    int failures = testPolling();
+    failures += testSampling();
+    failures += testSamplingWithoutIsr();
+    failures += testBusTime();
+
+    return failures ? 1 : 0;
+}
@@ -110,6 +110,26 @@ String interpretCommand() {
 			responseString = "Can't go backward here";
 		}
 	}
+	// check if route planning command; value is the target intersection name
+	else if (command == "p") {
+		Route route;
+		if (navigation.lookupRoute(values[0], route)) {
+			responseString = route.toString();
+		}
+		else {
+			responseString = "No route to " + values[0];
+		}
+	}
+	// check if go-to command; drives the route to the target intersection without stopping on straight runs
+	else if (command == "g") {
+		Route route;
+		if (navigation.lookupRoute(values[0], route) && navigation.executePlan(route)) {
+			responseString = navigation.getCurrentStateInfo();
+		}
+		else {
+			responseString = "No route to " + values[0];
+		}
+	}
 	// check if mode-setting command
 	// TODO: add functionality to STREAMOUT
 	else if (command == "SYNCOUT") {
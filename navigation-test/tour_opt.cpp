@@ -0,0 +1,526 @@
+// finds the best token collection tour for rounds 1-3 and compares it with TourPlanner's heuristic
+// usage: TourOptimizer [round] [capacity] [seconds] [threads]
+// without a round all of rounds 1-3 are searched; seconds limits the branch and bound search
+// exits with 1 if the heuristic beats the optimizer or the optimizer's tour does not check out
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "BoardTable.h"
+#include "RoutePlanner.h"
+#include "RouteTable.h"
+#include "TourPlanner.h"
+
+// rounds with at most this many tokens are solved by dynamic programming over the token bitmask
+const int DP_MAX_TOKENS = 20;
+
+struct Leg {
+    uint32_t cost;
+    uint16_t end;
+};
+
+/** every leg the search can need, precomputed from the route table **/
+struct LegCache {
+    int tokenCount;
+    int capacity;
+    std::vector<Leg> toToken; // [state * tokenCount + token]
+    std::vector<Leg> toDrop;  // [state]
+    std::vector<uint32_t> minToToken; // cheapest leg into each token from any tour state
+    uint32_t minDrop;
+
+    LegCache(TourPlanner& planner, uint16_t start) {
+        tokenCount = planner.getTokenCount();
+        capacity = planner.getCapacity();
+        toToken.resize(BOARD_STATE_COUNT * tokenCount);
+        toDrop.resize(BOARD_STATE_COUNT);
+        for (int s = 0; s < BOARD_STATE_COUNT; ++s) {
+            for (int t = 0; t < tokenCount; ++t) {
+                Leg& leg = toToken[s * tokenCount + t];
+                uint16_t state = s;
+                leg.cost = 0;
+                if (!planner.costToToken(state, t, leg.cost)) {
+                    leg.cost = TOUR_NO_COST;
+                }
+                leg.end = state;
+            }
+            Leg& drop = toDrop[s];
+            uint16_t state = s;
+            drop.cost = 0;
+            if (!planner.costToDrop(state, drop.cost)) {
+                drop.cost = TOUR_NO_COST;
+            }
+            drop.end = state;
+        }
+
+        // lower bounds only consider states a tour can be in: the start, token arrivals and drop ends
+        std::vector<bool> tourState(BOARD_STATE_COUNT, false);
+        std::vector<uint16_t> pending(1, start);
+        tourState[start] = true;
+        while (!pending.empty()) {
+            uint16_t s = pending.back();
+            pending.pop_back();
+            for (int t = 0; t <= tokenCount; ++t) {
+                const Leg& leg = t < tokenCount ? toToken[s * tokenCount + t] : toDrop[s];
+                if (leg.cost != TOUR_NO_COST && !tourState[leg.end]) {
+                    tourState[leg.end] = true;
+                    pending.push_back(leg.end);
+                }
+            }
+        }
+        minToToken.assign(tokenCount, TOUR_NO_COST);
+        minDrop = TOUR_NO_COST;
+        for (int s = 0; s < BOARD_STATE_COUNT; ++s) {
+            if (!tourState[s]) {
+                continue;
+            }
+            for (int t = 0; t < tokenCount; ++t) {
+                const Leg& leg = toToken[s * tokenCount + t];
+                minToToken[t] = std::min(minToToken[t], leg.cost);
+                // drop runs start where a token was picked up
+                if (leg.cost != TOUR_NO_COST) {
+                    minDrop = std::min(minDrop, toDrop[leg.end].cost);
+                }
+            }
+        }
+    }
+
+    /** takes token next as the done-th token of the tour; false if unreachable **/
+    bool step(uint16_t& state, uint32_t& cost, int token, int done) const {
+        const Leg& leg = toToken[state * tokenCount + token];
+        if (leg.cost == TOUR_NO_COST) {
+            return false;
+        }
+        cost += leg.cost;
+        state = leg.end;
+        if ((done + 1) % capacity == 0 || done + 1 == tokenCount) {
+            const Leg& drop = toDrop[state];
+            if (drop.cost == TOUR_NO_COST) {
+                return false;
+            }
+            cost += drop.cost;
+            state = drop.end;
+        }
+        return true;
+    }
+};
+
+struct Result {
+    uint32_t cost = TOUR_NO_COST;
+    std::vector<uint8_t> order;
+    bool proven = false;
+    unsigned long long nodes = 0;
+    double seconds = 0;
+    std::vector<uint32_t> countCost; // dp only: cheapest plan delivering k tokens, for deadline budgets
+};
+
+
+// dynamic programming: best cost for every (visited tokens, robot state) pair, layer by layer
+
+struct DpEntry {
+    uint16_t state;
+    uint16_t prevState;
+    uint8_t token; // token taken last
+    uint32_t cost;
+};
+
+Result solveDp(const LegCache& legs, uint16_t start, int threadCount) {
+    const int n = legs.tokenCount;
+    const uint32_t full = (1u << n) - 1;
+    std::vector<std::vector<DpEntry> > dp(size_t(full) + 1);
+    std::vector<std::vector<uint32_t> > layers(n + 1);
+    for (uint32_t mask = 0; mask <= full; ++mask) {
+        layers[__builtin_popcount(mask)].push_back(mask);
+    }
+    dp[0].push_back({ start, BOARD_NO_STATE, 0, 0 });
+    std::atomic<unsigned long long> nodes(0);
+
+    for (int k = 1; k <= n; ++k) {
+        const std::vector<uint32_t>& layer = layers[k];
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            unsigned long long localNodes = 0;
+            size_t i;
+            while ((i = next.fetch_add(64)) < layer.size()) {
+                for (size_t j = i; j < std::min(i + 64, layer.size()); ++j) {
+                    uint32_t mask = layer[j];
+                    std::vector<DpEntry>& out = dp[mask];
+                    for (int t = 0; t < n; ++t) {
+                        if (!(mask & (1u << t))) {
+                            continue;
+                        }
+                        for (const DpEntry& from : dp[mask ^ (1u << t)]) {
+                            uint16_t state = from.state;
+                            uint32_t cost = from.cost;
+                            ++localNodes;
+                            if (!legs.step(state, cost, t, k - 1)) {
+                                continue;
+                            }
+                            bool merged = false;
+                            for (DpEntry& e : out) {
+                                if (e.state == state) {
+                                    if (cost < e.cost) {
+                                        e = { state, from.state, uint8_t(t), cost };
+                                    }
+                                    merged = true;
+                                    break;
+                                }
+                            }
+                            if (!merged) {
+                                out.push_back({ state, from.state, uint8_t(t), cost });
+                            }
+                        }
+                    }
+                }
+            }
+            nodes += localNodes;
+        };
+        std::vector<std::thread> threads;
+        for (int w = 0; w < threadCount; ++w) {
+            threads.emplace_back(worker);
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        // the previous layer is only needed for reconstruction; keep it
+    }
+
+    Result result;
+    result.nodes = nodes;
+    result.proven = true;
+    // a plan can stop after any token, with a last drop run if it still carries tokens
+    result.countCost.assign(n + 1, TOUR_NO_COST);
+    result.countCost[0] = 0;
+    for (int k = 1; k <= n; ++k) {
+        for (uint32_t mask : layers[k]) {
+            for (const DpEntry& e : dp[mask]) {
+                uint32_t cost = e.cost;
+                if (k % legs.capacity != 0 && k != n) {
+                    const Leg& drop = legs.toDrop[e.state];
+                    cost = drop.cost == TOUR_NO_COST ? TOUR_NO_COST : cost + drop.cost;
+                }
+                result.countCost[k] = std::min(result.countCost[k], cost);
+            }
+        }
+    }
+    const DpEntry* best = nullptr;
+    for (const DpEntry& e : dp[full]) {
+        if (!best || e.cost < best->cost) {
+            best = &e;
+        }
+    }
+    if (!best) {
+        return result;
+    }
+    result.cost = best->cost;
+    result.order.resize(n);
+    uint32_t mask = full;
+    for (int k = n; k > 0; --k) {
+        result.order[k - 1] = best->token;
+        uint16_t prevState = best->prevState;
+        mask ^= 1u << best->token;
+        for (const DpEntry& e : dp[mask]) {
+            if (e.state == prevState) {
+                best = &e;
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+
+// branch and bound: depth first over tour prefixes, tasks are the first two tokens
+
+struct BnbShared {
+    const LegCache& legs;
+    std::atomic<uint32_t> best;
+    std::mutex orderLock;
+    std::vector<uint8_t> bestOrder;
+    std::atomic<bool> stop;
+    std::atomic<unsigned long long> nodes;
+    std::chrono::steady_clock::time_point deadline;
+
+    BnbShared(const LegCache& l) : legs(l), best(TOUR_NO_COST), stop(false), nodes(0) {}
+};
+
+class BnbWorker {
+private:
+    BnbShared& shared;
+    const LegCache& legs;
+    int n;
+    std::vector<uint8_t> order;
+    unsigned long long localNodes = 0;
+
+    uint32_t lowerBound(uint32_t mask, int done) {
+        uint32_t bound = 0;
+        for (int t = 0; t < n; ++t) {
+            if (!(mask & (1u << t))) {
+                bound += legs.minToToken[t];
+            }
+        }
+        int carried = done % legs.capacity;
+        int remaining = n - done;
+        bound += ((carried + remaining + legs.capacity - 1) / legs.capacity) * legs.minDrop;
+        return bound;
+    }
+
+public:
+    BnbWorker(BnbShared& s) : shared(s), legs(s.legs), n(s.legs.tokenCount), order(n) {}
+
+    void search(uint32_t mask, int done, uint16_t state, uint32_t cost) {
+        if (shared.stop) {
+            return;
+        }
+        if ((++localNodes & 0xFFF) == 0) {
+            shared.nodes += 0x1000;
+            if (std::chrono::steady_clock::now() > shared.deadline) {
+                shared.stop = true;
+                return;
+            }
+        }
+        if (done == n) {
+            std::lock_guard<std::mutex> lock(shared.orderLock);
+            if (cost < shared.best) {
+                shared.best = cost;
+                shared.bestOrder = order;
+            }
+            return;
+        }
+        if (cost + lowerBound(mask, done) >= shared.best) {
+            return;
+        }
+        // cheapest next leg first so good tours are found early
+        std::pair<uint32_t, int> children[TOUR_MAX_TOKENS];
+        int childCount = 0;
+        for (int t = 0; t < n; ++t) {
+            if (!(mask & (1u << t))) {
+                children[childCount++] = std::make_pair(legs.toToken[state * n + t].cost, t);
+            }
+        }
+        std::sort(children, children + childCount);
+        for (int c = 0; c < childCount; ++c) {
+            int t = children[c].second;
+            uint16_t nextState = state;
+            uint32_t nextCost = cost;
+            if (!legs.step(nextState, nextCost, t, done)) {
+                continue;
+            }
+            order[done] = t;
+            search(mask | (1u << t), done + 1, nextState, nextCost);
+        }
+    }
+
+    /** runs the subtree of tours starting with first, second **/
+    void task(uint16_t start, int first, int second) {
+        uint16_t state = start;
+        uint32_t cost = 0;
+        if (!legs.step(state, cost, first, 0)) {
+            return;
+        }
+        order[0] = first;
+        if (n == 1) {
+            search(1u << first, 1, state, cost);
+            return;
+        }
+        if (!legs.step(state, cost, second, 1)) {
+            return;
+        }
+        order[1] = second;
+        search((1u << first) | (1u << second), 2, state, cost);
+    }
+
+    unsigned long long getUncountedNodes() { return localNodes & 0xFFF; }
+};
+
+Result solveBnb(const LegCache& legs, uint16_t start, int threadCount, double seconds,
+                const uint8_t* incumbent, uint32_t incumbentCost) {
+    const int n = legs.tokenCount;
+    BnbShared shared(legs);
+    shared.best = incumbentCost + 1; // search must reach the heuristic's cost itself
+    shared.bestOrder.assign(incumbent, incumbent + n);
+    shared.deadline = std::chrono::steady_clock::now() +
+        std::chrono::microseconds(long(seconds * 1e6));
+
+    std::vector<std::pair<int, int> > tasks;
+    for (int a = 0; a < n; ++a) {
+        for (int b = 0; b < n; ++b) {
+            if (a != b || n == 1) {
+                tasks.push_back(std::make_pair(a, b));
+            }
+        }
+    }
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        BnbWorker w(shared);
+        size_t i;
+        while ((i = next++) < tasks.size() && !shared.stop) {
+            w.task(start, tasks[i].first, tasks[i].second);
+        }
+        shared.nodes += w.getUncountedNodes();
+    };
+    std::vector<std::thread> threads;
+    for (int w = 0; w < threadCount; ++w) {
+        threads.emplace_back(worker);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    Result result;
+    result.cost = std::min(uint32_t(shared.best), incumbentCost);
+    result.order = shared.bestOrder;
+    result.proven = !shared.stop;
+    result.nodes = shared.nodes;
+    return result;
+}
+
+
+/** deadline mode against the dp optimum for budgets of a quarter, half and three quarters of the full tour **/
+int checkDeadlines(int round, TourPlanner& planner, uint16_t start, const Result& exact) {
+    int failures = 0;
+    for (int quarter = 1; quarter <= 3; ++quarter) {
+        uint32_t budget = exact.cost * quarter / 4;
+        int best = 0;
+        for (size_t k = 0; k < exact.countCost.size(); ++k) {
+            if (exact.countCost[k] <= budget) {
+                best = int(k);
+            }
+        }
+        auto begin = std::chrono::steady_clock::now();
+        int steps = 0;
+        planner.beginDeadline(start, budget);
+        while (planner.improveDeadline()) {
+            ++steps;
+        }
+        auto end = std::chrono::steady_clock::now();
+        int count = planner.getOrderCount();
+        uint32_t cost = planner.getCost();
+        std::printf("  deadline %.1f s: %d tokens (cost %.1f s) in %d steps, %.0f us; best possible %d tokens\n",
+                    budget / 10.0, count, cost / 10.0, steps,
+                    std::chrono::duration<double, std::micro>(end - begin).count(), best);
+        if (cost > budget || planner.evaluate(start, planner.getOrder(), count) != cost || count > best) {
+            std::printf("FAIL round %d: deadline plan of %d tokens, cost %u for budget %u\n", round, count, cost, budget);
+            ++failures;
+        }
+    }
+    // without a deadline every token is planned
+    planner.beginDeadline(start, TOUR_NO_COST);
+    while (planner.improveDeadline()) {
+    }
+    int count = planner.getOrderCount();
+    if (count != planner.getTokenCount() || planner.getCost() != planner.evaluate(start, planner.getOrder(), count)) {
+        std::printf("FAIL round %d: %d of %d tokens planned without a deadline, cost %u\n", round, count,
+                    planner.getTokenCount(), planner.getCost());
+        ++failures;
+    }
+    return failures;
+}
+
+/** a planner that already planned must see changed move costs like a new one does **/
+int checkCostChange(int round, int capacity, TourPlanner& planner, uint16_t start) {
+    int failures = 0;
+    uint8_t dropCost = RoutePlanner::getApproachCost(MoveIntoDropPosition);
+    RoutePlanner::setApproachCost(MoveIntoDropPosition, dropCost + 50);
+    TourPlanner fresh(round, capacity);
+    uint32_t heuristic = planner.planHeuristic(start);
+    if (heuristic != fresh.planHeuristic(start)) {
+        std::printf("FAIL round %d: heuristic cost %u after a cost change, a new planner finds %u\n", round,
+                    heuristic, fresh.getCost());
+        ++failures;
+    }
+    planner.beginDeadline(start, heuristic / 2);
+    fresh.beginDeadline(start, heuristic / 2);
+    while (planner.improveDeadline()) {
+    }
+    while (fresh.improveDeadline()) {
+    }
+    if (planner.getOrderCount() != fresh.getOrderCount() || planner.getCost() != fresh.getCost()) {
+        std::printf("FAIL round %d: deadline plan after a cost change differs from a new planner's\n", round);
+        ++failures;
+    }
+    RoutePlanner::setApproachCost(MoveIntoDropPosition, dropCost);
+    planner.invalidateCosts();
+    return failures;
+}
+
+int optimizeRound(int round, int capacity, double seconds, int threadCount) {
+    TourPlanner planner(round, capacity);
+    uint16_t start = BoardTable::getStartState();
+    int n = planner.getTokenCount();
+    std::printf("round %d: %d tokens, %d drops, capacity %d\n", round, n, planner.getDropCount(), capacity);
+    if (n == 0) {
+        return 0;
+    }
+
+    // heuristic, as the robot would run it
+    const int repetitions = 20;
+    auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        planner.planHeuristic(start);
+    }
+    auto end = std::chrono::steady_clock::now();
+    uint32_t heuristicCost = planner.getCost();
+    std::vector<uint8_t> heuristicOrder(planner.getOrder(), planner.getOrder() + n);
+    std::printf("  heuristic: cost %u (%.1f s), %.0f us per plan on this machine\n", heuristicCost,
+                heuristicCost / 10.0, std::chrono::duration<double, std::micro>(end - begin).count() / repetitions);
+
+    LegCache legs(planner, start);
+    begin = std::chrono::steady_clock::now();
+    Result exact = n <= DP_MAX_TOKENS
+        ? solveDp(legs, start, threadCount)
+        : solveBnb(legs, start, threadCount, seconds, heuristicOrder.data(), heuristicCost);
+    end = std::chrono::steady_clock::now();
+    exact.seconds = std::chrono::duration<double>(end - begin).count();
+    std::printf("  %s: cost %u (%.1f s), %s, %llu nodes in %.2f s on %d threads\n",
+                n <= DP_MAX_TOKENS ? "dp" : "branch and bound", exact.cost, exact.cost / 10.0,
+                exact.proven ? "optimal" : "time limit hit, best found", exact.nodes, exact.seconds, threadCount);
+    if (exact.cost != TOUR_NO_COST) {
+        std::printf("  heuristic is %.1f%% above\n", 100.0 * (double(heuristicCost) - exact.cost) / exact.cost);
+    }
+
+    int failures = 0;
+    if (exact.order.size() != size_t(n) || planner.evaluate(start, exact.order.data()) != exact.cost) {
+        std::printf("FAIL round %d: optimizer tour does not evaluate to its cost\n", round);
+        ++failures;
+    }
+    if (exact.proven && heuristicCost < exact.cost) {
+        std::printf("FAIL round %d: heuristic beats the optimum\n", round);
+        ++failures;
+    }
+    if (!exact.countCost.empty()) {
+        failures += checkDeadlines(round, planner, start, exact);
+    }
+    failures += checkCostChange(round, capacity, planner, start);
+    if (failures == 0) {
+        planner.setOrder(exact.order.data(), exact.cost);
+        std::printf("  tour:");
+        for (int i = 0; i < n; ++i) {
+            std::printf(" %s", BoardTable::getIntersectionName(planner.getOrderedToken(i)).c_str());
+            std::printf("%s", i + 1 < n ? "," : "\n");
+        }
+    }
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    int round = argc > 1 ? std::atoi(argv[1]) : 0;
+    int capacity = argc > 2 ? std::atoi(argv[2]) : TOUR_DEFAULT_CAPACITY;
+    double seconds = argc > 3 ? std::atof(argv[3]) : 10.0;
+    int threadCount = argc > 4 ? std::atoi(argv[4]) : int(std::thread::hardware_concurrency());
+    if (threadCount < 1) {
+        threadCount = 1;
+    }
+    int failures = 0;
+    for (int r = 1; r <= 3; ++r) {
+        if (round == 0 || round == r) {
+            failures += optimizeRound(r, capacity, seconds, threadCount);
+        }
+    }
+    return failures ? 1 : 0;
+}